@@ -1,7 +1,7 @@
 @echo off
 echo Compiling the GUI project...
 
-gcc src/accounts.c src/teams.c src/match.c src/tournament.c src/history.c src/ui.c src/gui.c src/field_setups.c "src/Play Match/toss.c" src/grounds.c src/umpires.c -o gui.exe -I. -Isrc -Iinclude -Llib -Wall -Wextra -std=c99 -lraylib -lopengl32 -lgdi32 -lwinmm
+gcc src/accounts.c src/teams.c src/match.c src/ratings.c src/tournament.c src/points_table.c src/tournament_format.c src/history.c src/ui.c src/gui.c src/field_setups.c "src/Play Match/toss.c" src/grounds.c src/umpires.c src/search_index.c src/flag_atlas.c src/job_queue.c src/file_map.c src/audio_cache.c src/figure_batch.c src/text_cache.c src/lod.c src/field_coverage.c src/gfx.c src/gfx_raylib.c src/sim_engine.c src/sim_service.c src/qualification.c src/match_scheduler.c src/live_feed.c src/replica.c src/spectator.c -o gui.exe -I. -Isrc -Iinclude -Llib -Wall -Wextra -std=c99 -lraylib -lopengl32 -lgdi32 -lwinmm -lws2_32 -lpthread
 
 if %errorlevel% == 0 (
     echo Compilation successful. You can now run gui.exe
@@ -8,8 +8,10 @@
 #define NUM_FIELD_SETUPS 5
 // NUM_FIELDERS is now defined in common.h
 
-extern const Vector2 setups[NUM_FIELD_SETUPS][NUM_FIELDERS];
+extern const Vector2 setups[NUM_FIELD_SETUPS][NUM_FIELDERS];     // Right-handed batsman
+extern const Vector2 setups_lhb[NUM_FIELD_SETUPS][NUM_FIELDERS]; // Mirror image for a left-hander
 
-Vector2* get_field_setup(FieldingSetup setup, Player *striker);
+// Positions for the striker's batting hand (right-handed if striker is NULL)
+const Vector2* get_field_setup(FieldingSetup setup, const Player *striker);
 
 #endif // FIELD_SETUPS_H
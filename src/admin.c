@@ -184,8 +184,8 @@ static void admin_add_player_to_pool() {
     if (scanf("%d", &p.bowling_skill) != 1) p.bowling_skill = 50;
     clean_stdin();
     
-    p.runs_scored = 0;
-    p.wickets_taken = 0;
+    p.total_runs = 0;
+    p.total_wickets = 0;
     
     FILE *f = fopen("Data/all_players.dat", "a");
     if (!f) {
@@ -0,0 +1,232 @@
+#include "audio_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+// Cache file layout: AudioCacheHeader, then a complete 16-bit PCM .wav file.
+// A cache entry is only used when magic, version and the source file's hash and size all match.
+typedef struct {
+    char magic[4];          // "CSAC"
+    uint32_t version;
+    uint64_t source_hash;   // FNV-1a of the source file's bytes
+    uint64_t source_size;
+    uint32_t sample_rate;
+    uint32_t sample_size;
+    uint32_t channels;
+    uint32_t frame_count;
+    uint32_t wav_offset;    // Start of the .wav payload
+    uint32_t wav_size;
+    uint32_t pcm_offset;    // Start of the raw samples inside the file
+    uint32_t reserved;
+} AudioCacheHeader;
+
+#define WAV_HEADER_SIZE 44
+
+static uint64_t fnv1a_64(const unsigned char *data, long long size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (long long i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static void make_cache_dir(void) {
+    #if defined(_WIN32)
+        _mkdir("Data");
+        _mkdir(AUDIO_CACHE_DIR);
+    #else
+        mkdir("Data", 0777);
+        mkdir(AUDIO_CACHE_DIR, 0777);
+    #endif
+}
+
+// Data/cache/<file name>.pcm, built without raylib's shared static path buffers (this runs on workers)
+static void cache_path_for(char *dest, int size, const char *source_path) {
+    const char *base = source_path;
+    for (const char *c = source_path; *c; c++) if (*c == '/' || *c == '\\') base = c + 1;
+    snprintf(dest, size, "%s/%s.pcm", AUDIO_CACHE_DIR, base);
+}
+
+static void put_u32(unsigned char *p, uint32_t v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; }
+static void put_u16(unsigned char *p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+
+static bool write_cache(const char *cache_path, const Wave *wave, uint64_t hash, uint64_t source_size) {
+    uint32_t pcm_bytes = wave->frameCount * wave->channels * (wave->sampleSize / 8);
+
+    AudioCacheHeader header = { 0 };
+    memcpy(header.magic, "CSAC", 4);
+    header.version = AUDIO_CACHE_VERSION;
+    header.source_hash = hash;
+    header.source_size = source_size;
+    header.sample_rate = wave->sampleRate;
+    header.sample_size = wave->sampleSize;
+    header.channels = wave->channels;
+    header.frame_count = wave->frameCount;
+    header.wav_offset = sizeof(AudioCacheHeader);
+    header.wav_size = WAV_HEADER_SIZE + pcm_bytes;
+    header.pcm_offset = header.wav_offset + WAV_HEADER_SIZE;
+
+    unsigned char wav[WAV_HEADER_SIZE];
+    memcpy(wav, "RIFF", 4); put_u32(wav + 4, 36 + pcm_bytes);
+    memcpy(wav + 8, "WAVEfmt ", 8); put_u32(wav + 16, 16);
+    put_u16(wav + 20, 1); // PCM
+    put_u16(wav + 22, wave->channels);
+    put_u32(wav + 24, wave->sampleRate);
+    put_u32(wav + 28, wave->sampleRate * wave->channels * (wave->sampleSize / 8));
+    put_u16(wav + 32, wave->channels * (wave->sampleSize / 8));
+    put_u16(wav + 34, wave->sampleSize);
+    memcpy(wav + 36, "data", 4); put_u32(wav + 40, pcm_bytes);
+
+    // Write to a temporary name first so a crash never leaves a half written entry behind
+    char tmp_path[300];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", cache_path);
+    FILE *file = fopen(tmp_path, "wb");
+    if (!file) return false;
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(wav, WAV_HEADER_SIZE, 1, file) == 1 &&
+              fwrite(wave->data, 1, pcm_bytes, file) == pcm_bytes;
+    ok = (fclose(file) == 0) && ok;
+
+    if (ok) {
+        remove(cache_path); // rename() does not replace an existing file on Windows
+        ok = rename(tmp_path, cache_path) == 0;
+    }
+    if (!ok) remove(tmp_path);
+    return ok;
+}
+
+// Points cached->wave at the samples inside an already mapped cache file, if it is valid for this source
+static bool use_mapped_cache(CachedWave *cached, uint64_t hash, uint64_t source_size) {
+    const FileMap *map = &cached->map;
+    if (map->size < (long long)sizeof(AudioCacheHeader)) return false;
+
+    AudioCacheHeader header;
+    memcpy(&header, map->data, sizeof(header));
+    if (memcmp(header.magic, "CSAC", 4) != 0 || header.version != AUDIO_CACHE_VERSION) return false;
+    if (header.source_hash != hash || header.source_size != source_size) return false;
+
+    long long pcm_bytes = (long long)header.frame_count * header.channels * (header.sample_size / 8);
+    if (header.sample_size != 16 || header.pcm_offset + pcm_bytes > map->size) return false;
+    if (header.wav_offset + (long long)header.wav_size > map->size) return false;
+
+    cached->wave = (Wave){
+        .frameCount = header.frame_count,
+        .sampleRate = header.sample_rate,
+        .sampleSize = header.sample_size,
+        .channels = header.channels,
+        .data = (void*)(map->data + header.pcm_offset)
+    };
+    cached->wav_offset = header.wav_offset;
+    cached->wav_size = header.wav_size;
+    cached->owns_samples = false;
+    return true;
+}
+
+bool audio_cache_load(CachedWave *cached, const char *source_path) {
+    memset(cached, 0, sizeof(CachedWave));
+
+    FileMap source;
+    if (!file_map_open(&source, source_path)) return false;
+    uint64_t hash = fnv1a_64(source.data, source.size);
+    uint64_t source_size = (uint64_t)source.size;
+
+    char cache_path[256];
+    cache_path_for(cache_path, sizeof(cache_path), source_path);
+
+    // Hit: the samples are used straight from the mapping
+    if (file_map_open(&cached->map, cache_path)) {
+        if (use_mapped_cache(cached, hash, source_size)) {
+            file_map_close(&source);
+            return true;
+        }
+        file_map_close(&cached->map); // Stale or from an older version
+    }
+
+    // Miss: decode from the already mapped source, store 16-bit PCM for next time
+    Wave wave = LoadWaveFromMemory(GetFileExtension(source_path), source.data, (int)source.size);
+    file_map_close(&source);
+    if (wave.data == NULL) return false;
+    if (wave.sampleSize != 16) WaveFormat(&wave, wave.sampleRate, 16, wave.channels);
+
+    make_cache_dir();
+    if (write_cache(cache_path, &wave, hash, source_size) && file_map_open(&cached->map, cache_path)) {
+        if (use_mapped_cache(cached, hash, source_size)) {
+            UnloadWave(wave);
+            return true;
+        }
+        file_map_close(&cached->map);
+    }
+
+    // Cache not writable: keep the decoded samples in memory
+    cached->wave = wave;
+    cached->owns_samples = true;
+    return true;
+}
+
+void audio_cache_release(CachedWave *cached) {
+    if (cached->owns_samples) UnloadWave(cached->wave);
+    file_map_close(&cached->map);
+    memset(cached, 0, sizeof(CachedWave));
+}
+
+AudioClip audio_clip_create(CachedWave *cached, bool allow_streaming) {
+    AudioClip clip = { 0 };
+    if (cached->wave.data == NULL) return clip;
+
+    float seconds = (float)cached->wave.frameCount / cached->wave.sampleRate;
+    if (allow_streaming && seconds >= AUDIO_STREAM_MIN_SECONDS && cached->map.data != NULL) {
+        // Stream the .wav payload straight out of the mapping, only a small buffer stays resident
+        clip.music = LoadMusicStreamFromMemory(".wav", cached->map.data + cached->wav_offset, cached->wav_size);
+        if (clip.music.ctxData != NULL) {
+            clip.music.looping = false;
+            clip.streamed = true;
+            clip.backing = *cached;
+            memset(cached, 0, sizeof(CachedWave));
+            return clip;
+        }
+    }
+
+    clip.sound = LoadSoundFromWave(cached->wave);
+    audio_cache_release(cached);
+    return clip;
+}
+
+void audio_clip_play(AudioClip *clip) {
+    if (clip->streamed) {
+        StopMusicStream(clip->music); // Restart from the beginning like PlaySound does
+        PlayMusicStream(clip->music);
+    } else {
+        PlaySound(clip->sound);
+    }
+}
+
+void audio_clip_stop(AudioClip *clip) {
+    if (clip->streamed) StopMusicStream(clip->music);
+    else StopSound(clip->sound);
+}
+
+bool audio_clip_is_playing(AudioClip *clip) {
+    return clip->streamed ? IsMusicStreamPlaying(clip->music) : IsSoundPlaying(clip->sound);
+}
+
+void audio_clip_update(AudioClip *clip) {
+    if (clip->streamed && IsMusicStreamPlaying(clip->music)) UpdateMusicStream(clip->music);
+}
+
+void audio_clip_unload(AudioClip *clip) {
+    if (clip->streamed) {
+        UnloadMusicStream(clip->music);
+        audio_cache_release(&clip->backing);
+    } else {
+        UnloadSound(clip->sound);
+    }
+    memset(clip, 0, sizeof(AudioClip));
+}
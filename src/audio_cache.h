@@ -0,0 +1,41 @@
+#ifndef AUDIO_CACHE_H
+#define AUDIO_CACHE_H
+
+#include "raylib.h"
+#include "file_map.h"
+
+#define AUDIO_CACHE_DIR "Data/cache"
+#define AUDIO_CACHE_VERSION 1
+#define AUDIO_STREAM_MIN_SECONDS 4.0f // Clips at least this long can stream instead of staying resident
+
+// Decoded samples of one clip. On a cache hit they point straight into the mapped
+// cache file, so nothing is decoded or copied until the audio device needs it.
+typedef struct {
+    Wave wave;
+    FileMap map;            // Mapped cache file (empty if the cache could not be used)
+    int wav_offset;         // Cache file payload: a plain .wav that Music can stream from
+    int wav_size;
+    bool owns_samples;      // wave.data was decoded into memory and must be freed
+} CachedWave;
+
+// Safe to call from worker threads. Decodes the source and writes the cache on a miss.
+bool audio_cache_load(CachedWave *cached, const char *source_path);
+void audio_cache_release(CachedWave *cached);
+
+// A game sound: either fully resident or streamed from the mapped cache file
+typedef struct {
+    Sound sound;
+    Music music;
+    bool streamed;
+    CachedWave backing;     // Kept mapped while streaming
+} AudioClip;
+
+// Main thread only. Takes ownership of the cached wave.
+AudioClip audio_clip_create(CachedWave *cached, bool allow_streaming);
+void audio_clip_play(AudioClip *clip);
+void audio_clip_stop(AudioClip *clip);
+bool audio_clip_is_playing(AudioClip *clip);
+void audio_clip_update(AudioClip *clip); // Call every frame, refills streamed clips
+void audio_clip_unload(AudioClip *clip);
+
+#endif // AUDIO_CACHE_H
@@ -0,0 +1,100 @@
+#include "field_coverage.h"
+#include <math.h>
+#include <stdint.h>
+
+#define NUM_HANDS 2 // BATTING_STYLE_RHB, BATTING_STYLE_LHB
+
+// 6 bytes per cell keeps all ten grids under 400 KB.
+// Cells on the border between two fielders' areas keep both, the lookup picks the closer one.
+typedef struct {
+    uint8_t fielder;
+    uint8_t runner_up;
+    uint8_t catch_percent;
+    uint8_t unused;
+    uint16_t intercept_ms;
+} CoverageCell;
+
+static CoverageCell grids[NUM_FIELD_SETUPS][NUM_HANDS][FIELD_COVERAGE_RINGS][FIELD_COVERAGE_SECTORS];
+static bool grids_ready = false;
+
+static float catch_probability(float distance) {
+    if (distance >= FIELDER_CATCH_REACH) return 0.0f;
+    float reach = 1.0f - distance / FIELDER_CATCH_REACH;
+    return reach * reach; // Falls off quickly towards the edge of the fielder's reach
+}
+
+static void build_grid(CoverageCell grid[FIELD_COVERAGE_RINGS][FIELD_COVERAGE_SECTORS], const Vector2 *positions) {
+    for (int ring = 0; ring < FIELD_COVERAGE_RINGS; ring++) {
+        // Sample at the centre of each cell
+        float radius = (ring + 0.5f) * FIELD_COVERAGE_MAX_RADIUS / FIELD_COVERAGE_RINGS;
+        for (int sector = 0; sector < FIELD_COVERAGE_SECTORS; sector++) {
+            float angle = (sector + 0.5f) * 2.0f * PI / FIELD_COVERAGE_SECTORS;
+            Vector2 point = { cosf(angle) * radius, sinf(angle) * radius };
+
+            int nearest = 0, second = 0;
+            float nearest_dist = 1e9f, second_dist = 1e9f;
+            for (int i = 0; i < NUM_FIELDERS; i++) {
+                float dx = positions[i].x - point.x, dy = positions[i].y - point.y;
+                float d = sqrtf(dx*dx + dy*dy);
+                if (d < nearest_dist) {
+                    second_dist = nearest_dist;
+                    second = nearest;
+                    nearest_dist = d;
+                    nearest = i;
+                } else if (d < second_dist) {
+                    second_dist = d;
+                    second = i;
+                }
+            }
+
+            float seconds = FIELDER_REACTION_TIME + nearest_dist / FIELDER_SPEED;
+            CoverageCell *cell = &grid[ring][sector];
+            cell->fielder = (uint8_t)nearest;
+            cell->runner_up = (uint8_t)second;
+            cell->catch_percent = (uint8_t)(catch_probability(nearest_dist) * 100.0f + 0.5f);
+            cell->intercept_ms = (uint16_t)(seconds > 65.0f ? 65000 : seconds * 1000.0f);
+        }
+    }
+}
+
+void field_coverage_init(void) {
+    if (grids_ready) return;
+    for (int setup = 0; setup < NUM_FIELD_SETUPS; setup++) {
+        build_grid(grids[setup][BATTING_STYLE_RHB], setups[setup]);
+        build_grid(grids[setup][BATTING_STYLE_LHB], setups_lhb[setup]);
+    }
+    grids_ready = true;
+}
+
+bool field_coverage_lookup(FieldingSetup setup, BattingStyle hand, Vector2 position, FieldIntercept *result) {
+    if (!grids_ready || setup < 0 || setup >= NUM_FIELD_SETUPS || hand < 0 || hand >= NUM_HANDS) return false;
+
+    float radius = sqrtf(position.x*position.x + position.y*position.y);
+    float angle = atan2f(position.y, position.x);
+    if (angle < 0.0f) angle += 2.0f * PI;
+
+    int ring = (int)(radius / FIELD_COVERAGE_MAX_RADIUS * FIELD_COVERAGE_RINGS);
+    int sector = (int)(angle / (2.0f * PI) * FIELD_COVERAGE_SECTORS);
+    if (ring >= FIELD_COVERAGE_RINGS) ring = FIELD_COVERAGE_RINGS - 1;
+    if (sector >= FIELD_COVERAGE_SECTORS) sector = FIELD_COVERAGE_SECTORS - 1;
+
+    const CoverageCell *cell = &grids[setup][hand][ring][sector];
+    const Vector2 *positions = (hand == BATTING_STYLE_LHB) ? setups_lhb[setup] : setups[setup];
+    float dx = positions[cell->fielder].x - position.x, dy = positions[cell->fielder].y - position.y;
+    float distance = sqrtf(dx*dx + dy*dy);
+    int fielder = cell->fielder;
+
+    dx = positions[cell->runner_up].x - position.x;
+    dy = positions[cell->runner_up].y - position.y;
+    float runner_up_distance = sqrtf(dx*dx + dy*dy);
+    if (runner_up_distance < distance) {
+        distance = runner_up_distance;
+        fielder = cell->runner_up;
+    }
+
+    result->fielder = fielder;
+    result->distance = distance;
+    result->intercept_time = cell->intercept_ms / 1000.0f;
+    result->catch_probability = cell->catch_percent / 100.0f;
+    return true;
+}
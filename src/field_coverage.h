@@ -0,0 +1,33 @@
+#ifndef FIELD_COVERAGE_H
+#define FIELD_COVERAGE_H
+
+#include <stdbool.h>
+#include "field_setups.h"
+
+// Polar grid over the field in the same normalized units as the field setups
+// (1.0 = a fielder standing on the edge of the drawn field)
+#define FIELD_COVERAGE_RINGS 48
+#define FIELD_COVERAGE_SECTORS 128
+#define FIELD_COVERAGE_MAX_RADIUS 1.5f  // Anything further out is looked up on the last ring
+
+#define FIELDER_REACTION_TIME 0.3f      // Seconds before a fielder starts moving
+#define FIELDER_SPEED 0.35f             // Normalized field units per second
+#define FIELDER_CATCH_REACH 0.10f       // A ball landing further away than this cannot be caught
+
+// Who gets to a ball landing at a point, and how hard it is
+typedef struct {
+    int fielder;                // Index into the setup's NUM_FIELDERS positions
+    float distance;             // From the fielder's position to the ball, normalized units
+    float intercept_time;       // Seconds until the fielder reaches the ball
+    float catch_probability;    // 0..1 for a ball in the air, before skill
+} FieldIntercept;
+
+// Builds the grids for every setup and batting hand. Call once at startup before any lookup;
+// afterwards the grids are read-only and can be shared by any number of threads.
+void field_coverage_init(void);
+
+// Single grid lookup for a ball landing at `position` (normalized, relative to the field centre).
+// The grid narrows it to two candidate fielders; the distance is then measured exactly.
+bool field_coverage_lookup(FieldingSetup setup, BattingStyle hand, Vector2 position, FieldIntercept *result);
+
+#endif // FIELD_COVERAGE_H
@@ -0,0 +1,145 @@
+#include "figure_batch.h"
+#include "raymath.h"
+#include "text_cache.h"
+#include "gfx.h"
+#include <string.h>
+
+// Figure dimensions (same proportions the per-primitive version used)
+#define FIGURE_SCALE 1.2f
+#define HEAD_RADIUS (6.0f * FIGURE_SCALE)
+#define BODY_HEIGHT (15.0f * FIGURE_SCALE)
+#define BODY_WIDTH (12.0f * FIGURE_SCALE)
+#define LIMB_LENGTH (10.0f * FIGURE_SCALE)
+#define LIMB_THICK (2.0f * FIGURE_SCALE)
+#define HEAD_SEGMENTS 20 // At full detail, must divide by 4
+
+// Head fan + body quad + four limb quads
+#define VERTICES_PER_FIGURE (HEAD_SEGMENTS*3 + 6 + 4*6)
+#define MAX_VERTICES (FIGURE_BATCH_MAX_FIGURES * VERTICES_PER_FIGURE)
+
+typedef struct {
+    char text[FIGURE_LABEL_MAX_LEN];
+    float x, y;
+    int font_size;
+    Color color;
+} FigureLabel;
+
+// Vertex data for the frame, handed to the drawing backend in one call
+static float vertex_xy[MAX_VERTICES * 2];
+static unsigned char vertex_rgba[MAX_VERTICES * 4];
+
+static FigureDetail detail = FIGURE_DETAIL_FULL;
+static int num_vertices = 0;
+static FigureLabel labels[FIGURE_BATCH_MAX_LABELS];
+static int num_labels = 0;
+
+void figure_batch_set_detail(FigureDetail new_detail) {
+    detail = new_detail;
+}
+
+void figure_batch_begin(void) {
+    num_vertices = 0;
+    num_labels = 0;
+}
+
+static void push_vertex(Vector2 v, Color color) {
+    float *pos = vertex_xy + num_vertices*2;
+    unsigned char *col = vertex_rgba + num_vertices*4;
+    pos[0] = v.x;
+    pos[1] = v.y;
+    col[0] = color.r; col[1] = color.g; col[2] = color.b; col[3] = color.a;
+    num_vertices++;
+}
+
+// Emits the triangle in the winding raylib's 2D pipeline expects (back faces are culled)
+static void push_triangle(Vector2 a, Vector2 b, Vector2 c, Color color) {
+    float cross = (b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x);
+    push_vertex(a, color);
+    if (cross > 0) { push_vertex(c, color); push_vertex(b, color); }
+    else { push_vertex(b, color); push_vertex(c, color); }
+}
+
+static void push_quad(Vector2 a, Vector2 b, Vector2 c, Vector2 d, Color color) {
+    push_triangle(a, b, c, color);
+    push_triangle(a, c, d, color);
+}
+
+static void push_line(Vector2 start, Vector2 end, float thick, Color color) {
+    Vector2 dir = Vector2Subtract(end, start);
+    float length = Vector2Length(dir);
+    if (length <= 0.0f) return;
+    Vector2 side = { -dir.y/length * thick/2, dir.x/length * thick/2 };
+    push_quad(Vector2Add(start, side), Vector2Add(end, side), Vector2Subtract(end, side), Vector2Subtract(start, side), color);
+}
+
+static void push_circle(Vector2 center, float radius, Color color) {
+    // The fan steps through a unit-circle table shared by every head
+    static Vector2 unit[HEAD_SEGMENTS + 1];
+    static bool unit_ready = false;
+    if (!unit_ready) {
+        for (int i = 0; i <= HEAD_SEGMENTS; i++) {
+            float angle = 2.0f * PI * i / HEAD_SEGMENTS;
+            unit[i] = (Vector2){ cosf(angle), sinf(angle) };
+        }
+        unit_ready = true;
+    }
+    // Lower detail skips table entries: 20, 10 or 5 segments
+    int step = (detail == FIGURE_DETAIL_FULL) ? 1 : (detail == FIGURE_DETAIL_REDUCED) ? 2 : 4;
+    for (int i = 0; i < HEAD_SEGMENTS; i += step) {
+        push_triangle(center,
+                      (Vector2){ center.x + unit[i].x*radius, center.y + unit[i].y*radius },
+                      (Vector2){ center.x + unit[i + step].x*radius, center.y + unit[i + step].y*radius },
+                      color);
+    }
+}
+
+void figure_batch_add(Vector2 p, Color color, FigurePose pose) {
+    if (num_vertices + VERTICES_PER_FIGURE > MAX_VERTICES) return;
+
+    // Body
+    push_quad((Vector2){ p.x - BODY_WIDTH/2, p.y }, (Vector2){ p.x - BODY_WIDTH/2, p.y + BODY_HEIGHT },
+              (Vector2){ p.x + BODY_WIDTH/2, p.y + BODY_HEIGHT }, (Vector2){ p.x + BODY_WIDTH/2, p.y }, color);
+
+    // Head
+    push_circle((Vector2){ p.x, p.y - HEAD_RADIUS }, HEAD_RADIUS, color);
+
+    if (pose == FIGURE_POSE_FIELDING) {
+        if (detail != FIGURE_DETAIL_MINIMAL) {
+            push_line((Vector2){ p.x - BODY_WIDTH/2, p.y }, (Vector2){ p.x - BODY_WIDTH, p.y + LIMB_LENGTH }, LIMB_THICK, color); // Left arm
+            push_line((Vector2){ p.x + BODY_WIDTH/2, p.y }, (Vector2){ p.x + BODY_WIDTH, p.y + LIMB_LENGTH }, LIMB_THICK, color); // Right arm
+        }
+        push_line((Vector2){ p.x, p.y + BODY_HEIGHT }, (Vector2){ p.x - LIMB_LENGTH/2, p.y + BODY_HEIGHT + LIMB_LENGTH }, LIMB_THICK, color); // Left leg
+        push_line((Vector2){ p.x, p.y + BODY_HEIGHT }, (Vector2){ p.x + LIMB_LENGTH/2, p.y + BODY_HEIGHT + LIMB_LENGTH }, LIMB_THICK, color); // Right leg
+    } else {
+        if (pose == FIGURE_POSE_SWINGING) {
+            push_line((Vector2){ p.x, p.y + 5 }, (Vector2){ p.x - LIMB_LENGTH, p.y + 10 }, LIMB_THICK, color); // Swinging bat
+        } else {
+            push_line((Vector2){ p.x, p.y + 5 }, (Vector2){ p.x + LIMB_LENGTH, p.y + 5 }, LIMB_THICK, color); // Batting stance
+        }
+        push_line((Vector2){ p.x, p.y + BODY_HEIGHT }, (Vector2){ p.x - LIMB_LENGTH/2, p.y + BODY_HEIGHT + LIMB_LENGTH }, LIMB_THICK, color); // Left leg
+        push_line((Vector2){ p.x + LIMB_LENGTH/4, p.y + BODY_HEIGHT }, (Vector2){ p.x + LIMB_LENGTH, p.y + BODY_HEIGHT + LIMB_LENGTH }, LIMB_THICK, color); // Right leg
+    }
+}
+
+void figure_batch_label(const char *text, float x, float y, int font_size, Color color) {
+    if (text == NULL || text[0] == '\0' || num_labels >= FIGURE_BATCH_MAX_LABELS) return;
+    FigureLabel *label = &labels[num_labels++];
+    strncpy(label->text, text, FIGURE_LABEL_MAX_LEN - 1);
+    label->text[FIGURE_LABEL_MAX_LEN - 1] = '\0';
+    label->x = x;
+    label->y = y;
+    label->font_size = font_size;
+    label->color = color;
+}
+
+void figure_batch_flush(void) {
+    GfxDrawTriangles(vertex_xy, vertex_rgba, num_vertices);
+
+    for (int i = 0; i < num_labels; i++) {
+        const FigureLabel *label = &labels[i];
+        int width = text_cache_measure(label->text, label->font_size);
+        text_cache_draw(label->text, label->x - width/2, label->y, label->font_size, TEXT_STYLE_PLAIN, label->color);
+    }
+
+    figure_batch_begin();
+}
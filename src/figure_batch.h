@@ -0,0 +1,33 @@
+#ifndef FIGURE_BATCH_H
+#define FIGURE_BATCH_H
+
+#include "raylib.h"
+
+#define FIGURE_BATCH_MAX_FIGURES 32
+#define FIGURE_BATCH_MAX_LABELS 64
+#define FIGURE_LABEL_MAX_LEN 50
+
+typedef enum {
+    FIGURE_POSE_FIELDING,   // Arms out, legs apart (fielders, bowler, keeper, captains, umpire)
+    FIGURE_POSE_BATTING,    // Bat held out in front
+    FIGURE_POSE_SWINGING    // Bat swung back
+} FigurePose;
+
+typedef enum {
+    FIGURE_DETAIL_FULL,     // Round heads, all limbs
+    FIGURE_DETAIL_REDUCED,  // Coarser heads
+    FIGURE_DETAIL_MINIMAL   // Coarsest heads, fielders drawn without arms
+} FigureDetail;
+
+// Collects every player figure of a frame and submits them together: all bodies, heads and
+// limbs go into one vertex array handed to GfxDrawTriangles (a single mesh draw on raylib),
+// then the labels are drawn in a second pass from the text cache (they share the font
+// texture, so they batch as well).
+void figure_batch_set_detail(FigureDetail detail); // Applies to figures added afterwards
+void figure_batch_begin(void);
+void figure_batch_add(Vector2 position, Color color, FigurePose pose);
+// Queues a label centred horizontally on x with its top at y
+void figure_batch_label(const char *text, float x, float y, int font_size, Color color);
+void figure_batch_flush(void);  // Draws and clears everything queued since figure_batch_begin
+
+#endif // FIGURE_BATCH_H
@@ -0,0 +1,74 @@
+#include "file_map.h"
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool file_map_open(FileMap *map, const char *path) {
+    memset(map, 0, sizeof(FileMap));
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    map->data = (const unsigned char*)view;
+    map->size = size.QuadPart;
+    map->file_handle = file;
+    map->mapping_handle = mapping;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void *view = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping stays valid without the descriptor
+    if (view == MAP_FAILED) return false;
+
+    map->data = (const unsigned char*)view;
+    map->size = st.st_size;
+#endif
+    return true;
+}
+
+void file_map_close(FileMap *map) {
+    if (map->data == NULL) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile((void*)map->data);
+    CloseHandle((HANDLE)map->mapping_handle);
+    CloseHandle((HANDLE)map->file_handle);
+#else
+    munmap((void*)map->data, map->size);
+#endif
+    memset(map, 0, sizeof(FileMap));
+}
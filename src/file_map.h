@@ -0,0 +1,18 @@
+#ifndef FILE_MAP_H
+#define FILE_MAP_H
+
+#include <stdbool.h>
+
+// Read-only memory mapping of a whole file.
+// Kept free of platform headers so it can sit next to raylib.h (windows.h clashes with it).
+typedef struct {
+    const unsigned char *data;
+    long long size;
+    void *file_handle;      // HANDLE on Windows, unused elsewhere
+    void *mapping_handle;   // HANDLE on Windows, unused elsewhere
+} FileMap;
+
+bool file_map_open(FileMap *map, const char *path);
+void file_map_close(FileMap *map);
+
+#endif // FILE_MAP_H
@@ -0,0 +1,209 @@
+#include "flag_atlas.h"
+#include "gfx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <pthread.h>
+
+#define FLAG_PADDING 2 // Gap between packed flags so bilinear filtering never bleeds
+
+typedef enum {
+    ATLAS_IDLE,
+    ATLAS_LOADING,      // Loader thread is decoding and packing
+    ATLAS_IMAGE_READY,  // Packed image waits for upload on the main thread
+    ATLAS_READY,        // Texture uploaded, lookups are valid
+    ATLAS_EMPTY         // Nothing could be loaded
+} AtlasState;
+
+typedef struct {
+    char key[64];       // Normalized team name
+    Rectangle source;   // Pixel rectangle inside the atlas
+} FlagEntry;
+
+static struct {
+    pthread_t thread;
+    bool thread_started; // Needs a join before the results are used
+    pthread_mutex_t lock;
+    AtlasState state;   // Guarded by lock while the loader runs
+    char directory[256];
+    Image image;
+    Texture2D texture;
+    FlagEntry entries[FLAG_ATLAS_MAX_FLAGS];
+    int num_entries;
+} atlas = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+// "South Africa", "south_africa" and "SouthAfrica" all map to "southafrica"
+static void normalize_key(char *dest, const char *name, int size) {
+    int n = 0;
+    for (; *name && n < size - 1; name++) {
+        if (isalnum((unsigned char)*name)) dest[n++] = (char)tolower((unsigned char)*name);
+    }
+    dest[n] = '\0';
+}
+
+static AtlasState get_state(void) {
+    pthread_mutex_lock(&atlas.lock);
+    AtlasState state = atlas.state;
+    pthread_mutex_unlock(&atlas.lock);
+    return state;
+}
+
+static void set_state(AtlasState state) {
+    pthread_mutex_lock(&atlas.lock);
+    atlas.state = state;
+    pthread_mutex_unlock(&atlas.lock);
+}
+
+// Runs on the loader thread. Only CPU-side image functions are used here,
+// nothing that touches the GL context.
+static void* load_flags_thread(void *arg) {
+    (void)arg;
+    FilePathList files = LoadDirectoryFilesEx(atlas.directory, ".png", false);
+    Image images[FLAG_ATLAS_MAX_FLAGS];
+    int count = 0;
+
+    // Decode and scale every flag to the common cell height, then shelf-pack them row by row
+    int x = 0, y = 0;
+    for (unsigned int i = 0; i < files.count && count < FLAG_ATLAS_MAX_FLAGS; i++) {
+        Image img = LoadImage(files.paths[i]);
+        if (img.data == NULL) continue;
+
+        ImageFormat(&img, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        int width = img.width * FLAG_ATLAS_CELL_HEIGHT / img.height;
+        if (width > FLAG_ATLAS_WIDTH - 2 * FLAG_PADDING) width = FLAG_ATLAS_WIDTH - 2 * FLAG_PADDING;
+        ImageResize(&img, width, FLAG_ATLAS_CELL_HEIGHT);
+
+        if (x + width + FLAG_PADDING > FLAG_ATLAS_WIDTH) {
+            x = 0;
+            y += FLAG_ATLAS_CELL_HEIGHT + FLAG_PADDING;
+        }
+
+        // The key is the file name without folder or extension
+        const char *path = files.paths[i];
+        const char *base = path;
+        for (const char *c = path; *c; c++) if (*c == '/' || *c == '\\') base = c + 1;
+        char name[64];
+        snprintf(name, sizeof(name), "%s", base);
+        char *dot = strrchr(name, '.');
+        if (dot) *dot = '\0';
+
+        FlagEntry *entry = &atlas.entries[count];
+        normalize_key(entry->key, name, sizeof(entry->key));
+        entry->source = (Rectangle){ x + FLAG_PADDING, y + FLAG_PADDING, width, FLAG_ATLAS_CELL_HEIGHT };
+        images[count++] = img;
+        x += width + FLAG_PADDING;
+    }
+    UnloadDirectoryFiles(files);
+
+    if (count == 0) {
+        set_state(ATLAS_EMPTY);
+        return NULL;
+    }
+
+    // Power of two height keeps older GPUs happy
+    int height = 1;
+    while (height < y + FLAG_ATLAS_CELL_HEIGHT + 2 * FLAG_PADDING) height *= 2;
+
+    Image packed = GenImageColor(FLAG_ATLAS_WIDTH, height, BLANK);
+    for (int i = 0; i < count; i++) {
+        Rectangle src = { 0, 0, images[i].width, images[i].height };
+        ImageDraw(&packed, images[i], src, atlas.entries[i].source, WHITE);
+        UnloadImage(images[i]);
+    }
+
+    atlas.image = packed;
+    atlas.num_entries = count;
+    set_state(ATLAS_IMAGE_READY);
+    return NULL;
+}
+
+void flag_atlas_start_loading(const char *directory) {
+    if (get_state() != ATLAS_IDLE) return;
+
+    snprintf(atlas.directory, sizeof(atlas.directory), "%s", directory);
+    atlas.num_entries = 0;
+    set_state(ATLAS_LOADING);
+    atlas.thread_started = (pthread_create(&atlas.thread, NULL, load_flags_thread, NULL) == 0);
+    if (!atlas.thread_started) {
+        load_flags_thread(NULL); // No thread available, build it right here instead
+    }
+}
+
+static void join_loader(void) {
+    if (atlas.thread_started) {
+        pthread_join(atlas.thread, NULL);
+        atlas.thread_started = false;
+    }
+}
+
+bool flag_atlas_update(void) {
+    AtlasState state = get_state();
+    if (state == ATLAS_IMAGE_READY) {
+        join_loader();
+        atlas.texture = LoadTextureFromImage(atlas.image);
+        SetTextureFilter(atlas.texture, TEXTURE_FILTER_BILINEAR);
+        UnloadImage(atlas.image);
+        atlas.image = (Image){ 0 };
+        set_state(ATLAS_READY);
+        return true;
+    }
+    if (state == ATLAS_EMPTY) {
+        join_loader(); // Flags missing, draws simply fall through
+    }
+    return state == ATLAS_READY;
+}
+
+bool flag_atlas_finish(void) {
+    join_loader();
+    return flag_atlas_update();
+}
+
+bool flag_atlas_is_ready(void) {
+    return get_state() == ATLAS_READY;
+}
+
+bool flag_atlas_is_loading(void) {
+    AtlasState state = get_state();
+    return state == ATLAS_LOADING || state == ATLAS_IMAGE_READY;
+}
+
+bool flag_atlas_lookup(const char *team_name, Rectangle *source) {
+    if (team_name == NULL || get_state() != ATLAS_READY) return false;
+
+    char key[64];
+    normalize_key(key, team_name, sizeof(key));
+    for (int i = 0; i < atlas.num_entries; i++) {
+        if (strcmp(atlas.entries[i].key, key) == 0) {
+            *source = atlas.entries[i].source;
+            return true;
+        }
+    }
+    return false;
+}
+
+Texture2D flag_atlas_texture(void) {
+    return atlas.texture;
+}
+
+bool flag_atlas_draw(const char *team_name, Rectangle dest, Color tint) {
+    Rectangle source;
+    if (!flag_atlas_lookup(team_name, &source)) return false;
+
+    // Fit inside dest, centred, without stretching
+    float scale = fminf(dest.width / source.width, dest.height / source.height);
+    Rectangle fitted = { dest.x + (dest.width - source.width * scale) / 2, dest.y + (dest.height - source.height * scale) / 2,
+                         source.width * scale, source.height * scale };
+    GfxDrawTexturePro(atlas.texture, source, fitted, tint);
+    return true;
+}
+
+void flag_atlas_unload(void) {
+    join_loader();
+    if (get_state() == ATLAS_IMAGE_READY) UnloadImage(atlas.image);
+    if (atlas.texture.id != 0) UnloadTexture(atlas.texture);
+    atlas.texture = (Texture2D){ 0 };
+    atlas.num_entries = 0;
+    set_state(ATLAS_IDLE);
+}
@@ -0,0 +1,27 @@
+#ifndef FLAG_ATLAS_H
+#define FLAG_ATLAS_H
+
+#include "raylib.h"
+
+#define FLAG_ATLAS_MAX_FLAGS 64
+#define FLAG_ATLAS_WIDTH 1024
+#define FLAG_ATLAS_CELL_HEIGHT 96 // Every flag is scaled to this height when packed
+
+// All team flags packed into one texture. The images are decoded and packed on a
+// background thread; the main thread only uploads the finished atlas.
+void flag_atlas_start_loading(const char *directory);
+bool flag_atlas_update(void); // Call once per frame on the main thread, true once the atlas is usable
+bool flag_atlas_is_ready(void);
+bool flag_atlas_is_loading(void); // Loader still running or upload still pending
+bool flag_atlas_finish(void);     // Blocks until the loader is done, then uploads like flag_atlas_update
+
+// Team names match file names ignoring case, spaces and punctuation ("South Africa" -> South Africa.png)
+bool flag_atlas_lookup(const char *team_name, Rectangle *source);
+Texture2D flag_atlas_texture(void);
+
+// Draws a team's flag fitted inside dest (keeping its aspect ratio). Returns false if there is no flag.
+bool flag_atlas_draw(const char *team_name, Rectangle dest, Color tint);
+
+void flag_atlas_unload(void);
+
+#endif // FLAG_ATLAS_H
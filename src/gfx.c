@@ -0,0 +1,70 @@
+#include "gfx.h"
+#include <stddef.h>
+
+static const GfxBackend *active = NULL;
+
+void gfx_set_backend(const GfxBackend *backend) {
+    if (active != NULL && active != backend && active->shutdown) active->shutdown();
+    active = backend;
+}
+
+const GfxBackend* gfx_backend(void) {
+    return active;
+}
+
+void gfx_shutdown(void) {
+    if (active != NULL && active->shutdown) active->shutdown();
+}
+
+void GfxBeginDrawing(void) { active->begin_frame(); }
+void GfxEndDrawing(void) { active->end_frame(); }
+void GfxClearBackground(Color color) { active->clear(color); }
+
+void GfxDrawRectangle(int posX, int posY, int width, int height, Color color) {
+    active->rectangle((Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
+}
+
+void GfxDrawRectangleRec(Rectangle rec, Color color) { active->rectangle(rec, color); }
+void GfxDrawRectangleLinesEx(Rectangle rec, float lineThick, Color color) { active->rectangle_lines(rec, lineThick, color); }
+
+void GfxDrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) {
+    active->rectangle_rounded(rec, roundness, segments, color);
+}
+
+void GfxDrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, float lineThick, Color color) {
+    active->rectangle_rounded_lines(rec, roundness, segments, lineThick, color);
+}
+
+void GfxDrawCircle(int centerX, int centerY, float radius, Color color) {
+    active->circle((Vector2){ (float)centerX, (float)centerY }, radius, color);
+}
+
+void GfxDrawCircleV(Vector2 center, float radius, Color color) { active->circle(center, radius, color); }
+void GfxDrawCircleLinesV(Vector2 center, float radius, Color color) { active->circle_lines(center, radius, color); }
+
+void GfxDrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color) {
+    active->line((Vector2){ (float)startPosX, (float)startPosY }, (Vector2){ (float)endPosX, (float)endPosY }, color);
+}
+
+void GfxDrawText(const char *text, int posX, int posY, int fontSize, Color color) {
+    active->text(text, posX, posY, fontSize, color);
+}
+
+void GfxDrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint) {
+    active->text_pro(font, text, position, origin, rotation, fontSize, spacing, tint);
+}
+
+void GfxDrawGlyphs(Texture2D texture, const GfxGlyph *glyphs, int count, Vector2 position, Color tint) {
+    if (count > 0) active->glyphs(texture, glyphs, count, position, tint);
+}
+
+void GfxDrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Color tint) {
+    active->texture(texture, source, dest, tint);
+}
+
+void GfxDrawTriangles(const float *xy, const unsigned char *rgba, int vertexCount) {
+    if (vertexCount > 0) active->triangles(xy, rgba, vertexCount);
+}
+
+void GfxBeginScissorMode(int x, int y, int width, int height) { active->scissor_begin(x, y, width, height); }
+void GfxEndScissorMode(void) { active->scissor_end(); }
@@ -0,0 +1,68 @@
+#ifndef GFX_H
+#define GFX_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+// Thin drawing layer between the screens and raylib. Screens call the Gfx* functions
+// below (same arguments as the raylib functions they replace) and the active backend
+// does the work: the raylib backend draws, the recorder backend only counts and logs,
+// so the GUI can run headless on a machine without a GPU.
+
+// One glyph quad of a text run: where it sits in the font texture and where it goes,
+// relative to the run's position
+typedef struct {
+    Rectangle source;
+    Rectangle dest;
+} GfxGlyph;
+
+typedef struct {
+    const char *name;
+    void (*begin_frame)(void);
+    void (*end_frame)(void);
+    void (*clear)(Color color);
+    void (*rectangle)(Rectangle rec, Color color);
+    void (*rectangle_lines)(Rectangle rec, float thick, Color color);
+    void (*rectangle_rounded)(Rectangle rec, float roundness, int segments, Color color);
+    void (*rectangle_rounded_lines)(Rectangle rec, float roundness, int segments, float thick, Color color);
+    void (*circle)(Vector2 center, float radius, Color color);
+    void (*circle_lines)(Vector2 center, float radius, Color color);
+    void (*line)(Vector2 start, Vector2 end, Color color);
+    void (*text)(const char *text, int x, int y, int font_size, Color color);
+    void (*text_pro)(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float font_size, float spacing, Color tint);
+    void (*glyphs)(Texture2D texture, const GfxGlyph *glyphs, int count, Vector2 position, Color tint);
+    void (*texture)(Texture2D texture, Rectangle source, Rectangle dest, Color tint);
+    // Colored triangles in screen space: xy holds 2 floats and rgba 4 bytes per vertex
+    void (*triangles)(const float *xy, const unsigned char *rgba, int vertex_count);
+    void (*scissor_begin)(int x, int y, int width, int height);
+    void (*scissor_end)(void);
+    void (*shutdown)(void); // Releases GPU resources the backend created
+} GfxBackend;
+
+extern const GfxBackend gfx_raylib_backend;
+
+void gfx_set_backend(const GfxBackend *backend);
+const GfxBackend* gfx_backend(void);
+void gfx_shutdown(void); // Before CloseWindow
+
+void GfxBeginDrawing(void);
+void GfxEndDrawing(void);
+void GfxClearBackground(Color color);
+void GfxDrawRectangle(int posX, int posY, int width, int height, Color color);
+void GfxDrawRectangleRec(Rectangle rec, Color color);
+void GfxDrawRectangleLinesEx(Rectangle rec, float lineThick, Color color);
+void GfxDrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color);
+void GfxDrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, float lineThick, Color color);
+void GfxDrawCircle(int centerX, int centerY, float radius, Color color);
+void GfxDrawCircleV(Vector2 center, float radius, Color color);
+void GfxDrawCircleLinesV(Vector2 center, float radius, Color color);
+void GfxDrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color);
+void GfxDrawText(const char *text, int posX, int posY, int fontSize, Color color);
+void GfxDrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint);
+void GfxDrawGlyphs(Texture2D texture, const GfxGlyph *glyphs, int count, Vector2 position, Color tint);
+void GfxDrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Color tint);
+void GfxDrawTriangles(const float *xy, const unsigned char *rgba, int vertexCount);
+void GfxBeginScissorMode(int x, int y, int width, int height);
+void GfxEndScissorMode(void);
+
+#endif // GFX_H
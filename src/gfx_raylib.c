@@ -0,0 +1,139 @@
+#include "gfx.h"
+#include "raymath.h"
+#include <stddef.h>
+
+// Dynamic mesh behind raylib_triangles, created on first use and grown when needed
+static Mesh mesh = { 0 };
+static Material material = { 0 };
+static int mesh_capacity = 0;
+static bool mesh_failed = false; // No vertex buffers (OpenGL 1.1), use raylib's batch instead
+
+static void raylib_begin_frame(void) { BeginDrawing(); }
+static void raylib_end_frame(void) { EndDrawing(); }
+static void raylib_clear(Color color) { ClearBackground(color); }
+static void raylib_rectangle(Rectangle rec, Color color) { DrawRectangleRec(rec, color); }
+static void raylib_rectangle_lines(Rectangle rec, float thick, Color color) { DrawRectangleLinesEx(rec, thick, color); }
+
+static void raylib_rectangle_rounded(Rectangle rec, float roundness, int segments, Color color) {
+    DrawRectangleRounded(rec, roundness, segments, color);
+}
+
+static void raylib_rectangle_rounded_lines(Rectangle rec, float roundness, int segments, float thick, Color color) {
+    DrawRectangleRoundedLines(rec, roundness, segments, thick, color);
+}
+
+static void raylib_circle(Vector2 center, float radius, Color color) { DrawCircleV(center, radius, color); }
+static void raylib_circle_lines(Vector2 center, float radius, Color color) { DrawCircleLinesV(center, radius, color); }
+static void raylib_line(Vector2 start, Vector2 end, Color color) { DrawLineV(start, end, color); }
+
+static void raylib_text(const char *text, int x, int y, int font_size, Color color) {
+    DrawText(text, x, y, font_size, color);
+}
+
+static void raylib_text_pro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float font_size, float spacing, Color tint) {
+    DrawTextPro(font, text, position, origin, rotation, font_size, spacing, tint);
+}
+
+static void raylib_glyphs(Texture2D texture, const GfxGlyph *glyphs, int count, Vector2 position, Color tint) {
+    for (int i = 0; i < count; i++) {
+        Rectangle dest = { position.x + glyphs[i].dest.x, position.y + glyphs[i].dest.y, glyphs[i].dest.width, glyphs[i].dest.height };
+        DrawTexturePro(texture, glyphs[i].source, dest, (Vector2){ 0, 0 }, 0.0f, tint);
+    }
+}
+
+static void raylib_texture(Texture2D texture, Rectangle source, Rectangle dest, Color tint) {
+    DrawTexturePro(texture, source, dest, (Vector2){ 0, 0 }, 0.0f, tint);
+}
+
+static void release_mesh(void) {
+    if (mesh.vertices != NULL) UnloadMesh(mesh); // Also frees the CPU arrays
+    mesh = (Mesh){ 0 };
+    mesh_capacity = 0;
+}
+
+static bool reserve_mesh(int vertex_count) {
+    if (vertex_count <= mesh_capacity) return true;
+    release_mesh();
+
+    int capacity = 1024;
+    while (capacity < vertex_count) capacity *= 2;
+    mesh.vertexCount = capacity;
+    mesh.triangleCount = capacity / 3;
+    mesh.vertices = (float*)MemAlloc(capacity * 3 * sizeof(float));
+    mesh.texcoords = (float*)MemAlloc(capacity * 2 * sizeof(float)); // All zero, the default texture is plain white
+    mesh.colors = (unsigned char*)MemAlloc(capacity * 4 * sizeof(unsigned char));
+    UploadMesh(&mesh, true); // Dynamic: rewritten every frame
+
+    if (mesh.vboId == NULL || mesh.vboId[0] == 0) {
+        release_mesh();
+        return false;
+    }
+    if (material.maps == NULL) material = LoadMaterialDefault();
+    mesh_capacity = capacity;
+    return true;
+}
+
+// All triangles go into one dynamic vertex buffer and are drawn with a single call
+static void raylib_triangles(const float *xy, const unsigned char *rgba, int vertex_count) {
+    if (!mesh_failed && !reserve_mesh(vertex_count)) mesh_failed = true;
+
+    if (mesh_failed) {
+        for (int i = 0; i + 2 < vertex_count; i += 3) {
+            const float *v = xy + i*2;
+            const unsigned char *c = rgba + i*4;
+            DrawTriangle((Vector2){ v[0], v[1] }, (Vector2){ v[2], v[3] }, (Vector2){ v[4], v[5] },
+                         (Color){ c[0], c[1], c[2], c[3] });
+        }
+        return;
+    }
+
+    for (int i = 0; i < vertex_count; i++) {
+        mesh.vertices[i*3 + 0] = xy[i*2 + 0];
+        mesh.vertices[i*3 + 1] = xy[i*2 + 1];
+        mesh.vertices[i*3 + 2] = -0.5f; // Inside the 2D orthographic depth range
+    }
+    UpdateMeshBuffer(mesh, 0, mesh.vertices, vertex_count * 3 * sizeof(float), 0);
+    UpdateMeshBuffer(mesh, 3, rgba, vertex_count * 4 * sizeof(unsigned char), 0);
+
+    Mesh frame = mesh;
+    frame.vertexCount = vertex_count;
+    frame.triangleCount = vertex_count / 3;
+
+    // BeginMode2D/EndMode2D flush raylib's own batch around the mesh, so the
+    // triangles land on top of what was drawn before them and under what follows
+    BeginMode2D((Camera2D){ .zoom = 1.0f });
+    DrawMesh(frame, material, MatrixIdentity());
+    EndMode2D();
+}
+
+static void raylib_scissor_begin(int x, int y, int width, int height) { BeginScissorMode(x, y, width, height); }
+static void raylib_scissor_end(void) { EndScissorMode(); }
+
+static void raylib_shutdown(void) {
+    release_mesh();
+    if (material.maps != NULL) UnloadMaterial(material);
+    material = (Material){ 0 };
+    mesh_failed = false;
+}
+
+const GfxBackend gfx_raylib_backend = {
+    .name = "raylib",
+    .begin_frame = raylib_begin_frame,
+    .end_frame = raylib_end_frame,
+    .clear = raylib_clear,
+    .rectangle = raylib_rectangle,
+    .rectangle_lines = raylib_rectangle_lines,
+    .rectangle_rounded = raylib_rectangle_rounded,
+    .rectangle_rounded_lines = raylib_rectangle_rounded_lines,
+    .circle = raylib_circle,
+    .circle_lines = raylib_circle_lines,
+    .line = raylib_line,
+    .text = raylib_text,
+    .text_pro = raylib_text_pro,
+    .glyphs = raylib_glyphs,
+    .texture = raylib_texture,
+    .triangles = raylib_triangles,
+    .scissor_begin = raylib_scissor_begin,
+    .scissor_end = raylib_scissor_end,
+    .shutdown = raylib_shutdown
+};
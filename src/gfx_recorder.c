@@ -0,0 +1,207 @@
+#include "gfx_recorder.h"
+#include <string.h>
+
+// rlgl primitive modes, only used to decide where a new draw call starts
+typedef enum { MODE_QUADS, MODE_LINES, MODE_TRIANGLES } RecordMode;
+
+#define SHAPES_TEXTURE 0            // raylib 5.0 draws shapes with the default font's texture
+#define BATCH_VERTEX_LIMIT (8192*4) // RL_DEFAULT_BATCH_BUFFER_ELEMENTS quads
+#define CIRCLE_SEGMENTS 36          // What DrawCircleV uses
+
+static FILE *trace = NULL;
+static char label[64] = "";
+static GfxFrameStats current = { 0 };
+static GfxFrameStats last = { 0 };
+static int frame_number = 0;
+
+// Open rlgl draw: mode and texture of the call being extended
+static bool draw_open = false;
+static RecordMode draw_mode = MODE_QUADS;
+static unsigned int draw_texture = SHAPES_TEXTURE;
+static int batch_vertices = 0;
+
+void gfx_recorder_start(FILE *trace_file) {
+    trace = trace_file;
+    frame_number = 0;
+    memset(&current, 0, sizeof(current));
+    memset(&last, 0, sizeof(last));
+    draw_open = false;
+    batch_vertices = 0;
+}
+
+void gfx_recorder_set_label(const char *text) {
+    strncpy(label, text ? text : "", sizeof(label) - 1);
+    label[sizeof(label) - 1] = '\0';
+}
+
+GfxFrameStats gfx_recorder_last_frame(void) {
+    return last;
+}
+
+static void flush(void) {
+    draw_open = false;
+    batch_vertices = 0;
+}
+
+static void emit(RecordMode mode, unsigned int texture, int vertices) {
+    if (batch_vertices + vertices > BATCH_VERTEX_LIMIT) flush();
+    if (!draw_open || mode != draw_mode || texture != draw_texture) {
+        current.draw_calls++;
+        draw_open = true;
+        draw_mode = mode;
+        draw_texture = texture;
+    }
+    batch_vertices += vertices;
+    current.vertices += vertices;
+    current.commands++;
+}
+
+static int visible_chars(const char *text) {
+    int count = 0;
+    for (const char *c = text; *c; c++) {
+        if (*c != ' ' && *c != '\t' && *c != '\n' && ((unsigned char)*c & 0xC0) != 0x80) count++; // Skip UTF-8 continuation bytes
+    }
+    return count;
+}
+
+static void rec_begin_frame(void) {
+    memset(&current, 0, sizeof(current));
+    current.frame = frame_number;
+    flush();
+}
+
+static void rec_end_frame(void) {
+    flush();
+    last = current;
+    if (trace) {
+        fprintf(trace, "frame %d %s commands %d draws %d vertices %d glyphs %d scissors %d meshes %d\n",
+                current.frame, label, current.commands, current.draw_calls, current.vertices,
+                current.glyphs, current.scissors, current.meshes);
+    }
+    frame_number++;
+}
+
+static void rec_clear(Color color) {
+    (void)color;
+    current.commands++;
+    if (trace) fprintf(trace, "clear\n");
+}
+
+static void rec_rectangle(Rectangle rec, Color color) {
+    (void)color;
+    emit(MODE_QUADS, SHAPES_TEXTURE, 4);
+    if (trace) fprintf(trace, "rect %.0f %.0f %.0f %.0f\n", rec.x, rec.y, rec.width, rec.height);
+}
+
+static void rec_rectangle_lines(Rectangle rec, float thick, Color color) {
+    (void)color;
+    emit(MODE_QUADS, SHAPES_TEXTURE, 16); // Four thin rectangles
+    if (trace) fprintf(trace, "rect_lines %.0f %.0f %.0f %.0f %.1f\n", rec.x, rec.y, rec.width, rec.height, thick);
+}
+
+static void rec_rectangle_rounded(Rectangle rec, float roundness, int segments, Color color) {
+    (void)color;
+    if (segments < 4) segments = 4;
+    emit(MODE_QUADS, SHAPES_TEXTURE, 4*(segments/2)*4 + 5*4); // Corner fans + five rectangles
+    if (trace) fprintf(trace, "rect_rounded %.0f %.0f %.0f %.0f %.2f %d\n", rec.x, rec.y, rec.width, rec.height, roundness, segments);
+}
+
+static void rec_rectangle_rounded_lines(Rectangle rec, float roundness, int segments, float thick, Color color) {
+    (void)color;
+    if (segments < 4) segments = 4;
+    emit(MODE_QUADS, SHAPES_TEXTURE, 4*segments*4 + 4*4);
+    if (trace) fprintf(trace, "rect_rounded_lines %.0f %.0f %.0f %.0f %.2f %d %.1f\n", rec.x, rec.y, rec.width, rec.height, roundness, segments, thick);
+}
+
+static void rec_circle(Vector2 center, float radius, Color color) {
+    (void)color;
+    emit(MODE_QUADS, SHAPES_TEXTURE, (CIRCLE_SEGMENTS/2)*4);
+    if (trace) fprintf(trace, "circle %.0f %.0f %.1f\n", center.x, center.y, radius);
+}
+
+static void rec_circle_lines(Vector2 center, float radius, Color color) {
+    (void)color;
+    emit(MODE_LINES, SHAPES_TEXTURE, CIRCLE_SEGMENTS*2);
+    if (trace) fprintf(trace, "circle_lines %.0f %.0f %.1f\n", center.x, center.y, radius);
+}
+
+static void rec_line(Vector2 start, Vector2 end, Color color) {
+    (void)color;
+    emit(MODE_LINES, SHAPES_TEXTURE, 2);
+    if (trace) fprintf(trace, "line %.0f %.0f %.0f %.0f\n", start.x, start.y, end.x, end.y);
+}
+
+static void rec_text(const char *text, int x, int y, int font_size, Color color) {
+    (void)color;
+    int glyphs = visible_chars(text);
+    current.glyphs += glyphs;
+    emit(MODE_QUADS, SHAPES_TEXTURE, glyphs*4);
+    if (trace) fprintf(trace, "text %d %d %d \"%s\"\n", x, y, font_size, text);
+}
+
+static void rec_text_pro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float font_size, float spacing, Color tint) {
+    (void)font; (void)origin; (void)spacing; (void)tint;
+    int glyphs = visible_chars(text);
+    current.glyphs += glyphs;
+    emit(MODE_QUADS, SHAPES_TEXTURE, glyphs*4);
+    if (trace) fprintf(trace, "text_pro %.0f %.0f %.0f %.1f \"%s\"\n", position.x, position.y, font_size, rotation, text);
+}
+
+static void rec_glyphs(Texture2D texture, const GfxGlyph *glyphs, int count, Vector2 position, Color tint) {
+    (void)texture; (void)glyphs; (void)tint;
+    current.glyphs += count;
+    emit(MODE_QUADS, SHAPES_TEXTURE, count*4); // Every glyph run in the GUI uses the default font
+    if (trace) fprintf(trace, "glyphs %.0f %.0f %d\n", position.x, position.y, count);
+}
+
+static void rec_texture(Texture2D texture, Rectangle source, Rectangle dest, Color tint) {
+    (void)source; (void)tint;
+    emit(MODE_QUADS, texture.id + 1, 4); // +1 keeps it apart from SHAPES_TEXTURE
+    if (trace) fprintf(trace, "texture %u %.0f %.0f %.0f %.0f\n", texture.id, dest.x, dest.y, dest.width, dest.height);
+}
+
+static void rec_triangles(const float *xy, const unsigned char *rgba, int vertex_count) {
+    (void)xy; (void)rgba;
+    // A mesh draw flushes the batch before and after and is one call of its own
+    flush();
+    current.draw_calls++;
+    current.vertices += vertex_count;
+    current.meshes++;
+    current.commands++;
+    if (trace) fprintf(trace, "triangles %d\n", vertex_count);
+}
+
+static void rec_scissor_begin(int x, int y, int width, int height) {
+    flush();
+    current.scissors++;
+    current.commands++;
+    if (trace) fprintf(trace, "scissor %d %d %d %d\n", x, y, width, height);
+}
+
+static void rec_scissor_end(void) {
+    flush();
+    current.commands++;
+    if (trace) fprintf(trace, "scissor_end\n");
+}
+
+const GfxBackend gfx_recorder_backend = {
+    .name = "recorder",
+    .begin_frame = rec_begin_frame,
+    .end_frame = rec_end_frame,
+    .clear = rec_clear,
+    .rectangle = rec_rectangle,
+    .rectangle_lines = rec_rectangle_lines,
+    .rectangle_rounded = rec_rectangle_rounded,
+    .rectangle_rounded_lines = rec_rectangle_rounded_lines,
+    .circle = rec_circle,
+    .circle_lines = rec_circle_lines,
+    .line = rec_line,
+    .text = rec_text,
+    .text_pro = rec_text_pro,
+    .glyphs = rec_glyphs,
+    .texture = rec_texture,
+    .triangles = rec_triangles,
+    .scissor_begin = rec_scissor_begin,
+    .scissor_end = rec_scissor_end,
+    .shutdown = NULL
+};
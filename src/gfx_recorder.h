@@ -0,0 +1,28 @@
+#ifndef GFX_RECORDER_H
+#define GFX_RECORDER_H
+
+#include "gfx.h"
+#include <stdio.h>
+
+// Per-frame cost as raylib 5.0 would see it. Draw calls are estimated with rlgl's batching
+// rules: a new call starts whenever the primitive mode (quads/lines/triangles) or texture
+// changes, and scissor changes or mesh draws flush the batch.
+typedef struct {
+    int frame;
+    int commands;       // Gfx* calls
+    int draw_calls;     // Estimated GPU draw calls
+    int vertices;
+    int glyphs;         // Text quads
+    int scissors;
+    int meshes;         // Triangle lists submitted as one mesh
+} GfxFrameStats;
+
+extern const GfxBackend gfx_recorder_backend;
+
+// trace may be NULL. Otherwise every command is written to it, one line each, followed by a
+// "frame" summary line at the end of every frame.
+void gfx_recorder_start(FILE *trace);
+void gfx_recorder_set_label(const char *label);    // Included in the frame summary lines
+GfxFrameStats gfx_recorder_last_frame(void);
+
+#endif // GFX_RECORDER_H
@@ -12,6 +12,22 @@
 #include "field_setups.h"
 #include "grounds.h"
 #include "umpires.h"
+#include "search_index.h"
+#include "flag_atlas.h"
+#include "job_queue.h"
+#include "audio_cache.h"
+#include "figure_batch.h"
+#include "text_cache.h"
+#include "lod.h"
+#include "field_coverage.h"
+#include "gfx.h"
+#include "sim_engine.h"
+#include "sim_service.h"
+#include "qualification.h"
+#include "live_feed.h"
+#include "spectator.h"
+#include "tournament_format.h"
+#include "ratings.h"
 #include "ui.h"
 
 #define SILVER (Color){ 192, 192, 192, 255 }
@@ -25,6 +41,17 @@ typedef struct {
     bool isPassword;
 } TextBox;
 
+// Scroll state for a list that only lays out and draws the rows inside its view
+typedef struct {
+    Rectangle bounds;      // Visible panel, rows are clipped to this
+    float itemHeight;      // Height of one row
+    float headerHeight;    // Space above the first row (scrolls with the rows)
+    float scrollY;         // Content offset, always <= 0
+    int first;             // First row that intersects the view
+    int last;              // One past the last row that intersects the view
+    bool dragging;         // Scrollbar handle is being dragged
+} ListView;
+
 // Screen state management
 typedef enum GameScreen { 
     SCREEN_LOGIN,
@@ -39,12 +66,12 @@ typedef enum GameScreen {
     SCREEN_PLACEHOLDER,
     SCREEN_MANAGE_USERS,
     SCREEN_MATCH_SETUP,
-    SCREEN_WC_SETUP
+    SCREEN_WC_SETUP,
+    SCREEN_SPECTATE,        // Watching a match hosted on another machine (--spectate)
+    SCREEN_RANKINGS
 } GameScreen;
 
 typedef struct {
-    Texture2D flagBatting;
-    Texture2D flagBowling;
     Font font;
     bool loaded;
 } ScorecardAssets;
@@ -81,24 +108,90 @@ typedef struct {
 
 // Structure to hold all game sounds
 typedef struct {
-    Sound bowling;
-    Sound dot_ball;
-    Sound edge;
-    Sound firecrackers;
-    Sound four;
-    Sound single;
-    Sound six;
-    Sound toss;
-    Sound bowled_wicket;
+    AudioClip bowling;
+    AudioClip dot_ball;
+    AudioClip edge;
+    AudioClip firecrackers; // Long clips, streamed when streamLongClips is set
+    AudioClip four;
+    AudioClip single;
+    AudioClip six;
+    AudioClip toss;
+    AudioClip bowled_wicket;
 } GameSounds;
 
+// Stream the long clips (crowd, toss) from the mapped audio cache instead of keeping them resident
+static bool streamLongClips = true;
+
+// One sound decoded by the startup pipeline
+typedef struct {
+    const char *path;
+    AudioClip *target;
+    CachedWave wave; // Filled in by a worker from the audio cache, turned into the clip on the main thread
+} SoundLoadJob;
+
+#define NUM_GAME_SOUNDS 9
+
+// Worker pool shared by everything that runs off the main thread
+static JobQueue *workerPool = NULL;
+
+// Set when a background World Cup fixture finishes, so the points table is rebuilt
+static bool fixtureResultsChanged = false;
+#define WC_MAX_FIXTURES_PER_DAY 4
+
+// Bowls the gameplay screen's deliveries; the screen answers its questions with clicks
+static SimEngine matchEngine;
+
+// Shared-memory ball feed for scoreboards and overlays, NULL if it could not be created
+static LiveFeed *liveFeed = NULL;
+
+// Ratings every screen rates into and ranks from, read from Data/ratings.dat on first use and
+// saved after each change. The generation moves when ids are reassigned, as a rebuild does.
+static Ratings gameRatings;
+static bool gameRatingsLoaded = false;
+static unsigned gameRatingsGeneration = 0;
+
+static Ratings *GameRatings(void) {
+    if (!gameRatingsLoaded) {
+        ratings_init(&gameRatings);
+        ratings_load(&gameRatings, RATINGS_FILE);
+        gameRatingsLoaded = true;
+    }
+    return &gameRatings;
+}
+
+// A rebuild of the ratings from the match logs, run on the worker pool. The rankings screen
+// shows how far it has got, and the main loop swaps the result in for gameRatings when done.
+typedef struct {
+    Ratings ratings;
+    RatingsProgress progress;
+    int replayed;
+    bool finished;      // Stored last by the worker, with release ordering
+} RatingsRebuild;
+
+static RatingsRebuild ratingsRebuild;
+static bool ratingsRebuildRunning = false;
+static char ratingsRebuildStatus[96] = "";
+
+// Set by --host: mirrors the gameplay screen to spectators. Set by --spectate: the match we watch.
+static SpectatorHost *spectatorHost = NULL;
+static SpectatorViewer *spectatorViewer = NULL;
+
+// Rosters read during startup, handed to the first screen that needs them
+static Team *preloadedTeams = NULL;
+static int preloadedNumTeams = 0;
+
 // Forward declarations for screen functions
 static void ChangeScreen(GuiState *state, GameScreen newScreen);
+static void RunStartupPipeline(GameSounds *sounds);
+static void UpdateRatingsRebuild(void);
+static void UpdateDrawCurrentScreen(GuiState *state, GameState *gameState, GameSounds *sounds);
+static Team* LoadTeamsPreloaded(int *num_teams);
 static void UpdateDrawLoginScreen(GuiState *state);
 static void UpdateDrawRegisterScreen(GuiState *state);
 static void UpdateDrawAdminMenuScreen(GuiState *state);
 static void UpdateDrawMainMenuScreen(GuiState *state, GameState *gameState);
 static void InitializeAudience(void);
+static void UpdateAudienceLayout(Vector2 center, float innerRadius, float outerRadius);
 static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, GameSounds *sounds);
 static void DrawBowlerSelection(GameState *gameState);
 static void DrawBatsmanSelection(GameState *gameState);
@@ -109,29 +202,21 @@ static void UpdateDrawPlaceholderScreen(GuiState *state, const char *title);
 static void UpdateDrawManageUsersScreen(GuiState *state);
 static void UpdateDrawMatchSetupScreen(GuiState *state);
 static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameSounds *sounds);
+static void UpdateDrawSpectatorScreen(GuiState *state, GameSounds *sounds);
+static void UpdateDrawRankingsScreen(GuiState *state);
 static void DrawTextBold(const char *text, int posX, int posY, int fontSize, Color color);
 
-static Texture2D LoadTeamFlag(const char *teamName)
-{
-    char path[256];
-    sprintf(path, "assets/flags/%s.png", teamName);
-
-    if (FileExists(path)) {
-        return LoadTexture(path);
-    }
-
-    // Fallback: empty texture
-    Texture2D dummy = {0};
-    return dummy;
-}
-
 // Helper for text boxes
 static void HandleTextBox(TextBox *box);
 
-static const char* stristr(const char* haystack, const char* needle);
+// Helpers for virtualized lists
+static void UpdateListView(ListView *list, int itemCount);
+static float ListViewRowY(const ListView *list, int row);
+static void DrawListViewScrollbar(ListView *list, int itemCount);
+static void GrowColumnWidth(float *width, const char *text, int fontSize);
 
 // Helpers for gameplay screen
-static void DrawPlayerFigure(Vector2 position, Color color, bool is_striker, const char* team_name, bool is_swinging);
+static void QueuePlayerFigure(Vector2 position, Color color, FigurePose pose, const char* team_name);
 static void DrawFielders(const Vector2 *fielder_positions, GameState *gameState, Vector2 fieldCenter, float fieldRadius, int dragging_fielder_idx);
 
 static void UpdateDrawGroundsScreen(GuiState *state) {
@@ -139,7 +224,8 @@ static void UpdateDrawGroundsScreen(GuiState *state) {
     static Ground *grounds = NULL;
     static int num_grounds = 0;
     static bool needs_refresh = true;
-    static Vector2 scroll = { 0.0f, 0.0f };
+    static ListView list = { 0 };
+    static SearchIndex search = { 0 }; // Name and country of every ground
     static int editIndex = -1; // -1 means not editing, >= 0 is the index of the ground being edited
 
     // Input boxes for adding/editing and filtering
@@ -167,6 +253,15 @@ static void UpdateDrawGroundsScreen(GuiState *state) {
         if (grounds) free(grounds);
         grounds = load_grounds(&num_grounds);
         needs_refresh = false;
+
+        // One key per ground, the separator keeps a query from matching across the two fields
+        search_index_clear(&search);
+        for (int i = 0; i < num_grounds; i++) {
+            char key[MAX_GROUND_NAME_LEN + MAX_COUNTRY_NAME_LEN + 1];
+            snprintf(key, sizeof(key), "%s\x1f%s", grounds[i].name, grounds[i].country);
+            search_index_add(&search, key);
+        }
+        search_index_finish(&search);
     }
 
     HandleTextBox(&nameBox);
@@ -212,91 +307,68 @@ static void UpdateDrawGroundsScreen(GuiState *state) {
     }
 
     // --- Drawing ---
-    BeginDrawing();
-    ClearBackground(ICC_BG);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
 
-    DrawTextBold("Manage Grounds", GetScreenWidth()/2 - MeasureText("Manage Grounds", 40)/2, 10, 40, ICC_GRAY);
+    DrawTextBold("Manage Grounds", GetScreenWidth()/2 - text_cache_measure("Manage Grounds", 40)/2, 10, 40, ICC_GRAY);
     
     // --- Draw Search and Filter UI ---
     DrawTextBold("Search Name/Country:", searchBox.bounds.x, searchBox.bounds.y - 15, 10, ICC_GRAY);
-    DrawRectangleRec(searchBox.bounds, ICC_WHITE); DrawRectangleLinesEx(searchBox.bounds, 1, ICC_GRAY);
+    GfxDrawRectangleRec(searchBox.bounds, ICC_WHITE); GfxDrawRectangleLinesEx(searchBox.bounds, 1, ICC_GRAY);
     DrawTextBold(searchBox.text, searchBox.bounds.x + 5, searchBox.bounds.y + 5, 20, ICC_WHITE);
 
-    // --- Filtering Logic (Fuzzy Search) ---
-    Ground* filtered_grounds = NULL;
+    // --- Filtering Logic ---
+    // Indices into grounds[], only recomputed by the index when the search text changes
     int num_filtered_grounds = 0;
-    int* original_indices = NULL;
-
-    if (num_grounds > 0) {
-        filtered_grounds = malloc(num_grounds * sizeof(Ground));
-        original_indices = malloc(num_grounds * sizeof(int));
-        
-        for (int i = 0; i < num_grounds; i++) {
-            bool pass = false;
-            if (searchBox.charCount > 0) {
-                if (stristr(grounds[i].name, searchBox.text) || stristr(grounds[i].country, searchBox.text)) {
-                    pass = true;
-                }
-            } else {
-                pass = true;
-            }
-
-            if (pass) {
-                filtered_grounds[num_filtered_grounds] = grounds[i];
-                original_indices[num_filtered_grounds] = i;
-                num_filtered_grounds++;
-            }
-        }
-    }
+    const int *filtered = search_index_query(&search, searchBox.text, &num_filtered_grounds);
 
     // Draw input section
     DrawTextBold("Ground Name", nameBox.bounds.x, nameBox.bounds.y - 20, 10, ICC_GRAY);
-    DrawRectangleRec(nameBox.bounds, ICC_GRAY); DrawTextBold(nameBox.text, nameBox.bounds.x + 5, nameBox.bounds.y + 8, 20, ICC_WHITE);
+    GfxDrawRectangleRec(nameBox.bounds, ICC_GRAY); DrawTextBold(nameBox.text, nameBox.bounds.x + 5, nameBox.bounds.y + 8, 20, ICC_WHITE);
     DrawTextBold("Country", countryBox.bounds.x, countryBox.bounds.y - 20, 10, ICC_GRAY);
     const char* buttonText = (editIndex == -1) ? "Add New Ground" : "Save Changes";
     // Draw "Add" or "Save" button based on edit mode
-    DrawRectangleRec(addButton, (editIndex == -1) ? ICC_GREEN : ICC_BLUE);
-    DrawTextBold(buttonText, addButton.x + addButton.width/2 - MeasureText(buttonText, 20)/2, addButton.y + 5, 20, ICC_WHITE);
+    GfxDrawRectangleRec(addButton, (editIndex == -1) ? ICC_GREEN : ICC_BLUE);
+    DrawTextBold(buttonText, addButton.x + addButton.width/2 - text_cache_measure(buttonText, 20)/2, addButton.y + 5, 20, ICC_WHITE);
     if (editIndex != -1) {
-        DrawRectangleRec(cancelEditButton, ICC_RED);
-        DrawTextBold("Cancel", cancelEditButton.x + cancelEditButton.width/2 - MeasureText("Cancel", 15)/2, cancelEditButton.y + 5, 15, ICC_WHITE);
+        GfxDrawRectangleRec(cancelEditButton, ICC_RED);
+        DrawTextBold("Cancel", cancelEditButton.x + cancelEditButton.width/2 - text_cache_measure("Cancel", 15)/2, cancelEditButton.y + 5, 15, ICC_WHITE);
     }
 
     // Draw list of current grounds
-    DrawRectangle(20, 150, GetScreenWidth() - 40, GetScreenHeight() - 210, DARKBROWN);
+    GfxDrawRectangle(20, 150, GetScreenWidth() - 40, GetScreenHeight() - 210, DARKBROWN);
     DrawTextBold("Current Grounds", 30, 160, 20, ICC_YELLOW);
-    DrawLine(30, 185, GetScreenWidth() - 50, 185, ICC_YELLOW);
+    GfxDrawLine(30, 185, GetScreenWidth() - 50, 185, ICC_YELLOW);
     
     // Define the scrollable view area
-    Rectangle view = { 20, 188, GetScreenWidth() - 40, GetScreenHeight() - 250 }; // The visible panel
-    const float itemHeight = 25.0f;
-    const float headerHeight = 40.0f;
-    // Calculate the total height of the content
-    const float contentHeight = (num_filtered_grounds * itemHeight) + headerHeight;
-
-    // Handle mouse wheel scrolling if content is larger than view
-    if (contentHeight > view.height && CheckCollisionPointRec(GetMousePosition(), view)) {
-        scroll.y += GetMouseWheelMove() * itemHeight; // Scroll one item at a time
-        if (scroll.y > 0) scroll.y = 0; // Clamp top
-        if (scroll.y < view.height - contentHeight) scroll.y = view.height - contentHeight; // Clamp bottom
+    list.bounds = (Rectangle){ 20, 188, GetScreenWidth() - 40, GetScreenHeight() - 250 }; // The visible panel
+    list.itemHeight = 25.0f;
+    list.headerHeight = 40.0f;
+    UpdateListView(&list, num_filtered_grounds);
+    Rectangle view = list.bounds;
+
+    // Column widths restart from the headers whenever the rows change
+    static float max_name_width = 0, max_country_width = 0;
+    static int widths_for_count = -1;
+    static char widths_for_query[128] = "";
+    if (widths_for_count != num_filtered_grounds || strcmp(widths_for_query, searchBox.text) != 0) {
+        max_name_width = text_cache_measure("Name", 20);
+        max_country_width = text_cache_measure("Country", 20);
+        widths_for_count = num_filtered_grounds;
+        strcpy(widths_for_query, searchBox.text);
     }
 
     // Start clipping the drawing to the view rectangle
-    BeginScissorMode(view.x, view.y, view.width, view.height);
+    GfxBeginScissorMode(view.x, view.y, view.width, view.height);
 
     if (num_filtered_grounds > 0) {
         const float editButtonWidth = 60;
         const float deleteButtonWidth = 70;
         const float buttonHeight = 20;
-        // --- DYNAMIC COLUMN WIDTH CALCULATION ---
-        float max_name_width = MeasureText("Name", 20);
-        float max_country_width = MeasureText("Country", 20);
-
-        for (int i = 0; i < num_filtered_grounds; i++) {
-            float name_width = MeasureText(filtered_grounds[i].name, 20);
-            if (name_width > max_name_width) max_name_width = name_width;
-            float country_width = MeasureText(filtered_grounds[i].country, 20);
-            if (country_width > max_country_width) max_country_width = country_width;
+        // --- DYNAMIC COLUMN WIDTH CALCULATION (visible rows only) ---
+        for (int i = list.first; i < list.last; i++) {
+            GrowColumnWidth(&max_name_width, grounds[filtered[i]].name, 20);
+            GrowColumnWidth(&max_country_width, grounds[filtered[i]].country, 20);
         }
 
         const int padding = 25;
@@ -304,27 +376,30 @@ static void UpdateDrawGroundsScreen(GuiState *state) {
         float col2_x = col1_x + max_name_width + padding;
         float col3_x = col2_x + max_country_width + padding;
         
-        int header_y = view.y + 5 + scroll.y;
+        int header_y = ListViewRowY(&list, -1) + 5;
         DrawTextBold("Name", col1_x, header_y, 20, ICC_YELLOW);
         DrawTextBold("Country", col2_x, header_y, 20, ICC_YELLOW);
         DrawTextBold("Actions", col3_x, header_y, 20, ICC_YELLOW);
-        DrawLine(view.x + 10, header_y + 25, view.x + view.width - 20, header_y + 25, ICC_YELLOW);
+        GfxDrawLine(view.x + 10, header_y + 25, view.x + view.width - 20, header_y + 25, ICC_YELLOW);
 
-        for (int i = 0; i < num_filtered_grounds; i++) {
-            int y_pos = view.y + headerHeight + (i * itemHeight) + scroll.y;
-            int original_index = original_indices[i];
+        for (int i = list.first; i < list.last; i++) {
+            int y_pos = ListViewRowY(&list, i);
+            int original_index = filtered[i];
             Color textColor = (editIndex == original_index) ? ICC_YELLOW : ICC_WHITE;
 
-            DrawTextBold(filtered_grounds[i].name, col1_x, y_pos, 20, textColor);
-            DrawTextBold(filtered_grounds[i].country, col2_x, y_pos, 20, textColor);
+            DrawTextBold(grounds[original_index].name, col1_x, y_pos, 20, textColor);
+            DrawTextBold(grounds[original_index].country, col2_x, y_pos, 20, textColor);
 
             Rectangle editBtnRec = { col3_x, y_pos, editButtonWidth, buttonHeight };
             Rectangle deleteBtnRec = { col3_x + editButtonWidth + 5, y_pos, deleteButtonWidth, buttonHeight };
 
-            DrawRectangleRec(editBtnRec, ICC_YELLOW);
-            DrawTextBold("Edit", editBtnRec.x + editBtnRec.width/2 - MeasureText("Edit", 15)/2, editBtnRec.y + 2, 15, ICC_WHITE);
-            DrawRectangleRec(deleteBtnRec, ICC_RED);
-            DrawTextBold("Delete", deleteBtnRec.x + deleteBtnRec.width/2 - MeasureText("Delete", 15)/2, deleteBtnRec.y + 2, 15, ICC_WHITE);
+            GfxDrawRectangleRec(editBtnRec, ICC_YELLOW);
+            DrawTextBold("Edit", editBtnRec.x + editBtnRec.width/2 - text_cache_measure("Edit", 15)/2, editBtnRec.y + 2, 15, ICC_WHITE);
+            GfxDrawRectangleRec(deleteBtnRec, ICC_RED);
+            DrawTextBold("Delete", deleteBtnRec.x + deleteBtnRec.width/2 - text_cache_measure("Delete", 15)/2, deleteBtnRec.y + 2, 15, ICC_WHITE);
+
+            // Rows partly under the panel edges are drawn but must not take clicks
+            if (!CheckCollisionPointRec(GetMousePosition(), view)) continue;
 
             if (CheckCollisionPointRec(GetMousePosition(), editBtnRec) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                 editIndex = original_index;
@@ -340,6 +415,7 @@ static void UpdateDrawGroundsScreen(GuiState *state) {
                 if (num_grounds > 0) grounds = realloc(grounds, num_grounds * sizeof(Ground)); else { free(grounds); grounds = NULL; }
                 save_grounds(grounds, num_grounds);
                 needs_refresh = true;
+                widths_for_count = -1;
                 break;
             }
         }
@@ -347,53 +423,119 @@ static void UpdateDrawGroundsScreen(GuiState *state) {
         DrawTextBold("No grounds found in Data/grounds.dat.", view.x + 20, view.y + 10, 20, ICC_GRAY);
     }
 
-    EndScissorMode();
-
-    if (contentHeight > view.height) {
-        Rectangle scrollBarArea = { view.x + view.width - 12, view.y, 10, view.height };
-        DrawRectangleRec(scrollBarArea, ICC_GRAY);
-        
-        float scrollBarHeight = (view.height / contentHeight) * view.height;
-        float scrollBarY = view.y + (-scroll.y / (contentHeight - view.height)) * (view.height - scrollBarHeight);
-        Rectangle scrollHandle = { scrollBarArea.x, scrollBarY, 10, scrollBarHeight };
-        DrawRectangleRec(scrollHandle, ICC_GRAY);
-    }
+    GfxEndScissorMode();
 
-    if (filtered_grounds) free(filtered_grounds);
-    if (original_indices) free(original_indices);
+    DrawListViewScrollbar(&list, num_filtered_grounds);
 
-    DrawRectangleRec(backButton, ICC_GRAY);
-    DrawTextBold("Back to Menu", backButton.x + backButton.width/2 - MeasureText("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(backButton, ICC_GRAY);
+    DrawTextBold("Back to Menu", backButton.x + backButton.width/2 - text_cache_measure("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
 
-    EndDrawing();
+    GfxEndDrawing();
 }
 
 
 
 
-int main(void)
+// Runs one frame of whichever screen is active
+static void UpdateDrawCurrentScreen(GuiState *state, GameState *gameState, GameSounds *sounds) {
+    switch(state->currentScreen) {
+        case SCREEN_LOGIN:
+            UpdateDrawLoginScreen(state);
+            break;
+        case SCREEN_REGISTER:
+            UpdateDrawRegisterScreen(state);
+            break;
+        case SCREEN_MAIN_MENU:
+            UpdateDrawMainMenuScreen(state, gameState);
+            break;
+        case SCREEN_ADMIN_MENU:
+            UpdateDrawAdminMenuScreen(state);
+            break;
+        case SCREEN_GAMEPLAY:
+            // We pass the gameState to the gameplay screen to be updated
+            UpdateDrawGameplayScreen(state, gameState, sounds);
+            break;
+        case SCREEN_TEAMS:
+            UpdateDrawTeamsScreen(state);
+            break;
+        case SCREEN_UMPIRES:
+            UpdateDrawUmpiresScreen(state);
+            break;
+        case SCREEN_HISTORY:
+            UpdateDrawPlaceholderScreen(state, "Match History");
+            break;
+        case SCREEN_GROUNDS:
+            UpdateDrawGroundsScreen(state);
+            break;
+        case SCREEN_PLACEHOLDER:
+            UpdateDrawPlaceholderScreen(state, "Coming Soon...");
+            break;
+        case SCREEN_MANAGE_USERS:
+            UpdateDrawManageUsersScreen(state);
+            break;
+        case SCREEN_MATCH_SETUP:
+            UpdateDrawMatchSetupScreen(state);
+            break;
+        case SCREEN_WC_SETUP:
+            UpdateDrawWcSetupScreen(state, gameState, sounds);
+            break;
+        case SCREEN_SPECTATE:
+            UpdateDrawSpectatorScreen(state, sounds);
+            break;
+        case SCREEN_RANKINGS:
+            UpdateDrawRankingsScreen(state);
+            break;
+        default:
+            break;
+    }
+}
+
+// Splits "address[:port]"
+static void ParseSpectateAddress(const char *arg, char *address, size_t size, int *port) {
+    snprintf(address, size, "%s", arg);
+    char *colon = strrchr(address, ':');
+    *port = SPECTATOR_DEFAULT_PORT;
+    if (colon) {
+        *port = atoi(colon + 1);
+        *colon = '\0';
+    }
+}
+
+// gui.exe                          play
+// gui.exe --host [port]            play, and let spectators watch the gameplay screen
+// gui.exe --spectate address[:port]  watch a match hosted on another machine
+int main(int argc, char **argv)
 {
+    int hostPort = 0;
+    char spectateAddress[128] = "";
+    int spectatePort = SPECTATOR_DEFAULT_PORT;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--host") == 0) {
+            hostPort = (i + 1 < argc && atoi(argv[i + 1]) > 0) ? atoi(argv[++i]) : SPECTATOR_DEFAULT_PORT;
+        } else if (strcmp(argv[i], "--spectate") == 0 && i + 1 < argc) {
+            ParseSpectateAddress(argv[++i], spectateAddress, sizeof(spectateAddress), &spectatePort);
+        }
+    }
+
     // Set a default window size and allow resizing
     const int screenWidth = 1280;
     const int screenHeight = 720;
     SetConfigFlags(FLAG_WINDOW_RESIZABLE);
 
     InitWindow(screenWidth, screenHeight, "CricSim");
+    gfx_set_backend(&gfx_raylib_backend);
+    flag_atlas_start_loading("assets/flags"); // Packs the flags in the background while the rest starts up
     InitAudioDevice();
-    InitializeAudience(); // Initial setup of audience positions
-
-    // Load all game sounds
-    GameSounds sounds = {
-        .bowling = LoadSound("audio/bowling.mp3"),
-        .dot_ball = LoadSound("audio/dotball.mp3"),
-        .edge = LoadSound("audio/edge.mp3"),
-        .firecrackers = LoadSound("audio/firecrackers.mp3"),
-        .four = LoadSound("audio/four_and_singles.mp3"),
-        .single = LoadSound("audio/single_yes_call.mp3"),
-        .six = LoadSound("audio/six.mp3"),
-        .toss = LoadSound("audio/toss.mp3"),
-        .bowled_wicket = LoadSound("audio/bowled_wicket.mp3")
-    };
+    InitializeAudience(); // Seats the crowd once, resizes only rescale it
+    SetTargetFPS(60);
+    lod_init(60);
+    field_coverage_init(); // Fielder lookup grids for every setup and batting hand
+
+    // Decode sounds and read rosters on the worker pool while a progress bar is drawn
+    GameSounds sounds = { 0 };
+    workerPool = job_queue_create(0);
+    liveFeed = live_feed_open();
+    RunStartupPipeline(&sounds);
     
     // Match Game State Initialization
     GameState gameState = { 0 };
@@ -416,58 +558,30 @@ int main(void)
 
     create_saves_directory(); // Ensure the saves directory exists
 
-    SetTargetFPS(60);
+    if (hostPort > 0) {
+        spectatorHost = spectator_host_start(hostPort);
+        if (!spectatorHost) fprintf(stderr, "Error: could not host spectators on port %d\n", hostPort);
+    }
+    if (spectateAddress[0]) {
+        spectatorViewer = spectator_viewer_create(spectateAddress, spectatePort);
+        guiState.currentScreen = SCREEN_SPECTATE; // Display machines need no login
+    }
 
     // Main game loop
         while (!WindowShouldClose()) {
-            if (IsWindowResized()) {
-                InitializeAudience();
+            flag_atlas_update(); // Uploads the flag atlas as soon as the loader finishes
+            audio_clip_update(&sounds.firecrackers); // Refill streamed clips
+            audio_clip_update(&sounds.toss);
+            lod_update(GetFrameTime()); // Drops or restores detail to stay inside the frame budget
+            figure_batch_set_detail(lod_settings()->figure_detail);
+            if (sim_service_update(GetTime())) { // Paces the other fixtures' ticker
+                fixtureResultsChanged = true;
+                ratings_save(GameRatings(), RATINGS_FILE);
             }
-    
-        switch(guiState.currentScreen) {
-            case SCREEN_LOGIN:
-                UpdateDrawLoginScreen(&guiState);
-                break;
-            case SCREEN_REGISTER:
-                UpdateDrawRegisterScreen(&guiState);
-                break;
-            case SCREEN_MAIN_MENU:
-                UpdateDrawMainMenuScreen(&guiState, &gameState);
-                break;
-            case SCREEN_ADMIN_MENU:
-                UpdateDrawAdminMenuScreen(&guiState);
-                break;
-            case SCREEN_GAMEPLAY:
-                // We pass the gameState to the gameplay screen to be updated
-                UpdateDrawGameplayScreen(&guiState, &gameState, &sounds);
-                break;
-            case SCREEN_TEAMS:
-                UpdateDrawTeamsScreen(&guiState);
-                break;
-            case SCREEN_UMPIRES:
-                UpdateDrawUmpiresScreen(&guiState);
-                break;
-            case SCREEN_HISTORY:
-                UpdateDrawPlaceholderScreen(&guiState, "Match History");
-                break;
-            case SCREEN_GROUNDS:
-                UpdateDrawGroundsScreen(&guiState);
-                break;
-            case SCREEN_PLACEHOLDER:
-                UpdateDrawPlaceholderScreen(&guiState, "Coming Soon...");
-                break;
-            case SCREEN_MANAGE_USERS:
-                UpdateDrawManageUsersScreen(&guiState);
-                break;
-            case SCREEN_MATCH_SETUP:
-                UpdateDrawMatchSetupScreen(&guiState);
-                break;
-            case SCREEN_WC_SETUP:
-                UpdateDrawWcSetupScreen(&guiState, &gameState, &sounds);
-                break;
-            default:
-                break;
-        }
+            UpdateRatingsRebuild();
+            spectator_host_poll(spectatorHost); // Late joiners get their snapshot on any screen
+
+        UpdateDrawCurrentScreen(&guiState, &gameState, &sounds);
     }
 
     if (guiState.currentScreen == SCREEN_GAMEPLAY) {
@@ -475,15 +589,26 @@ int main(void)
     }
 
     // Unload all sounds
-    UnloadSound(sounds.bowling);
-    UnloadSound(sounds.dot_ball);
-    UnloadSound(sounds.edge);
-    UnloadSound(sounds.firecrackers);
-    UnloadSound(sounds.four);
-    UnloadSound(sounds.single);
-    UnloadSound(sounds.six);
-    UnloadSound(sounds.toss);
-    UnloadSound(sounds.bowled_wicket);
+    audio_clip_unload(&sounds.bowling);
+    audio_clip_unload(&sounds.dot_ball);
+    audio_clip_unload(&sounds.edge);
+    audio_clip_unload(&sounds.firecrackers);
+    audio_clip_unload(&sounds.four);
+    audio_clip_unload(&sounds.single);
+    audio_clip_unload(&sounds.six);
+    audio_clip_unload(&sounds.toss);
+    audio_clip_unload(&sounds.bowled_wicket);
+    flag_atlas_unload();
+    gfx_shutdown();
+    qualification_stop();
+    sim_service_stop();
+    job_queue_destroy(workerPool);
+    live_feed_close(liveFeed);
+    if (ratingsRebuildRunning) ratings_free(&ratingsRebuild.ratings);
+    if (gameRatingsLoaded) ratings_free(&gameRatings);
+    spectator_host_stop(spectatorHost);
+    spectator_viewer_destroy(spectatorViewer);
+    if (preloadedTeams) free(preloadedTeams);
 
     CloseAudioDevice();
     CloseWindow();
@@ -491,6 +616,135 @@ int main(void)
     return 0;
 }
 
+// Runs on a worker: maps the decoded samples from the audio cache (decoding only on a miss),
+// the clip itself must be created on the main thread
+static void DecodeSoundJob(void *arg) {
+    SoundLoadJob *job = (SoundLoadJob*)arg;
+    audio_cache_load(&job->wave, job->path);
+}
+
+static void PreloadTeamsJob(void *arg) {
+    (void)arg;
+    preloadedTeams = load_teams(&preloadedNumTeams);
+}
+
+// First caller gets the rosters read at startup, later callers read the file again
+static Team* LoadTeamsPreloaded(int *num_teams) {
+    if (preloadedTeams) {
+        Team *teams = preloadedTeams;
+        *num_teams = preloadedNumTeams;
+        preloadedTeams = NULL;
+        return teams;
+    }
+    return load_teams(num_teams);
+}
+
+static void RebuildRatingsJob(void *arg) {
+    RatingsRebuild *rebuild = (RatingsRebuild*)arg;
+    int num_teams = 0;
+    Team *teams = load_teams(&num_teams);
+    rebuild->replayed = ratings_rebuild_from_logs(&rebuild->ratings, "Data", teams, num_teams, &rebuild->progress);
+    free(teams);
+    __atomic_store_n(&rebuild->finished, true, __ATOMIC_RELEASE);
+}
+
+static void StartRatingsRebuild(void) {
+    if (ratingsRebuildRunning) return;
+    GameRatings(); // Its first ratings_init fills the shared expectation table, here rather than on the worker
+    memset(&ratingsRebuild, 0, sizeof(ratingsRebuild));
+    ratings_init(&ratingsRebuild.ratings);
+    ratingsRebuildRunning = true;
+    ratingsRebuildStatus[0] = '\0';
+    job_queue_push(workerPool, RebuildRatingsJob, &ratingsRebuild);
+}
+
+// Swaps a finished rebuild in for gameRatings. Matches rated while it ran are dropped with the
+// old copy, as a rebuild starts again from the logs.
+static void UpdateRatingsRebuild(void) {
+    if (!ratingsRebuildRunning || !__atomic_load_n(&ratingsRebuild.finished, __ATOMIC_ACQUIRE)) return;
+    ratingsRebuildRunning = false;
+    ratings_free(GameRatings());
+    gameRatings = ratingsRebuild.ratings;
+    gameRatingsGeneration++; // Every id was handed out again
+    if (ratings_save(&gameRatings, RATINGS_FILE)) snprintf(ratingsRebuildStatus, sizeof(ratingsRebuildStatus), "Rebuilt from %d match logs", ratingsRebuild.replayed);
+    else snprintf(ratingsRebuildStatus, sizeof(ratingsRebuildStatus), "Could not write %s", RATINGS_FILE);
+}
+
+static void DrawStartupProgress(float progress) {
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
+    DrawTextBold("CricSim", GetScreenWidth()/2 - text_cache_measure("CricSim", 60)/2, GetScreenHeight()/2 - 110, 60, ICC_YELLOW);
+
+    Rectangle bar = { GetScreenWidth()/2 - 250, GetScreenHeight()/2, 500, 24 };
+    GfxDrawRectangleRec(bar, ICC_GRAY);
+    GfxDrawRectangle(bar.x, bar.y, bar.width * progress, bar.height, ICC_GREEN);
+    GfxDrawRectangleLinesEx(bar, 2, ICC_WHITE);
+    const char *label = TextFormat("Loading... %d%%", (int)(progress * 100));
+    GfxDrawText(label, GetScreenWidth()/2 - text_cache_measure(label, 20)/2, bar.y + 40, 20, ICC_WHITE);
+    GfxEndDrawing();
+}
+
+// Decodes every sound and reads the rosters on the worker pool while the flag atlas
+// builds on its own thread. The main thread keeps drawing a progress bar and only does
+// the parts that need the audio device or GL context once the workers are done.
+static void RunStartupPipeline(GameSounds *sounds) {
+    static SoundLoadJob jobs[NUM_GAME_SOUNDS];
+    const struct { const char *path; AudioClip *target; } soundFiles[NUM_GAME_SOUNDS] = {
+        { "audio/bowling.mp3", &sounds->bowling },
+        { "audio/dotball.mp3", &sounds->dot_ball },
+        { "audio/edge.mp3", &sounds->edge },
+        { "audio/firecrackers.mp3", &sounds->firecrackers },
+        { "audio/four_and_singles.mp3", &sounds->four },
+        { "audio/single_yes_call.mp3", &sounds->single },
+        { "audio/six.mp3", &sounds->six },
+        { "audio/toss.mp3", &sounds->toss },
+        { "audio/bowled_wicket.mp3", &sounds->bowled_wicket }
+    };
+
+    // Largest files first so the longest decodes start right away
+    int sizes[NUM_GAME_SOUNDS];
+    for (int i = 0; i < NUM_GAME_SOUNDS; i++) {
+        jobs[i] = (SoundLoadJob){ .path = soundFiles[i].path, .target = soundFiles[i].target };
+        sizes[i] = GetFileLength(jobs[i].path);
+    }
+    for (int i = 1; i < NUM_GAME_SOUNDS; i++) {
+        SoundLoadJob job = jobs[i];
+        int size = sizes[i];
+        int j = i - 1;
+        while (j >= 0 && sizes[j] < size) {
+            jobs[j + 1] = jobs[j];
+            sizes[j + 1] = sizes[j];
+            j--;
+        }
+        jobs[j + 1] = job;
+        sizes[j + 1] = size;
+    }
+
+    for (int i = 0; i < NUM_GAME_SOUNDS; i++) {
+        job_queue_push(workerPool, DecodeSoundJob, &jobs[i]);
+    }
+    job_queue_push(workerPool, PreloadTeamsJob, NULL);
+    const int totalSteps = NUM_GAME_SOUNDS + 1 + 1; // Sounds, rosters, flag atlas
+
+    for (;;) {
+        flag_atlas_update();
+        int remaining = job_queue_pending(workerPool) + (flag_atlas_is_loading() ? 1 : 0);
+        if (remaining == 0) break;
+        if (WindowShouldClose()) {
+            // Closing early still lets the workers and the atlas loader finish cleanly
+            job_queue_wait(workerPool);
+            flag_atlas_finish();
+            break;
+        }
+        DrawStartupProgress((float)(totalSteps - remaining) / totalSteps);
+    }
+
+    // Finalize on the main thread: hand the decoded samples to the audio device
+    for (int i = 0; i < NUM_GAME_SOUNDS; i++) {
+        *jobs[i].target = audio_clip_create(&jobs[i].wave, streamLongClips);
+    }
+}
+
 // Helper function to change screens and track history
 static void ChangeScreen(GuiState *state, GameScreen newScreen) {
     state->previousScreen = state->currentScreen;
@@ -546,40 +800,40 @@ static void UpdateDrawLoginScreen(GuiState *state) {
         errorMessage = NULL;
     }
 
-    BeginDrawing();
-    ClearBackground(ICC_BG);
-    DrawText("Cricket Game Login", GetScreenWidth()/2 - MeasureText("Cricket Game Login", 50)/2, GetScreenHeight()/2 - 220, 50, ICC_GRAY);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
+    GfxDrawText("Cricket Game Login", GetScreenWidth()/2 - text_cache_measure("Cricket Game Login", 50)/2, GetScreenHeight()/2 - 220, 50, ICC_GRAY);
 
-    DrawText("Email:", emailBox.bounds.x, emailBox.bounds.y - 20, 20, ICC_GRAY);
-    DrawRectangleRec(emailBox.bounds, ICC_GRAY);
-    if (emailBox.active) DrawRectangleLinesEx(emailBox.bounds, 2, ICC_BLUE);
-    DrawText(emailBox.text, emailBox.bounds.x + 5, emailBox.bounds.y + 10, 20, ICC_WHITE);
+    GfxDrawText("Email:", emailBox.bounds.x, emailBox.bounds.y - 20, 20, ICC_GRAY);
+    GfxDrawRectangleRec(emailBox.bounds, ICC_GRAY);
+    if (emailBox.active) GfxDrawRectangleLinesEx(emailBox.bounds, 2, ICC_BLUE);
+    GfxDrawText(emailBox.text, emailBox.bounds.x + 5, emailBox.bounds.y + 10, 20, ICC_WHITE);
 
-    DrawText("Password:", passwordBox.bounds.x, passwordBox.bounds.y - 20, 20, ICC_GRAY);
-    DrawRectangleRec(passwordBox.bounds, ICC_GRAY);
-    if (passwordBox.active) DrawRectangleLinesEx(passwordBox.bounds, 2, ICC_BLUE);
+    GfxDrawText("Password:", passwordBox.bounds.x, passwordBox.bounds.y - 20, 20, ICC_GRAY);
+    GfxDrawRectangleRec(passwordBox.bounds, ICC_GRAY);
+    if (passwordBox.active) GfxDrawRectangleLinesEx(passwordBox.bounds, 2, ICC_BLUE);
     // Draw password as asterisks
     char passwordDisplay[128] = {0};
     for(int i = 0; i < passwordBox.charCount; ++i) strcat(passwordDisplay, "*");
-    DrawText(passwordDisplay, passwordBox.bounds.x + 5, passwordBox.bounds.y + 10, 20, ICC_WHITE);
+    GfxDrawText(passwordDisplay, passwordBox.bounds.x + 5, passwordBox.bounds.y + 10, 20, ICC_WHITE);
 
     // Draw Login Button with state-dependent text
     if (isLoggingIn) {
-        DrawRectangleRec(loginButton, ICC_GRAY);
-        DrawText("Logging in...", loginButton.x + loginButton.width/2 - MeasureText("Logging in...", 20)/2, loginButton.y + 10, 20, ICC_WHITE);
+        GfxDrawRectangleRec(loginButton, ICC_GRAY);
+        GfxDrawText("Logging in...", loginButton.x + loginButton.width/2 - text_cache_measure("Logging in...", 20)/2, loginButton.y + 10, 20, ICC_WHITE);
     } else {
-        DrawRectangleRec(loginButton, ICC_BLUE);
-        DrawText("Login", loginButton.x + loginButton.width/2 - MeasureText("Login", 20)/2, loginButton.y + 10, 20, ICC_WHITE);
+        GfxDrawRectangleRec(loginButton, ICC_BLUE);
+        GfxDrawText("Login", loginButton.x + loginButton.width/2 - text_cache_measure("Login", 20)/2, loginButton.y + 10, 20, ICC_WHITE);
     }
 
-    DrawRectangleRec(registerButton, ICC_GRAY);
-    DrawText("Register New User", registerButton.x + registerButton.width/2 - MeasureText("Register New User", 20)/2, registerButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(registerButton, ICC_GRAY);
+    GfxDrawText("Register New User", registerButton.x + registerButton.width/2 - text_cache_measure("Register New User", 20)/2, registerButton.y + 10, 20, ICC_WHITE);
 
     if (errorMessage) {
-        DrawText(errorMessage, GetScreenWidth()/2 - MeasureText(errorMessage, 20)/2, GetScreenHeight()/2 + 180, 20, ICC_RED);
+        GfxDrawText(errorMessage, GetScreenWidth()/2 - text_cache_measure(errorMessage, 20)/2, GetScreenHeight()/2 + 180, 20, ICC_RED);
     }
 
-    EndDrawing();
+    GfxEndDrawing();
 }
 
 static void UpdateDrawRegisterScreen(GuiState *state) {
@@ -590,13 +844,13 @@ static void UpdateDrawRegisterScreen(GuiState *state) {
         ChangeScreen(state, state->previousScreen); // Go back to the previous screen
     }
 
-    BeginDrawing();
-    ClearBackground(ICC_BG);
-    DrawText("Registration", GetScreenWidth()/2 - MeasureText("Registration", 50)/2, GetScreenHeight()/2 - 100, 50, ICC_GRAY);
-    DrawText("Registration UI not yet implemented.", GetScreenWidth()/2 - MeasureText("Registration UI not yet implemented.", 20)/2, GetScreenHeight()/2 - 20, 20, ICC_GRAY);
-    DrawRectangleRec(backButton, ICC_GRAY);
-    DrawText("Back to Login", backButton.x + backButton.width/2 - MeasureText("Back to Login", 20)/2, backButton.y + 10, 20, ICC_WHITE);
-    EndDrawing();
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
+    GfxDrawText("Registration", GetScreenWidth()/2 - text_cache_measure("Registration", 50)/2, GetScreenHeight()/2 - 100, 50, ICC_GRAY);
+    GfxDrawText("Registration UI not yet implemented.", GetScreenWidth()/2 - text_cache_measure("Registration UI not yet implemented.", 20)/2, GetScreenHeight()/2 - 20, 20, ICC_GRAY);
+    GfxDrawRectangleRec(backButton, ICC_GRAY);
+    GfxDrawText("Back to Login", backButton.x + backButton.width/2 - text_cache_measure("Back to Login", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxEndDrawing();
 }
 
 static void UpdateDrawAdminMenuScreen(GuiState *state) {
@@ -627,26 +881,26 @@ static void UpdateDrawAdminMenuScreen(GuiState *state) {
         ChangeScreen(state, SCREEN_LOGIN);
     }
 
-    BeginDrawing();
-    ClearBackground(ICC_BG);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
     char title[128];
     sprintf(title, "Admin Menu: %s", state->userName);
-    DrawText(title, screenWidth/2 - MeasureText(title, 50)/2, GetScreenHeight()/2 - 200, 50, ICC_GRAY);
+    GfxDrawText(title, screenWidth/2 - text_cache_measure(title, 50)/2, GetScreenHeight()/2 - 200, 50, ICC_GRAY);
 
-    DrawRectangleRec(mainMenuButton, ICC_GRAY);
-    DrawText("Main Admin Menu", mainMenuButton.x + mainMenuButton.width/2 - MeasureText("Main Admin Menu", 20)/2, mainMenuButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(mainMenuButton, ICC_GRAY);
+    GfxDrawText("Main Admin Menu", mainMenuButton.x + mainMenuButton.width/2 - text_cache_measure("Main Admin Menu", 20)/2, mainMenuButton.y + 15, 20, ICC_WHITE);
 
     if (isSuper) {
-        DrawRectangleRec(manageUsersButton, ICC_BLUE);
-        DrawText("Manage Users & Admins", manageUsersButton.x + manageUsersButton.width/2 - MeasureText("Manage Users & Admins", 20)/2, manageUsersButton.y + 15, 20, ICC_WHITE);
+        GfxDrawRectangleRec(manageUsersButton, ICC_BLUE);
+        GfxDrawText("Manage Users & Admins", manageUsersButton.x + manageUsersButton.width/2 - text_cache_measure("Manage Users & Admins", 20)/2, manageUsersButton.y + 15, 20, ICC_WHITE);
     }
 
-    DrawRectangleRec(teamsButton, ICC_BLUE);
-    DrawText("Team & Player Management", teamsButton.x + teamsButton.width/2 - MeasureText("Team & Player Management", 20)/2, teamsButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(teamsButton, ICC_BLUE);
+    GfxDrawText("Team & Player Management", teamsButton.x + teamsButton.width/2 - text_cache_measure("Team & Player Management", 20)/2, teamsButton.y + 15, 20, ICC_WHITE);
 
-    DrawRectangleRec(logoutButton, ICC_RED);
-    DrawText("Logout", logoutButton.x + logoutButton.width/2 - MeasureText("Logout", 20)/2, logoutButton.y + 15, 20, ICC_WHITE);
-    EndDrawing();
+    GfxDrawRectangleRec(logoutButton, ICC_RED);
+    GfxDrawText("Logout", logoutButton.x + logoutButton.width/2 - text_cache_measure("Logout", 20)/2, logoutButton.y + 15, 20, ICC_WHITE);
+    GfxEndDrawing();
 }
 
 static void UpdateDrawMainMenuScreen(GuiState *state, GameState *gameState) {
@@ -656,7 +910,8 @@ static void UpdateDrawMainMenuScreen(GuiState *state, GameState *gameState) {
     const Rectangle teamsButton = { screenWidth/2 - 200, GetScreenHeight()/2 - 110, 400, 60 };
     const Rectangle umpiresButton = { screenWidth/2 - 200, GetScreenHeight()/2 - 40, 400, 60 };
     const Rectangle groundsButton = { screenWidth/2 - 200, GetScreenHeight()/2 + 30, 400, 60 };
-    const Rectangle historyButton = { screenWidth/2 - 200, GetScreenHeight()/2 + 100, 400, 60 };
+    const Rectangle historyButton = { screenWidth/2 - 200, GetScreenHeight()/2 + 100, 195, 60 };
+    const Rectangle rankingsButton = { screenWidth/2 + 5, GetScreenHeight()/2 + 100, 195, 60 };
     const Rectangle logoutButton = { screenWidth/2 - 200, GetScreenHeight()/2 + 170, 400, 60 };
 
     Vector2 mousePoint = GetMousePosition();
@@ -664,6 +919,8 @@ static void UpdateDrawMainMenuScreen(GuiState *state, GameState *gameState) {
 
     if (saveFileExists && CheckCollisionPointRec(mousePoint, resumeGameButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         if (load_game_state(gameState, "Data/saves/resume.dat")) {
+            gameState->ratings = NULL; // Bound again with the engine
+            sim_engine_init(&matchEngine, gameState, (uint32_t)GetRandomValue(1, 0x7FFFFFFF), 0);
             ChangeScreen(state, SCREEN_GAMEPLAY);
         }
     }
@@ -682,78 +939,56 @@ static void UpdateDrawMainMenuScreen(GuiState *state, GameState *gameState) {
     if (CheckCollisionPointRec(mousePoint, historyButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         ChangeScreen(state, SCREEN_HISTORY);
     }
+    if (CheckCollisionPointRec(mousePoint, rankingsButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        ChangeScreen(state, SCREEN_RANKINGS);
+    }
     if (CheckCollisionPointRec(mousePoint, logoutButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         state->userType = USER_TYPE_NONE;
         ChangeScreen(state, SCREEN_LOGIN);
     }
 
 
-    BeginDrawing();
-    ClearBackground(ICC_BG);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
     char title[128];
     sprintf(title, "Main Menu: %s", state->userName);
-    DrawText(title, screenWidth/2 - MeasureText(title, 50)/2, GetScreenHeight()/2 - 320, 50, ICC_GRAY);
+    GfxDrawText(title, screenWidth/2 - text_cache_measure(title, 50)/2, GetScreenHeight()/2 - 320, 50, ICC_GRAY);
 
     if (saveFileExists) {
-        DrawRectangleRec(resumeGameButton, ICC_GRAY);
-        DrawText("Resume Game", resumeGameButton.x + resumeGameButton.width/2 - MeasureText("Resume Game", 20)/2, resumeGameButton.y + 15, 20, ICC_WHITE);
+        GfxDrawRectangleRec(resumeGameButton, ICC_GRAY);
+        GfxDrawText("Resume Game", resumeGameButton.x + resumeGameButton.width/2 - text_cache_measure("Resume Game", 20)/2, resumeGameButton.y + 15, 20, ICC_WHITE);
     }
 
-    DrawRectangleRec(playButton, ICC_GRAY);
-    DrawText("Play Match", playButton.x + playButton.width/2 - MeasureText("Play Match", 20)/2, playButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(playButton, ICC_GRAY);
+    GfxDrawText("Play Match", playButton.x + playButton.width/2 - text_cache_measure("Play Match", 20)/2, playButton.y + 15, 20, ICC_WHITE);
 
-    DrawRectangleRec(teamsButton, ICC_GRAY);
-    DrawText("Teams & Players", teamsButton.x + teamsButton.width/2 - MeasureText("Teams & Players", 20)/2, teamsButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(teamsButton, ICC_GRAY);
+    GfxDrawText("Teams & Players", teamsButton.x + teamsButton.width/2 - text_cache_measure("Teams & Players", 20)/2, teamsButton.y + 15, 20, ICC_WHITE);
 
-    DrawRectangleRec(umpiresButton, ICC_GRAY);
-    DrawText("Add/View Umpires", umpiresButton.x + umpiresButton.width/2 - MeasureText("Add/View Umpires", 20)/2, umpiresButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(umpiresButton, ICC_GRAY);
+    GfxDrawText("Add/View Umpires", umpiresButton.x + umpiresButton.width/2 - text_cache_measure("Add/View Umpires", 20)/2, umpiresButton.y + 15, 20, ICC_WHITE);
 
-    DrawRectangleRec(groundsButton, ICC_GRAY);
-    DrawText("Add/View Grounds", groundsButton.x + groundsButton.width/2 - MeasureText("Add/View Grounds", 20)/2, groundsButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(groundsButton, ICC_GRAY);
+    GfxDrawText("Add/View Grounds", groundsButton.x + groundsButton.width/2 - text_cache_measure("Add/View Grounds", 20)/2, groundsButton.y + 15, 20, ICC_WHITE);
 
-    DrawRectangleRec(historyButton, ICC_GRAY);
-    DrawText("View History", historyButton.x + historyButton.width/2 - MeasureText("View History", 20)/2, historyButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(historyButton, ICC_GRAY);
+    GfxDrawText("View History", historyButton.x + historyButton.width/2 - text_cache_measure("View History", 20)/2, historyButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(rankingsButton, ICC_GRAY);
+    GfxDrawText("Rankings", rankingsButton.x + rankingsButton.width/2 - text_cache_measure("Rankings", 20)/2, rankingsButton.y + 15, 20, ICC_WHITE);
 
-    DrawRectangleRec(logoutButton, ICC_RED);
-    DrawText("Logout", logoutButton.x + logoutButton.width/2 - MeasureText("Logout", 20)/2, logoutButton.y + 15, 20, ICC_WHITE);
+    GfxDrawRectangleRec(logoutButton, ICC_RED);
+    GfxDrawText("Logout", logoutButton.x + logoutButton.width/2 - text_cache_measure("Logout", 20)/2, logoutButton.y + 15, 20, ICC_WHITE);
 
-    EndDrawing();
+    GfxEndDrawing();
 }
 
-static void DrawPlayerFigure(Vector2 position, Color color, bool is_striker, const char* team_name, bool is_swinging) {
-    const float scale = 1.2f; // Adjust this to change player size
-    const float head_radius = 6.0f * scale;
-    const float body_height = 15.0f * scale;
-    const float body_width = 12.0f * scale;
-    const float limb_length = 10.0f * scale;
-    const float limb_thick = 2.0f * scale;
-
-    // Draw team name behind the player
+// Queues a player figure for this frame's figure batch, with the team name above it.
+// Nothing is drawn until figure_batch_flush().
+static void QueuePlayerFigure(Vector2 position, Color color, FigurePose pose, const char* team_name) {
+    const float head_radius = 6.0f * 1.2f;
+    figure_batch_add(position, color, pose);
     if (team_name) {
-        DrawText(team_name, position.x - MeasureText(team_name, 10)/2, position.y - head_radius - 15, 10, ICC_GRAY);
-    }
-
-    // Body
-    Rectangle body = { position.x - body_width/2, position.y, body_width, body_height };
-    DrawRectangleRec(body, color);
-
-    // Head
-    DrawCircle(position.x, position.y - head_radius, head_radius, color);
-
-    if (is_striker) { // Batsman
-        // Draw bat based on stance
-        if (is_swinging) {
-            DrawLineEx((Vector2){position.x, position.y + 5}, (Vector2){position.x - limb_length, position.y + 10}, limb_thick, color); // Swinging Bat
-        } else {
-            DrawLineEx((Vector2){position.x, position.y + 5}, (Vector2){position.x + limb_length, position.y + 5}, limb_thick, color); // Batting Stance
-        }
-        DrawLineEx((Vector2){position.x, position.y + body_height}, (Vector2){position.x - limb_length/2, position.y + body_height + limb_length}, limb_thick, color); // Left leg
-        DrawLineEx((Vector2){position.x + limb_length/4, position.y + body_height}, (Vector2){position.x + limb_length, position.y + body_height + limb_length}, limb_thick, color); // Right leg
-    } else { // Fielding/Bowling Stance
-        DrawLineEx((Vector2){position.x - body_width/2, position.y}, (Vector2){position.x - body_width, position.y + limb_length}, limb_thick, color); // Left arm
-        DrawLineEx((Vector2){position.x + body_width/2, position.y}, (Vector2){position.x + body_width, position.y + limb_length}, limb_thick, color); // Right arm
-        DrawLineEx((Vector2){position.x, position.y + body_height}, (Vector2){position.x - limb_length/2, position.y + body_height + limb_length}, limb_thick, color); // Left leg
-        DrawLineEx((Vector2){position.x, position.y + body_height}, (Vector2){position.x + limb_length/2, position.y + body_height + limb_length}, limb_thick, color); // Right leg
+        figure_batch_label(team_name, position.x, position.y - head_radius - 15, 10, ICC_GRAY);
     }
 }
 
@@ -811,123 +1046,198 @@ static void DrawFielders(const Vector2 *fielder_positions, GameState *gameState,
             }
         }
 
-        DrawPlayerFigure(fielderScreenPos, fielderColor, false, NULL, false);
+        QueuePlayerFigure(fielderScreenPos, fielderColor, FIGURE_POSE_FIELDING, NULL);
     }
     // Draw the wicket-keeper behind the stumps (fixed position, assuming striker at right end of pitch)
     Vector2 keeperScreenPos = { fieldCenter.x + 250, fieldCenter.y };
     if (keeper_player_list_idx != -1 && keeper_player_list_idx < gameState->bowling_team->num_players) {
-        DrawPlayerFigure(keeperScreenPos, ICC_YELLOW, false, gameState->bowling_team->players[keeper_player_list_idx].name, false);
+        QueuePlayerFigure(keeperScreenPos, ICC_YELLOW, FIGURE_POSE_FIELDING, gameState->bowling_team->players[keeper_player_list_idx].name);
     }
 }
 
-// Structure to hold a single audience member's data
+#define AUDIENCE_SIZE 1500
+#define AUDIENCE_SEED 0x5EEDC0DEu
+
+// Structure to hold a single audience member's data.
+// Seats are stored in normalized polar form (unit direction from the field centre and a
+// 0..1 depth into the stands), so the crowd never has to be re-rolled for a new screen size.
 typedef struct {
-    Vector2 position;
+    Vector2 direction;
+    float depth;
     Color baseColor;
 } AudienceMember;
 
-static AudienceMember audience[1500];
+static AudienceMember audience[AUDIENCE_SIZE];
+
+// Screen positions, rebuilt only when the stands move or change size
+static Vector2 audiencePositions[AUDIENCE_SIZE];
+static Vector2 audienceLayoutCenter = { -1, -1 };
+static float audienceLayoutInner = -1, audienceLayoutOuter = -1;
+
+// Seats every spectator. Uses its own fixed-seed generator so the crowd looks the same on
+// every run and the game's rand() sequence is left alone.
+static void InitializeAudience(void) {
+    unsigned int state = AUDIENCE_SEED;
+    for (int i = 0; i < AUDIENCE_SIZE; i++) {
+        // xorshift32
+        state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+        float angle = (state / 4294967296.0f) * 2.0f * PI;
+        state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+        audience[i].depth = state / 4294967296.0f;
+        audience[i].direction = (Vector2){ cosf(angle), sinf(angle) };
 
+        // Divide audience into two halves for each team
+        if (angle > PI) {
+            audience[i].baseColor = ICC_BLUE; // Team A supporters
+        } else {
+            audience[i].baseColor = ICC_RED; // Team B supporters
+        }
+    }
+    audienceLayoutInner = -1; // Force the next layout
+}
 
+// Maps the normalized seats onto the stands ring between innerRadius and outerRadius
+static void UpdateAudienceLayout(Vector2 center, float innerRadius, float outerRadius) {
+    if (center.x == audienceLayoutCenter.x && center.y == audienceLayoutCenter.y &&
+        innerRadius == audienceLayoutInner && outerRadius == audienceLayoutOuter) return;
 
+    float span = outerRadius - innerRadius;
+    for (int i = 0; i < AUDIENCE_SIZE; i++) {
+        float dist = innerRadius + audience[i].depth * span;
+        audiencePositions[i] = (Vector2){ center.x + audience[i].direction.x * dist, center.y + audience[i].direction.y * dist };
+    }
+    audienceLayoutCenter = center;
+    audienceLayoutInner = innerRadius;
+    audienceLayoutOuter = outerRadius;
+}
 
+// Stands, crowd, floodlights, field and pitch: everything on the gameplay screen that is not a player
+static void DrawStadium(Vector2 fieldCenter, float fieldRadius, bool is_celebrating) {
+    float boundaryRadius = fieldRadius + 15; // Boundary rope
+    float standsRadius = boundaryRadius + 70; // Audience stands
 
+    // Draw Stands
+    GfxDrawCircleV(fieldCenter, standsRadius, (Color){60, 60, 60, 255});
 
-// Function to initialize or re-initialize audience positions based on current screen size
-static void InitializeAudience() {
-    const int screenWidth = GetScreenWidth();
-    const int screenHeight = GetScreenHeight();
-    const Vector2 fieldCenter = { screenWidth / 2.0f, screenHeight / 2.0f + 50 };
-    const float boundaryRadius = screenWidth < screenHeight ? screenWidth * 0.35f : screenHeight * 0.35f;
-    const float standsRadius = boundaryRadius + 70; // Audience stands
-
-    for (int i = 0; i < 1500; i++) {
-        float angle = (float)rand() / (float)RAND_MAX * 360.0f;
-        float dist_variation = (float)rand() / (float)RAND_MAX * 60.0f;
-        float dist = standsRadius + dist_variation;
-        audience[i].position = (Vector2){ fieldCenter.x + cosf(angle) * dist, fieldCenter.y + sinf(angle) * dist };
-        
-        // Divide audience into two halves for each team
-        if (angle > 180) {
-            audience[i].baseColor = ICC_BLUE; // Team A supporters
-        } else {
-            audience[i].baseColor = ICC_RED; // Team B supporters
+
+
+    // Draw the audience. The members are in random order, so drawing the first part of
+    // the array thins the crowd evenly when the detail level drops.
+    const LodSettings *lod = lod_settings();
+    int audienceCount = (int)(AUDIENCE_SIZE * lod->crowd_fraction);
+    UpdateAudienceLayout(fieldCenter, boundaryRadius + 8, standsRadius - 4); // Seats between the rope and the edge of the stands
+    // The flashing pattern only changes flash_hz times a second instead of every frame
+    unsigned int flashSeed = (lod->flash_hz > 0.0f) ? (unsigned int)(GetTime() * lod->flash_hz) : 0;
+    for (int i = 0; i < audienceCount; i++) {
+        Color finalColor = audience[i].baseColor;
+        // If celebrating, make some of the crowd flash
+        if (is_celebrating) {
+            unsigned int h = ((unsigned int)i * 2654435761u) ^ (flashSeed * 2246822519u);
+            h ^= h >> 15;
+            h *= 2654435761u;
+            if (h % 5 == 0) finalColor = ((h >> 8) & 1) ? ICC_YELLOW : ICC_WHITE;
         }
+        GfxDrawCircleV(audiencePositions[i], 2, finalColor);
     }
+
+    // Draw Floodlights
+    GfxDrawRectangle(50, 50, 20, 100, ICC_GRAY); GfxDrawCircle(60, 45, 15, ICC_YELLOW);
+    GfxDrawRectangle(GetScreenWidth() - 70, 50, 20, 100, ICC_GRAY); GfxDrawCircle(GetScreenWidth() - 60, 45, 15, ICC_YELLOW);
+    GfxDrawRectangle(50, GetScreenHeight() - 150, 20, 100, ICC_GRAY); GfxDrawCircle(60, GetScreenHeight() - 155, 15, ICC_YELLOW);
+    GfxDrawRectangle(GetScreenWidth() - 70, GetScreenHeight() - 150, 20, 100, ICC_GRAY); GfxDrawCircle(GetScreenWidth() - 60, GetScreenHeight() - 155, 15, ICC_YELLOW);
+
+    // Draw Entry Gate
+    GfxDrawRectangle(GetScreenWidth()/2 - 50, (int)(fieldCenter.y + standsRadius), 100, 40, (Color){40, 40, 40, 255});
+
+    // --- Draw the Cricket Field ---
+    GfxDrawCircleV(fieldCenter, fieldRadius, ICC_GREEN);
+    GfxDrawCircleLinesV(fieldCenter, boundaryRadius, ICC_WHITE); // Boundary Rope
+
+    // Draw 30-yard circle
+    float thirtyYardRadius = fieldRadius * 0.45f;
+    GfxDrawCircleLinesV(fieldCenter, thirtyYardRadius, Fade(ICC_WHITE, 0.3f));
+
+    // Draw the pitch
+    Rectangle pitch = { fieldCenter.x - 200, fieldCenter.y - 25, 400, 50 };
+    GfxDrawRectangleRec(pitch, DARKBROWN);
+    GfxDrawRectangle(pitch.x + 20, pitch.y, 5, pitch.height, ICC_GRAY); // Crease
+    GfxDrawRectangle(pitch.x + pitch.width - 25, pitch.y, 5, pitch.height, ICC_GRAY); // Crease
 }
 
 void DrawScorecardUI(GameState *gameState, GuiState *guiState)
 {
     (void)guiState; // guiState not needed here yet - suppress unused-parameter warning
     Rectangle panel = { 20, GetScreenHeight() - 130 - 20, GetScreenWidth() - 40, 130 };
-    DrawRectangleRounded(panel, 0.2f, 10, ICC_BG);
-    DrawRectangleRoundedLines(panel, 0.2f, 10, 2, ICC_BLUE);
+    GfxDrawRectangleRounded(panel, 0.2f, 10, ICC_BG);
+    GfxDrawRectangleRoundedLines(panel, 0.2f, 10, 2, ICC_BLUE);
 
-    // FLAGS
-    if (scorecardAssets.flagBatting.id) {
-        DrawTextureEx(scorecardAssets.flagBatting, (Vector2){panel.x + 30, panel.y + 30}, 0, 0.4f, ICC_WHITE);
-    }
-    if (scorecardAssets.flagBowling.id) {
-        DrawTextureEx(scorecardAssets.flagBowling, (Vector2){panel.x + panel.width - 90, panel.y + 30}, 0, 0.4f, ICC_WHITE);
-    }
+    // FLAGS (both come from the shared atlas, nothing is loaded here)
+    flag_atlas_draw(gameState->batting_team->name, (Rectangle){ panel.x + 20, panel.y + 30, 90, 60 }, ICC_WHITE);
+    flag_atlas_draw(gameState->bowling_team->name, (Rectangle){ panel.x + panel.width - 110, panel.y + 30, 90, 60 }, ICC_WHITE);
+
+    // Every dynamic string below lives in a TextSlot, so it is only re-formatted and
+    // re-laid out when the numbers it shows change
+    static TextSlot runsSlot, wicketsSlot, oversSlot, strikerSlot, nonStrikerSlot, bowlerSlot, bowlerStatsSlot, targetSlot;
 
     // TEAM NAMES
     DrawTextBold(gameState->batting_team->name, panel.x + 130, panel.y + 30, 26, ICC_YELLOW);
 
     // SCORE
-    char runs_text[16];
-    sprintf(runs_text, "%d", gameState->total_runs);
-    DrawTextBold(runs_text, panel.x + 130, panel.y + 60, 24, ICC_WHITE);
+    if (text_slot_changed(&runsSlot, NULL, gameState->total_runs, 0, 0)) {
+        snprintf(runsSlot.text, sizeof(runsSlot.text), "%d", gameState->total_runs);
+    }
+    text_slot_draw(&runsSlot, panel.x + 130, panel.y + 60, 24, TEXT_STYLE_BOLD, ICC_WHITE);
 
-    char wickets_text[16];
-    sprintf(wickets_text, " / %d", gameState->wickets);
+    if (text_slot_changed(&wicketsSlot, NULL, gameState->wickets, 0, 0)) {
+        snprintf(wicketsSlot.text, sizeof(wicketsSlot.text), " / %d", gameState->wickets);
+    }
     // Measure the width of the runs text to position the wickets text correctly
-    float runs_text_width = MeasureText(runs_text, 24); // Assuming 24 is the font size
-    DrawTextBold(wickets_text, panel.x + 130 + runs_text_width, panel.y + 60, 24, ICC_WHITE);
-
-    // Show striker and non-striker details (handle -1 safely)
-    const char *strikerName = (gameState->striker_idx >= 0) ? gameState->batting_team->players[gameState->striker_idx].name : "(Select)";
-    const char *nonStrikerName = (gameState->non_striker_idx >= 0) ? gameState->batting_team->players[gameState->non_striker_idx].name : "(Select)";
-    int strikerRuns = (gameState->striker_idx >= 0) ? gameState->batting_team->players[gameState->striker_idx].total_runs : 0;
-    int strikerBalls = (gameState->striker_idx >= 0) ? gameState->batting_team->players[gameState->striker_idx].balls_faced : 0;
-    int nonStrikerRuns = (gameState->non_striker_idx >= 0) ? gameState->batting_team->players[gameState->non_striker_idx].total_runs : 0;
-    int nonStrikerBalls = (gameState->non_striker_idx >= 0) ? gameState->batting_team->players[gameState->non_striker_idx].balls_faced : 0;
-
+    float runs_text_width = text_slot_measure(&runsSlot, 24);
+    text_slot_draw(&wicketsSlot, panel.x + 130 + runs_text_width, panel.y + 60, 24, TEXT_STYLE_BOLD, ICC_WHITE);
 
-
-    DrawText(
-        TextFormat("Overs: %d.%d",
-            gameState->overs_completed,
-            gameState->balls_bowled_in_over),
-        panel.x + 130, panel.y + 95, 20, ICC_BLUE
-    );
+    if (text_slot_changed(&oversSlot, NULL, gameState->overs_completed, gameState->balls_bowled_in_over, 0)) {
+        snprintf(oversSlot.text, sizeof(oversSlot.text), "Overs: %d.%d", gameState->overs_completed, gameState->balls_bowled_in_over);
+    }
+    text_slot_draw(&oversSlot, panel.x + 130, panel.y + 95, 20, TEXT_STYLE_PLAIN, ICC_BLUE);
 
     // BATSMEN
     if (gameState->striker_idx >= 0) {
         Player *s = &gameState->batting_team->players[gameState->striker_idx];
-        DrawText(TextFormat("%s  %d(%d)", s->name, s->total_runs, s->balls_faced),
-                 panel.x + panel.width/2 - 100, panel.y + 55, 20, ICC_WHITE);
+        if (text_slot_changed(&strikerSlot, s, s->total_runs, s->balls_faced, 0)) {
+            snprintf(strikerSlot.text, sizeof(strikerSlot.text), "%s  %d(%d)", s->name, s->total_runs, s->balls_faced);
+        }
     } else {
-        DrawText("(Select Striker)", panel.x + panel.width/2 - 100, panel.y + 55, 20, ICC_WHITE);
+        text_slot_changed(&strikerSlot, NULL, -1, -1, 0);
+        text_slot_set(&strikerSlot, "(Select Striker)");
     }
+    text_slot_draw(&strikerSlot, panel.x + panel.width/2 - 100, panel.y + 55, 20, TEXT_STYLE_PLAIN, ICC_WHITE);
+
     if (gameState->non_striker_idx >= 0) {
         Player *ns = &gameState->batting_team->players[gameState->non_striker_idx];
-        DrawText(TextFormat("%s  %d(%d)", ns->name, ns->total_runs, ns->balls_faced),
-                 panel.x + panel.width/2 - 100, panel.y + 80, 20, ICC_GRAY);
+        if (text_slot_changed(&nonStrikerSlot, ns, ns->total_runs, ns->balls_faced, 0)) {
+            snprintf(nonStrikerSlot.text, sizeof(nonStrikerSlot.text), "%s  %d(%d)", ns->name, ns->total_runs, ns->balls_faced);
+        }
     } else {
-        DrawText("(Select Non-Striker)", panel.x + panel.width/2 - 100, panel.y + 80, 20, ICC_GRAY);
+        text_slot_changed(&nonStrikerSlot, NULL, -1, -1, 0);
+        text_slot_set(&nonStrikerSlot, "(Select Non-Striker)");
     }
+    text_slot_draw(&nonStrikerSlot, panel.x + panel.width/2 - 100, panel.y + 80, 20, TEXT_STYLE_PLAIN, ICC_GRAY);
 
     // BOWLER + BALL DOTS
     if (gameState->bowler_idx >= 0) {
         Player *bowler = &gameState->bowling_team->players[gameState->bowler_idx];
-        DrawText(TextFormat("Bowler: %s", bowler->name),
-                 panel.x + panel.width - 260, panel.y + 45, 20, ICC_GREEN);
+        if (text_slot_changed(&bowlerSlot, bowler, 0, 0, 0)) {
+            snprintf(bowlerSlot.text, sizeof(bowlerSlot.text), "Bowler: %s", bowler->name);
+        }
+        text_slot_draw(&bowlerSlot, panel.x + panel.width - 260, panel.y + 45, 20, TEXT_STYLE_PLAIN, ICC_GREEN);
         // Show current bowler's match stats
-        DrawText(TextFormat("Overs: %d  Runs: %d  W: %d", bowler->match_balls_bowled / 6, bowler->match_runs_conceded, bowler->match_wickets),
-                 panel.x + panel.width - 260, panel.y + 70, 16, ICC_BLUE);
+        if (text_slot_changed(&bowlerStatsSlot, bowler, bowler->match_balls_bowled, bowler->match_runs_conceded, bowler->match_wickets)) {
+            snprintf(bowlerStatsSlot.text, sizeof(bowlerStatsSlot.text), "Overs: %d  Runs: %d  W: %d",
+                     bowler->match_balls_bowled / 6, bowler->match_runs_conceded, bowler->match_wickets);
+        }
+        text_slot_draw(&bowlerStatsSlot, panel.x + panel.width - 260, panel.y + 70, 16, TEXT_STYLE_PLAIN, ICC_BLUE);
     } else {
-        DrawText("Bowler: (Select)", panel.x + panel.width - 260, panel.y + 45, 20, ICC_WHITE);
+        text_cache_draw("Bowler: (Select)", panel.x + panel.width - 260, panel.y + 45, 20, TEXT_STYLE_PLAIN, ICC_WHITE);
     }
 
     int x = panel.x + panel.width - 260;
@@ -958,11 +1268,11 @@ void DrawScorecardUI(GameState *gameState, GuiState *guiState)
         }
 
         Vector2 circle_center = {x + i * 25, y}; // Increased spacing between circles
-        DrawCircleV(circle_center, circle_radius, c);
+        GfxDrawCircleV(circle_center, circle_radius, c);
 
         // Center the text inside the circle
-        float text_width = MeasureText(ball_outcome_text, text_font_size);
-        DrawText(ball_outcome_text, circle_center.x - text_width / 2, circle_center.y - text_font_size / 2, text_font_size, text_color);
+        float text_width = text_cache_measure(ball_outcome_text, text_font_size);
+        text_cache_draw(ball_outcome_text, circle_center.x - text_width / 2, circle_center.y - text_font_size / 2, text_font_size, TEXT_STYLE_PLAIN, text_color);
     }
 
     // SECOND INNINGS TARGET
@@ -971,13 +1281,40 @@ void DrawScorecardUI(GameState *gameState, GuiState *guiState)
             (gameState->max_overs * 6) -
             (gameState->overs_completed * 6 + gameState->balls_bowled_in_over);
 
-        DrawTextBold(
-            TextFormat("Need %d runs in %d balls",
-                gameState->target - gameState->total_runs,
-                ballsLeft),
-            panel.x + panel.width/2 - 140, panel.y + 105, 18, ICC_YELLOW
-        );
+        int runsNeeded = gameState->target - gameState->total_runs;
+        if (text_slot_changed(&targetSlot, NULL, runsNeeded, ballsLeft, 0)) {
+            snprintf(targetSlot.text, sizeof(targetSlot.text), "Need %d runs in %d balls", runsNeeded, ballsLeft);
+        }
+        text_slot_draw(&targetSlot, panel.x + panel.width/2 - 140, panel.y + 105, 18, TEXT_STYLE_BOLD, ICC_YELLOW);
+    }
+}
+
+// The engine bowling on the gameplay screen's GameState, bound on first use. The screen's
+// match is the one scoreboards follow, so its balls go to the live feed, and every ball is
+// rated into gameRatings.
+static SimEngine *GameplayEngine(GameState *gameState) {
+    static unsigned ratedGeneration;
+    if (matchEngine.state != gameState) sim_engine_init(&matchEngine, gameState, (uint32_t)GetRandomValue(1, 0x7FFFFFFF), 0);
+    gameState->live_feed = liveFeed;
+    if (!gameState->ratings || ratedGeneration != gameRatingsGeneration) {
+        Ratings *ratings = GameRatings();
+        ratings_add_team(ratings, gameState->batting_team);
+        ratings_add_team(ratings, gameState->bowling_team);
+        gameState->ratings = ratings;
+        gameState->rated_sides[0] = gameState->rated_sides[1] = NULL; // Ids are looked up again
+        ratedGeneration = gameRatingsGeneration;
     }
+    return &matchEngine;
+}
+
+// The gameplay screen's result, once per match, for the matches whose balls were rated
+static void RateFinishedMatch(const GameState *gameState) {
+    Ratings *ratings = gameState->ratings;
+    if (!ratings) return;
+    int winner = (gameState->total_runs >= gameState->target) ? 0 : (gameState->total_runs == gameState->target - 1) ? -1 : 1;
+    ratings_record_result(ratings, ratings_find(ratings, gameState->batting_team->name, NULL),
+                          ratings_find(ratings, gameState->bowling_team->name, NULL), winner);
+    ratings_save(ratings, RATINGS_FILE);
 }
 
 // Draw UI for selecting the bowler for the upcoming over
@@ -986,7 +1323,7 @@ static void DrawBowlerSelection(GameState *gameState)
     Team *team = gameState->bowling_team;
     int y = 200;
 
-    DrawText("Select Bowler for this Over", 50, 150, 24, ICC_YELLOW);
+    GfxDrawText("Select Bowler for this Over", 50, 150, 24, ICC_YELLOW);
 
     for (int i = 0; i < team->num_players; i++) {
         Player *p = &team->players[i];
@@ -1000,32 +1337,30 @@ static void DrawBowlerSelection(GameState *gameState)
             disabled = true;
             disable_reason = "Bowled last over";
         }
-        if (p->match_balls_bowled >= 60) { // 10 overs max
+        if (oversBowled >= sim_bowling_quota(gameState)) {
             disabled = true;
-            disable_reason = "Max 10 overs reached";
+            disable_reason = TextFormat("Max %d overs reached", sim_bowling_quota(gameState));
         }
 
         Rectangle btn = { 50, y, 500, 40 };
         Color bg = disabled ? ICC_GRAY : ICC_BLUE;
-        DrawRectangleRec(btn, bg);
+        GfxDrawRectangleRec(btn, bg);
 
         // Draw player name and basic stats
-        DrawText(p->name, 60, y + 8, 18, ICC_WHITE);
-        DrawText(TextFormat("Overs: %d  Runs: %d  W: %d", oversBowled, p->match_runs_conceded, p->match_wickets),
+        GfxDrawText(p->name, 60, y + 8, 18, ICC_WHITE);
+        GfxDrawText(TextFormat("Overs: %d  Runs: %d  W: %d", oversBowled, p->match_runs_conceded, p->match_wickets),
                  220, y + 8, 14, ICC_WHITE);
 
         // Show disable reason
         if (disabled) {
-            DrawText(disable_reason, 420, y + 8, 12, ICC_GRAY);
+            GfxDrawText(disable_reason, 420, y + 8, 12, ICC_GRAY);
         }
 
         // Handle click only if not disabled
         if (!disabled && CheckCollisionPointRec(GetMousePosition(), btn) &&
             IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
 
-            gameState->bowler_idx = i;
-            gameState->awaiting_bowler_selection = false;
-            gameState->balls_bowled_in_over = 0;
+            sim_engine_decide(GameplayEngine(gameState), (SimDecision){ SIM_DECISION_BOWLER, i });
         }
         y += 50;
     }
@@ -1037,7 +1372,7 @@ static void DrawBatsmanSelection(GameState *gameState)
     Team *team = gameState->batting_team;
     int y = 180;
 
-    DrawText("Select Batsman", 50, 140, 24, ICC_YELLOW);
+    GfxDrawText("Select Batsman", 50, 140, 24, ICC_YELLOW);
 
     for (int i = 0; i < team->num_players; i++) {
         Player *p = &team->players[i];
@@ -1051,37 +1386,166 @@ static void DrawBatsmanSelection(GameState *gameState)
 
         Rectangle btn = { 50, y, 520, 40 };
         Color bg = disabled ? ICC_GRAY : ICC_GREEN;
-        DrawRectangleRec(btn, bg);
-        DrawText(p->name, 60, y + 8, 18, ICC_WHITE);
+        GfxDrawRectangleRec(btn, bg);
+        GfxDrawText(p->name, 60, y + 8, 18, ICC_WHITE);
 
         // Draw stats
-        DrawText(TextFormat("Runs: %d  Balls: %d", p->total_runs, p->balls_faced), 240, y + 8, 14, ICC_WHITE);
-        if (p->is_out) DrawText(p->dismissal_info, 360, y + 8, 12, ICC_RED);
+        GfxDrawText(TextFormat("Runs: %d  Balls: %d", p->total_runs, p->balls_faced), 240, y + 8, 14, ICC_WHITE);
+        if (p->is_out) GfxDrawText(p->dismissal_info, 360, y + 8, 12, ICC_RED);
 
         if (!disabled && CheckCollisionPointRec(GetMousePosition(), btn) &&
             IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
 
-            if (gameState->striker_idx == -1)
-                gameState->striker_idx = i;
-            else
-                gameState->non_striker_idx = i;
-
-            if (gameState->striker_idx != -1 &&
-                gameState->non_striker_idx != -1) {
-                gameState->awaiting_batsman_selection = false;
-            }
+            sim_engine_decide(GameplayEngine(gameState), (SimDecision){ SIM_DECISION_BATSMAN, i });
         }
         y += 50;
     }
 }
 
+// Scores from the other World Cup fixtures of the day, in a strip under the scorecard
+static void DrawFixtureTicker(void) {
+    if (!sim_service_active()) return;
+    int first, last;
+    sim_service_day_range(&first, &last);
+    if (last - first > WC_MAX_FIXTURES_PER_DAY) last = first + WC_MAX_FIXTURES_PER_DAY;
+
+    static TextSlot slots[WC_MAX_FIXTURES_PER_DAY];
+    int x = 20;
+    const int y = GetScreenHeight() - 18;
+    for (int i = first; i < last; i++) {
+        SimFixtureView view;
+        if (!sim_service_view(i, &view)) continue; // The user's own fixture
+        TextSlot *slot = &slots[i - first];
+        if (text_slot_changed(slot, NULL, i, view.status * 2 + view.innings,
+                              (long long)view.runs[view.innings] * 10000 + view.wickets[view.innings] * 1000 + view.balls[view.innings])) {
+            sim_service_describe(i, slot->text, sizeof(slot->text));
+        }
+        text_slot_draw(slot, x, y, 16, TEXT_STYLE_PLAIN, view.status == SIM_FIXTURE_FINISHED ? ICC_GREEN : ICC_YELLOW);
+        x += text_slot_measure(slot, 16) + 40;
+    }
+}
+
+// Leaves an innings finished by the simulator ready to be drawn: the last bowler stays on,
+// the not-out batsman takes strike and nothing waits for a selection
+static void SettleSimulatedInnings(GameState *gameState) {
+    if (!sim_innings_over(gameState)) return;
+    gameState->awaiting_bowler_selection = false;
+    gameState->awaiting_batsman_selection = false;
+    if (gameState->bowler_idx < 0) gameState->bowler_idx = (gameState->last_bowler_idx >= 0) ? gameState->last_bowler_idx : 0;
+    if (gameState->striker_idx < 0) gameState->striker_idx = gameState->non_striker_idx;
+    if (gameState->non_striker_idx < 0) gameState->non_striker_idx = gameState->striker_idx;
+}
+
+// The innings break and result banners; `prompt` adds the key that starts the chase
+static void DrawInningsStatus(GameplayPhase phase, const GameState *gameState, bool prompt) {
+    if (phase == PHASE_INNINGS_BREAK) {
+        GfxDrawText("INNINGS BREAK", GetScreenWidth()/2 - text_cache_measure("INNINGS BREAK", 40)/2, GetScreenHeight()/2 - 40, 40, ICC_YELLOW);
+        char targetText[64];
+        sprintf(targetText, "Target: %d", gameState->target);
+        GfxDrawText(targetText, GetScreenWidth()/2 - text_cache_measure(targetText, 30)/2, GetScreenHeight()/2 + 10, 30, ICC_WHITE);
+        if (prompt) GfxDrawText("Press [SPACE] to start 2nd Innings", GetScreenWidth()/2 - text_cache_measure("Press [SPACE] to start 2nd Innings", 20)/2, GetScreenHeight()/2 + 50, 20, ICC_WHITE);
+    } else if (phase == PHASE_MATCH_OVER) {
+        char winnerText[128];
+        if (gameState->total_runs >= gameState->target) {
+            sprintf(winnerText, "%s won by %d wickets!", gameState->batting_team->name, 10 - gameState->wickets);
+        } else if (gameState->total_runs == gameState->target - 1) {
+            sprintf(winnerText, "Match Tied!");
+        } else {
+            sprintf(winnerText, "%s won by %d runs!", gameState->bowling_team->name, gameState->target - gameState->total_runs -1);
+        }
+        GfxDrawText("MATCH OVER", GetScreenWidth()/2 - text_cache_measure("MATCH OVER", 50)/2, GetScreenHeight()/2 - 40, 50, ICC_GREEN);
+        GfxDrawText(winnerText, GetScreenWidth()/2 - text_cache_measure(winnerText, 30)/2, GetScreenHeight()/2 + 20, 30, ICC_WHITE);
+    }
+}
+
+// What the gameplay screen shows this frame, in screen pixels, for the spectators
+typedef struct {
+    GameplayPhase phase;
+    Vector2 fieldCenter;
+    float fieldScale;               // Pixels per field unit
+    const Vector2 *fielders;        // NUM_FIELDERS, in field units already
+    Vector2 striker, nonStriker, bowler, runner, ball;
+    float ballAltitude;
+    bool ballVisible, runnerVisible;
+    const char *message;
+    bool celebrating;
+} GameplayView;
+
+static ReplicaPoint ToFieldUnits(Vector2 p, const GameplayView *view) {
+    return (ReplicaPoint){ (p.x - view->fieldCenter.x) / view->fieldScale, (p.y - view->fieldCenter.y) / view->fieldScale };
+}
+
+static void CopyReplicaName(char *dest, const Player *player) {
+    snprintf(dest, REPLICA_NAME_LEN, "%.*s", REPLICA_NAME_LEN - 1, player ? player->name : "");
+}
+
+// Sends the gameplay screen to the spectators when hosting. Without a view (a selection
+// overlay is up) the figures stay where they were last sent.
+static void PublishToSpectators(const GameState *gameState, const GameplayView *view) {
+    static ReplicaState replica;
+    if (!spectatorHost) return;
+
+    const Team *batting = gameState->batting_team, *bowling = gameState->bowling_team;
+    const Player *striker = gameState->striker_idx >= 0 ? &batting->players[gameState->striker_idx] : NULL;
+    const Player *nonStriker = gameState->non_striker_idx >= 0 ? &batting->players[gameState->non_striker_idx] : NULL;
+    const Player *bowler = gameState->bowler_idx >= 0 ? &bowling->players[gameState->bowler_idx] : NULL;
+    const Player *keeper = bowling->num_players > 0 ? &bowling->players[bowling->num_players - 1] : NULL; // Same fallback as DrawFielders
+    for (int i = 0; i < bowling->num_players; i++) {
+        if (bowling->players[i].is_wicketkeeper) { keeper = &bowling->players[i]; break; }
+    }
+
+    snprintf(replica.batting_team, REPLICA_NAME_LEN, "%.*s", REPLICA_NAME_LEN - 1, batting->name);
+    snprintf(replica.bowling_team, REPLICA_NAME_LEN, "%.*s", REPLICA_NAME_LEN - 1, bowling->name);
+    CopyReplicaName(replica.striker, striker);
+    CopyReplicaName(replica.non_striker, nonStriker);
+    CopyReplicaName(replica.bowler, bowler);
+    CopyReplicaName(replica.keeper, keeper);
+
+    replica.total_runs = gameState->total_runs;
+    replica.wickets = gameState->wickets;
+    replica.overs_completed = gameState->overs_completed;
+    replica.balls_in_over = gameState->balls_bowled_in_over;
+    replica.max_overs = gameState->max_overs;
+    replica.target = gameState->target;
+    replica.inning_num = gameState->inning_num;
+    replica.powerplay = gameState->current_powerplay;
+    replica.striker_runs = striker ? striker->total_runs : 0;
+    replica.striker_balls = striker ? striker->balls_faced : 0;
+    replica.non_striker_runs = nonStriker ? nonStriker->total_runs : 0;
+    replica.non_striker_balls = nonStriker ? nonStriker->balls_faced : 0;
+    replica.bowler_balls = bowler ? bowler->match_balls_bowled : 0;
+    replica.bowler_runs = bowler ? bowler->match_runs_conceded : 0;
+    replica.bowler_wickets = bowler ? bowler->match_wickets : 0;
+    replica.history_count = ballHistoryCount;
+    for (int i = 0; i < ballHistoryCount; i++) replica.history[i] = ballHistory[i];
+
+    replica.waiting = gameState->awaiting_bowler_selection ? REPLICA_WAIT_BOWLER :
+                      gameState->awaiting_batsman_selection ? REPLICA_WAIT_BATSMAN : REPLICA_WAIT_NONE;
+    replica.ball_count = (gameState->inning_num * 512 + gameState->overs_completed * 6 + gameState->balls_bowled_in_over) & 0xFFFF;
+    replica.last_ball = ballHistoryCount > 0 ? ballHistory[ballHistoryCount - 1] : 0;
+
+    if (view) {
+        replica.phase = view->phase;
+        snprintf(replica.message, REPLICA_MESSAGE_LEN, "%s", view->message);
+        replica.celebrating = view->celebrating;
+        for (int i = 0; i < REPLICA_FIELDERS; i++) replica.fielders[i] = (ReplicaPoint){ view->fielders[i].x, view->fielders[i].y };
+        replica.striker_pos = ToFieldUnits(view->striker, view);
+        replica.non_striker_pos = ToFieldUnits(view->nonStriker, view);
+        replica.bowler_pos = ToFieldUnits(view->bowler, view);
+        replica.runner_pos = ToFieldUnits(view->runner, view);
+        replica.ball_pos = ToFieldUnits(view->ball, view);
+        replica.ball_altitude = view->ballAltitude / view->fieldScale;
+        replica.ball_visible = view->ballVisible;
+        replica.runner_visible = view->runnerVisible;
+    }
+    spectator_host_publish(spectatorHost, &replica, GetTime());
+}
+
 static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, GameSounds *sounds) {
     const Rectangle backButton = { GetScreenWidth() - 170, GetScreenHeight() - 200, 150, 40 };
 
     // Load scorecard assets once
     if (!scorecardAssets.loaded) {
-        scorecardAssets.flagBatting = LoadTeamFlag(gameState->batting_team->name);
-        scorecardAssets.flagBowling = LoadTeamFlag(gameState->bowling_team->name);
         scorecardAssets.font = GetFontDefault();
         scorecardAssets.loaded = true;
     }
@@ -1089,11 +1553,6 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
     if (CheckCollisionPointRec(GetMousePosition(), backButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         // Go back to the previous screen (likely the main menu)
         save_game_state(gameState, "Data/saves/resume.dat");
-        if (scorecardAssets.loaded) {
-            UnloadTexture(scorecardAssets.flagBatting);
-            UnloadTexture(scorecardAssets.flagBowling);
-            scorecardAssets.loaded = false;
-        }
         ChangeScreen(state, state->previousScreen);
     }
 
@@ -1128,14 +1587,14 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
     Rectangle battingCardBtn = { x_offset, editFieldButton.y + editFieldButton.height + 110, 160, 30 };
     Rectangle bowlingCardBtn = { x_offset + 170, editFieldButton.y + editFieldButton.height + 110, 160, 30 };
 
-    DrawRectangleRec(battingCardBtn, ICC_BLUE);
-    DrawText("Batting Scorecard", battingCardBtn.x + 10, battingCardBtn.y + 6, 16, ICC_WHITE);
+    GfxDrawRectangleRec(battingCardBtn, ICC_BLUE);
+    GfxDrawText("Batting Scorecard", battingCardBtn.x + 10, battingCardBtn.y + 6, 16, ICC_WHITE);
     if (CheckCollisionPointRec(GetMousePosition(), battingCardBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         showBattingScorecard = true;
     }
 
-    DrawRectangleRec(bowlingCardBtn, ICC_BLUE);
-    DrawText("Bowling Scorecard", bowlingCardBtn.x + 10, bowlingCardBtn.y + 6, 16, ICC_WHITE);
+    GfxDrawRectangleRec(bowlingCardBtn, ICC_BLUE);
+    GfxDrawText("Bowling Scorecard", bowlingCardBtn.x + 10, bowlingCardBtn.y + 6, 16, ICC_WHITE);
     if (CheckCollisionPointRec(GetMousePosition(), bowlingCardBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         showBowlingScorecard = true;
     }
@@ -1144,24 +1603,22 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
 
 
     if (gameState->gameplay_mode == GAMEPLAY_MODE_PLAYING) {
-        DrawRectangleRec(fieldSetupButton, ICC_BLUE);
+        GfxDrawRectangleRec(fieldSetupButton, ICC_BLUE);
         char fieldButtonText[64];
         sprintf(fieldButtonText, "Field: %s", field_setup_names[gameState->fielding_setup]);
-        DrawText(fieldButtonText, fieldSetupButton.x + 10, fieldSetupButton.y + 10, 20, ICC_WHITE);
+        GfxDrawText(fieldButtonText, fieldSetupButton.x + 10, fieldSetupButton.y + 10, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), fieldSetupButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            FieldingSetup next;
             if (gameState->current_powerplay == POWERPLAY_1) {
-                if (gameState->fielding_setup == PP_AGGRESSIVE) {
-                    gameState->fielding_setup = PP_DEFENSIVE;
-                } else {
-                    gameState->fielding_setup = PP_AGGRESSIVE;
-                }
+                next = (gameState->fielding_setup == PP_AGGRESSIVE) ? PP_DEFENSIVE : PP_AGGRESSIVE;
             } else {
-                gameState->fielding_setup = (FieldingSetup)((gameState->fielding_setup + 1) % FIELD_SETUP_COUNT);
+                next = (FieldingSetup)((gameState->fielding_setup + 1) % FIELD_SETUP_COUNT);
             }
+            sim_engine_decide(GameplayEngine(gameState), (SimDecision){ SIM_DECISION_FIELD, next });
         }
 
-        DrawRectangleRec(editFieldButton, ICC_GREEN);
-        DrawText("Edit Field", editFieldButton.x + 10, editFieldButton.y + 10, 20, ICC_WHITE);
+        GfxDrawRectangleRec(editFieldButton, ICC_GREEN);
+        GfxDrawText("Edit Field", editFieldButton.x + 10, editFieldButton.y + 10, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), editFieldButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             gameState->gameplay_mode = GAMEPLAY_MODE_CUSTOM_FIELDING;
             // Copy current setup to custom setup
@@ -1171,11 +1628,11 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
             }
         }
     } else { // GAMEPLAY_MODE_CUSTOM_FIELDING
-        DrawRectangleRec(fieldSetupButton, ICC_GRAY); // Disabled when editing
-        DrawText("Field: Custom", fieldSetupButton.x + 10, fieldSetupButton.y + 10, 20, ICC_GRAY);
+        GfxDrawRectangleRec(fieldSetupButton, ICC_GRAY); // Disabled when editing
+        GfxDrawText("Field: Custom", fieldSetupButton.x + 10, fieldSetupButton.y + 10, 20, ICC_GRAY);
 
-        DrawRectangleRec(editFieldButton, ICC_RED);
-        DrawText("Apply Field", editFieldButton.x + 10, editFieldButton.y + 10, 20, ICC_WHITE);
+        GfxDrawRectangleRec(editFieldButton, ICC_RED);
+        GfxDrawText("Apply Field", editFieldButton.x + 10, editFieldButton.y + 10, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), editFieldButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             gameState->gameplay_mode = GAMEPLAY_MODE_PLAYING;
             // The custom setup is now the active one for the remainder of gameplay
@@ -1189,20 +1646,22 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
         memset(ballHistory, 0, sizeof(ballHistory));
         ballHistoryCount = 0;
         // Draw a simple selection overlay
-        ClearBackground(ICC_BG);
+        GfxClearBackground(ICC_BG);
         // Use a dedicated function for cleaner drawing
         // We'll draw within an immediate Begin/End context already open
         // Call DrawBowlerSelection (defined below)
         // Note: not using additional BeginDrawing/EndDrawing here because we are already inside one
         DrawBowlerSelection(gameState);
-        EndDrawing();
+        GfxEndDrawing();
+        PublishToSpectators(gameState, NULL);
         return;
     }
 
     if (gameState->awaiting_batsman_selection) {
-        ClearBackground(ICC_BG);
+        GfxClearBackground(ICC_BG);
         DrawBatsmanSelection(gameState);
-        EndDrawing();
+        GfxEndDrawing();
+        PublishToSpectators(gameState, NULL);
         return;
     }
 
@@ -1234,7 +1693,34 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
     static float ballVelocityY = 0.0f;
     static bool match_over_sound_played = false;
 
-    bool isGameOver = (gameState->overs_completed >= gameState->max_overs || gameState->wickets >= 10);
+    bool isGameOver = sim_innings_over(gameState); // Overs used up, all out, or the target reached
+
+    // A new match started since the last one ended (the next World Cup fixture)
+    if (currentPhase == PHASE_MATCH_OVER && gameState->inning_num == 1) {
+        currentPhase = PHASE_IDLE;
+    }
+
+    // --- Instant simulation: resolves the rest of the over, innings or match without animation ---
+    if (gameState->gameplay_mode == GAMEPLAY_MODE_PLAYING && currentPhase == PHASE_IDLE && !isGameOver) {
+        const char *simLabels[] = { "Sim Over", "Sim Innings", "Sim Match" };
+        const SimUntil simScopes[] = { SIM_UNTIL_END_OF_OVER, SIM_UNTIL_END_OF_INNINGS, SIM_UNTIL_END_OF_MATCH };
+        for (int i = 0; i < 3; i++) {
+            Rectangle simButton = { x_offset + i * 112, editFieldButton.y + editFieldButton.height + 150, 106, 30 };
+            GfxDrawRectangleRec(simButton, VIOLET);
+            GfxDrawText(simLabels[i], simButton.x + simButton.width/2 - text_cache_measure(simLabels[i], 16)/2, simButton.y + 7, 16, ICC_WHITE);
+            if (!CheckCollisionPointRec(GetMousePosition(), simButton) || !IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) continue;
+
+            int inning_before = gameState->inning_num;
+            sim_engine_play_until(GameplayEngine(gameState), simScopes[i]);
+            SettleSimulatedInnings(gameState);
+            if (gameState->inning_num != inning_before) designated_wk_idx = -1; // The engine started the chase
+            memset(ballHistory, 0, sizeof(ballHistory));
+            ballHistoryCount = 0;
+            if (simScopes[i] != SIM_UNTIL_END_OF_OVER) showBattingScorecard = true; // Straight to the card
+            isGameOver = sim_innings_over(gameState);
+            break;
+        }
+    }
 
     if (gameState->wickets >= 10 && gameState->inning_num == 1) {
         currentPhase = PHASE_INNINGS_BREAK;
@@ -1242,7 +1728,7 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
 
     if (currentPhase == PHASE_IDLE && !isGameOver && IsKeyPressed(KEY_SPACE)) {
         currentPhase = PHASE_BOWLER_RUNUP;
-        PlaySound(sounds->bowling);
+        audio_clip_play(&sounds->bowling);
         bowlerAnimPos = (Vector2){ GetScreenWidth() / 2.0f - 250, GetScreenHeight() / 2.0f }; // Start of run-up
         animTimer = 0.0f;
         showRunButton = false;
@@ -1254,53 +1740,9 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
     }
 
 
-    BeginDrawing();
-    ClearBackground(ICC_GRAY); // A darker background for a stadium feel
-
-    
-    // --- Draw Stadium Environment ---
-    
-    float boundaryRadius = fieldRadius + 15; // Boundary rope
-    float standsRadius = boundaryRadius + 70; // Audience stands
-
-    // Draw Stands
-    DrawCircleV(fieldCenter, standsRadius, (Color){60, 60, 60, 255});
-
-
-
-    // Draw the audience
-    bool is_celebrating = (GetTime() < celebration_end_time);
-    for (int i = 0; i < 1500; i++) {
-        Color finalColor = audience[i].baseColor;
-        // If celebrating, make some of the crowd flash
-        if (is_celebrating && (rand() % 5 == 0)) {
-            finalColor = (rand() % 2 == 0) ? ICC_YELLOW : ICC_WHITE;
-        }
-        DrawCircleV(audience[i].position, 2, finalColor);
-    }
-
-    // Draw Floodlights
-    DrawRectangle(50, 50, 20, 100, ICC_GRAY); DrawCircle(60, 45, 15, ICC_YELLOW);
-    DrawRectangle(GetScreenWidth() - 70, 50, 20, 100, ICC_GRAY); DrawCircle(GetScreenWidth() - 60, 45, 15, ICC_YELLOW);
-    DrawRectangle(50, GetScreenHeight() - 150, 20, 100, ICC_GRAY); DrawCircle(60, GetScreenHeight() - 155, 15, ICC_YELLOW);
-    DrawRectangle(GetScreenWidth() - 70, GetScreenHeight() - 150, 20, 100, ICC_GRAY); DrawCircle(GetScreenWidth() - 60, GetScreenHeight() - 155, 15, ICC_YELLOW);
-
-    // Draw Entry Gate
-    DrawRectangle(GetScreenWidth()/2 - 50, (int)(fieldCenter.y + standsRadius), 100, 40, (Color){40, 40, 40, 255});
-
-    // --- Draw the Cricket Field ---
-    DrawCircleV(fieldCenter, fieldRadius, ICC_GREEN);
-    DrawCircleLinesV(fieldCenter, boundaryRadius, ICC_WHITE); // Boundary Rope
-
-    // Draw 30-yard circle
-    float thirtyYardRadius = fieldRadius * 0.45f;
-    DrawCircleLinesV(fieldCenter, thirtyYardRadius, Fade(ICC_WHITE, 0.3f));
-
-    // Draw the pitch
-    Rectangle pitch = { fieldCenter.x - 200, fieldCenter.y - 25, 400, 50 };
-    DrawRectangleRec(pitch, DARKBROWN);
-    DrawRectangle(pitch.x + 20, pitch.y, 5, pitch.height, ICC_GRAY); // Crease
-    DrawRectangle(pitch.x + pitch.width - 25, pitch.y, 5, pitch.height, ICC_GRAY); // Crease
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_GRAY); // A darker background for a stadium feel
+    DrawStadium(fieldCenter, fieldRadius, GetTime() < celebration_end_time);
 
     // Display Powerplay info
     const char* pp_text = "";
@@ -1310,7 +1752,7 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
         case POWERPLAY_2: pp_text = "PP2 (11-40)"; max_outside = 4; break;
         case POWERPLAY_3: pp_text = "PP3 (41-50)"; max_outside = 5; break;
     }
-    DrawText(TextFormat("Powerplay: %s (%d outside max)", pp_text, max_outside), 20, 100, 20, ICC_GRAY);
+    GfxDrawText(TextFormat("Powerplay: %s (%d outside max)", pp_text, max_outside), 20, 100, 20, ICC_GRAY);
 
 
     // --- Player Positions ---
@@ -1339,239 +1781,57 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
             }
             break;
         case PHASE_BATSMAN_SWING:
-    animTimer += GetFrameTime();
-    if (animTimer >= 0.2f) { // 0.2-second swing
-        // --- NEW SKILL AND FIELDING BASED SIMULATION ---
-        Player *striker = &gameState->batting_team->players[gameState->striker_idx];
-        Player *bowler = &gameState->bowling_team->players[gameState->bowler_idx];
-
-        // 1. Skill difference & Timing
-        int skill_diff = striker->batting_skill - bowler->bowling_skill;
-        int timing = (rand() % 41) - 20; // -20 (very poor) to +20 (perfect)
-        int final_shot_quality = skill_diff + timing;
-
-        // 2. Introduce "Play and Miss" dot ball chance
-        // A "play and miss" means no runs and no wicket, just a dot ball.
-        int play_and_miss_chance = 60 - (striker->batting_skill - bowler->bowling_skill) / 3;
-        if (play_and_miss_chance < 5) play_and_miss_chance = 5; // Minimum 5% chance
-        if (play_and_miss_chance > 60) play_and_miss_chance = 60; // Maximum 60% chance
-
-        if (rand() % 100 < play_and_miss_chance) {
-            // It's a play and miss dot ball
-            runsThisBall = 0;
-            // Inlined ball update logic
-            gameState->balls_bowled_in_over++;
-            // per-ball stats
-            if (gameState->bowler_idx >= 0) {
-                Player *cb = &gameState->bowling_team->players[gameState->bowler_idx];
-                cb->match_balls_bowled++;
-            }
-            if (striker) striker->balls_faced++;
-            if (gameState->balls_bowled_in_over >= 6) {
-                gameState->overs_completed++;
-                gameState->balls_bowled_in_over = 0;
-
-                // Rotate strike at end of over
-                int temp = gameState->striker_idx;
-                gameState->striker_idx = gameState->non_striker_idx;
-                gameState->non_striker_idx = temp;
-
-                // End of over: defer bowler selection to the UI
-                gameState->last_bowler_idx = gameState->bowler_idx;
-                gameState->awaiting_bowler_selection = true;
-                gameState->selected_bowler_idx = -1;
-                gameState->bowler_idx = -1;
-                gameState->bowler_idx = -1;
-            }
-            // Log ball data for play and miss dot
-            log_ball_data(gameState, 1, gameState->overs_completed, gameState->balls_bowled_in_over,
-                          striker, bowler, 0, OUTCOME_DOT, NULL, NULL);
-
-            playMissMessageEndTime = GetTime() + 1.5; // Show message for 1.5 seconds
-            PlaySound(sounds->dot_ball);
-            PushBallOutcome(0); // Record dot ball
-            currentPhase = PHASE_IDLE; // Reset for the next ball
-            animTimer = 0.0f;
-            return; // Exit, as this ball is completed.
-        }
-        // 2. Wicket chance on poor timing/skill
-        if (final_shot_quality < -25) {
-            gameState->wickets++;
-            bowler->total_wickets++;
-            strcpy(outcomeMessage, "WICKET!");
-            outcomeMessageEndTime = GetTime() + 2.0;
-            // Defer batsman replacement to UI instead of auto-assigning next batsman
-            gameState->awaiting_batsman_selection = true;
-            int candidate = (gameState->striker_idx > gameState->non_striker_idx) ? gameState->striker_idx + 1 : gameState->non_striker_idx + 1;
-            if (candidate < gameState->batting_team->num_players) gameState->next_batsman_idx = candidate;
-
-            // Determine dismissal method (50/50 for now)
-            const char *dismissal_type;
-            if (rand() % 2 == 0) {
-                dismissal_type = "Bowled";
-                PlaySound(sounds->bowled_wicket);
-            } else {
-                dismissal_type = "Caught (Simulated)";
-                PlaySound(sounds->edge);
-            }
-
-            // Mark striker as out and record dismissal info
-            if (striker) {
-                striker->is_out = true;
-                snprintf(striker->dismissal_info, sizeof(striker->dismissal_info), "%s by %s", dismissal_type, bowler->name);
-            }
-            gameState->striker_idx = -1; // mark out; UI must set incoming batsman
-
-            // Inlined ball update logic
-            gameState->balls_bowled_in_over++;
-            // per-ball stats
-            if (gameState->bowler_idx >= 0) {
-                Player *cb = &gameState->bowling_team->players[gameState->bowler_idx];
-                cb->match_balls_bowled++;
-                cb->match_wickets++; // wicket recorded above
-            }
-            if (striker) striker->balls_faced++;
-
-            if (gameState->balls_bowled_in_over >= 6) {
-                gameState->overs_completed++;
-                gameState->balls_bowled_in_over = 0;
-
-                // Rotate strike at end of over
-                int temp = gameState->striker_idx;
-                gameState->striker_idx = gameState->non_striker_idx;
-                gameState->non_striker_idx = temp;
-
-                // End of over: record last bowler and defer bowler selection to GUI
-                gameState->last_bowler_idx = gameState->bowler_idx;
-                gameState->awaiting_bowler_selection = true;
-                gameState->selected_bowler_idx = -1;
-                gameState->bowler_idx = -1;
-            }
-            // Log ball data
-            log_ball_data(gameState, 1, gameState->overs_completed, gameState->balls_bowled_in_over,
-                          striker, bowler, 0, OUTCOME_WICKET, NULL, NULL);
-            PushBallOutcome(-1); // Record wicket
-            currentPhase = PHASE_IDLE; // Back to idle if out
-        } else {
-            // 3. Determine shot placement
-            float angle = (float)(GetRandomValue(-135, 135)) * DEG2RAD;
-            // Distance is based on shot quality
-            // Adjusted dist_multiplier for realism and reduced 6s frequency
-            float dist_multiplier = 0.3f + (float)(final_shot_quality + 30) / 100.0f; // Range roughly 0.36 to 0.8
-            float dist = (fieldRadius * 0.8f) * dist_multiplier;
-            dist += (rand() % (int)(fieldRadius * 0.05f)); // Reduced random boost
-
-            ballTargetPos = (Vector2){ fieldCenter.x + cosf(angle) * dist, fieldCenter.y + sinf(angle) * dist };
-            ballPos = strikerEnd;
-            runsThisBall = 0;
-            currentPhase = PHASE_BALL_IN_FIELD; // Assume ball is in field initially
-
-            // 4. Check for Boundary
-            if (Vector2Distance(fieldCenter, ballTargetPos) > boundaryRadius) {
-                if (dist > boundaryRadius + 60) { // Increased difficulty for a direct hit for 6
-                    runsThisBall = 6;
-                    strcpy(outcomeMessage, "SIX!");
-                    outcomeMessageEndTime = GetTime() + 2.0;
-                    ballAltitude = 0.0f;
-                    ballVelocityY = 150.0f;
-                    PlaySound(sounds->six);
-                } else { // Bounces to boundary for 4
-                    runsThisBall = 4;
-                    strcpy(outcomeMessage, "FOUR!");
-                    outcomeMessageEndTime = GetTime() + 2.0;
-                    ballAltitude = 0.0f;
-                    ballVelocityY = 80.0f;
-                    PlaySound(sounds->four);
-                }
-                celebration_end_time = GetTime() + 2.0;
-                currentPhase = PHASE_BOUNDARY_ANIMATION;
+            animTimer += GetFrameTime();
+            if (animTimer >= 0.2f) { // 0.2-second swing
+                // The engine decides the contact, placement and fielder; the screen animates it and does the running
+                SimEngine *engine = GameplayEngine(gameState);
+                SimStatus status = sim_engine_step(engine);
+                const BallOutcome *ball = &engine->last;
                 animTimer = 0.0f;
-            } else {
-                // 5. Find nearest fielder if not a boundary
-                const Vector2 *setup = get_field_setup(gameState->fielding_setup, striker);
-                float nearestDist = 10000.0f;
-                nearestFielderIndex = -1;
-                
-                for (int i = 0; i < NUM_FIELDERS; i++) {
-                    Vector2 pos_normalized = setup[i];
-                    Vector2 fielderBasePos = { 
-                        fieldCenter.x + pos_normalized.x * (fieldRadius - 15),
-                        fieldCenter.y + pos_normalized.y * (fieldRadius - 15)
-                    };
-                    float d = Vector2Distance(fielderBasePos, ballTargetPos);
-                    if (d < nearestDist) {
-                        nearestDist = d;
-                        fielderRunPos = fielderBasePos;
-                        nearestFielderIndex = i;
-                    }
-                }
-
-                // 6. Determine outcome based on fielder distance
-                float fielding_skill = gameState->bowling_team->players[nearestFielderIndex].fielding_skill;
-                float effective_distance = nearestDist - (fielding_skill / 10.0f); // Good fielders cover more ground
-
-                if (effective_distance < 15.0f && final_shot_quality < 0) { // CATCH
+                runsThisBall = 0;
+                currentPhase = PHASE_IDLE;
+                if (status != SIM_STATUS_BALL_DONE && status != SIM_STATUS_NEED_RUNS) break; // A selection is still due
 
-                    gameState->wickets++;
-                    bowler->total_wickets++;
+                if (ball->type == OUTCOME_WICKET) {
                     strcpy(outcomeMessage, "WICKET!");
                     outcomeMessageEndTime = GetTime() + 2.0;
-                    PlaySound(sounds->edge);
+                    audio_clip_play(strcmp(ball->dismissal_method, "Bowled") == 0 ? &sounds->bowled_wicket : &sounds->edge);
+                    PushBallOutcome(-1); // Record wicket
+                    break;
+                }
+                if (status == SIM_STATUS_BALL_DONE && ball->type == OUTCOME_DOT) {
+                    playMissMessageEndTime = GetTime() + 1.5; // Show message for 1.5 seconds
+                    audio_clip_play(&sounds->dot_ball);
+                    PushBallOutcome(0); // Record dot ball
+                    break;
+                }
 
-                    // Mark striker as out and record dismissal info
-                    if (striker) {
-                        striker->is_out = true;
-                        snprintf(striker->dismissal_info, sizeof(striker->dismissal_info), "Caught by fielder %d off %s", nearestFielderIndex, bowler->name);
-                    }
+                const float fieldScale = fieldRadius - 15; // Normalized setup units to pixels
+                ballTargetPos = (Vector2){ fieldCenter.x + ball->shot_x * fieldScale, fieldCenter.y + ball->shot_y * fieldScale };
+                ballPos = strikerEnd;
 
-                    // Move to next batsman (placeholder index update)
-                    gameState->striker_idx = (gameState->striker_idx > gameState->non_striker_idx) ? gameState->striker_idx + 1 : gameState->non_striker_idx + 1;
-                    
-                    // Inlined ball update logic
-                    gameState->balls_bowled_in_over++;
-                    // per-ball stats
-                    if (gameState->bowler_idx >= 0) {
-                        Player *cb = &gameState->bowling_team->players[gameState->bowler_idx];
-                        cb->match_balls_bowled++;
-                        cb->match_wickets++;
-                    }
-                    // Count ball for striker even on wicket
-                    if (striker) striker->balls_faced++;
-
-                    if (gameState->balls_bowled_in_over >= 6) {
-                        gameState->overs_completed++;
-                        gameState->balls_bowled_in_over = 0;
-
-                        // Rotate strike at end of over
-                        int temp = gameState->striker_idx;
-                        gameState->striker_idx = gameState->non_striker_idx;
-                        gameState->non_striker_idx = temp;
-
-                        // End of over: record last bowler and defer bowler selection to GUI
-                        gameState->last_bowler_idx = gameState->bowler_idx;
-                        gameState->awaiting_bowler_selection = true;
-                        gameState->selected_bowler_idx = -1;
-                        gameState->bowler_idx = -1;
-                    }
-                    // Log ball data for catch
-                    // Check nearestFielderIndex validity
-                    Player *fielder_out = NULL;
-                    if (nearestFielderIndex >= 0 && nearestFielderIndex < gameState->bowling_team->num_players) {
-                        fielder_out = &gameState->bowling_team->players[nearestFielderIndex];
-                    }
-                                        log_ball_data(gameState, 1, gameState->overs_completed, gameState->balls_bowled_in_over,
-                                                      striker, bowler, 0, OUTCOME_WICKET, "Caught", fielder_out);
-                    PushBallOutcome(-1); // Record wicket (catch)
-                    showRunButton = true;
-                    // The ball will be stopped quickly, limiting runs. This is handled by the fielder reaching the ball.
-                } else { // In a gap
+                if (status == SIM_STATUS_BALL_DONE) { // Boundary, already scored
+                    runsThisBall = ball->runs;
+                    strcpy(outcomeMessage, runsThisBall == 6 ? "SIX!" : "FOUR!");
+                    outcomeMessageEndTime = GetTime() + 2.0;
+                    ballAltitude = 0.0f;
+                    ballVelocityY = (runsThisBall == 6) ? 150.0f : 80.0f;
+                    audio_clip_play(runsThisBall == 6 ? &sounds->six : &sounds->four);
+                    celebration_end_time = GetTime() + 2.0;
+                    PushBallOutcome(runsThisBall); // Record runs for boundary
+                    currentPhase = PHASE_BOUNDARY_ANIMATION;
+                } else { // In a gap, the runs are up to the player
+                    const Vector2 *setup = get_field_setup(gameState->fielding_setup, &gameState->batting_team->players[engine->last_striker]);
+                    nearestFielderIndex = ball->fielder_index;
+                    fielderRunPos = (Vector2){
+                        fieldCenter.x + setup[nearestFielderIndex].x * fieldScale,
+                        fieldCenter.y + setup[nearestFielderIndex].y * fieldScale
+                    };
                     showRunButton = true;
+                    currentPhase = PHASE_BALL_IN_FIELD;
                 }
             }
-        }
-        animTimer = 0.0f;
-    }
-    break;
+            break;
         case PHASE_BALL_IN_FIELD:
             // Animate ball and fielder moving to the target position
             {
@@ -1597,62 +1857,7 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
                             sprintf(outcomeMessage, "%d RUN%s", runsThisBall, (runsThisBall > 1) ? "S" : "");
                             outcomeMessageEndTime = GetTime() + 2.0;
                         }
-                        // Inlined ball update logic
-                        gameState->balls_bowled_in_over++;
-                        // Save current bowler before clearing for end-of-over handling
-                        Player *prevBowler = NULL;
-                        if (gameState->bowler_idx >= 0) prevBowler = &gameState->bowling_team->players[gameState->bowler_idx];
-
-                        if (gameState->balls_bowled_in_over >= 6) {
-                            gameState->overs_completed++;
-                            gameState->balls_bowled_in_over = 0;
-
-                            // Rotate strike at end of over
-                            int temp = gameState->striker_idx;
-                            gameState->striker_idx = gameState->non_striker_idx;
-                            gameState->non_striker_idx = temp;
-
-                            // End of over: record last bowler and defer bowler selection to GUI
-                            if (prevBowler) {
-                                for (int i = 0; i < gameState->bowling_team->num_players; ++i) {
-                                    if (&gameState->bowling_team->players[i] == prevBowler) {
-                                        gameState->last_bowler_idx = i;
-                                        break;
-                                    }
-                                }
-                            }
-                            gameState->awaiting_bowler_selection = true;
-                            gameState->selected_bowler_idx = -1;
-                            gameState->bowler_idx = -1;
-                        }
-                        // Update striker stats for the ball (capture current striker before any strike rotation)
-                        int facing_idx = gameState->striker_idx;
-                        Player *facing = NULL;
-                        if (facing_idx >= 0) facing = &gameState->batting_team->players[facing_idx];
-
-                        // Update bowler's per-match stats
-                        if (runsThisBall > 0 && prevBowler) prevBowler->match_runs_conceded += runsThisBall;
-                        if (prevBowler) prevBowler->match_balls_bowled++;
-
-                        // Update batsman stats
-                        if (facing) {
-                            facing->total_runs += runsThisBall;
-                            facing->balls_faced++;
-                        }
-                        gameState->total_runs += runsThisBall;
-
-                        // Rotate strike immediately on odd runs
-                        if (runsThisBall % 2 != 0) {
-                            int tmp = gameState->striker_idx;
-                            gameState->striker_idx = gameState->non_striker_idx;
-                            gameState->non_striker_idx = tmp;
-                        }
-
-                        // Log using the original facing batsman and previous bowler
-                        log_ball_data(gameState, 1, gameState->overs_completed, gameState->balls_bowled_in_over,
-                                      facing ? facing : NULL,
-                                      prevBowler ? prevBowler : NULL,
-                                      runsThisBall, (runsThisBall > 0) ? OUTCOME_RUNS : OUTCOME_DOT, NULL, NULL);
+                        sim_engine_decide(GameplayEngine(gameState), (SimDecision){ SIM_DECISION_RUNS, runsThisBall });
                         PushBallOutcome(runsThisBall); // Record runs for fielded ball
                         currentPhase = PHASE_IDLE; // Reset for the next ball
                     }
@@ -1684,63 +1889,6 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
 
             boundaryAnimTimer += GetFrameTime();
             if (boundaryAnimTimer >= 2.5f) { // Increased timer for better animation
-                // Inlined ball update logic
-                gameState->balls_bowled_in_over++;
-                // Save current bowler before clearing
-                Player *prevBowler = NULL;
-                if (gameState->bowler_idx >= 0) prevBowler = &gameState->bowling_team->players[gameState->bowler_idx];
-
-                if (gameState->balls_bowled_in_over >= 6) {
-                    gameState->overs_completed++;
-                    gameState->balls_bowled_in_over = 0;
-
-                    // Rotate strike at end of over
-                    int temp = gameState->striker_idx;
-                    gameState->striker_idx = gameState->non_striker_idx;
-                    gameState->non_striker_idx = temp;
-
-                    // End of over: record last bowler and defer bowler selection to GUI
-                    if (prevBowler) {
-                        for (int i = 0; i < gameState->bowling_team->num_players; ++i) {
-                            if (&gameState->bowling_team->players[i] == prevBowler) {
-                                gameState->last_bowler_idx = i;
-                                break;
-                            }
-                        }
-                    }
-                    gameState->awaiting_bowler_selection = true;
-                    gameState->selected_bowler_idx = -1;
-                    gameState->bowler_idx = -1;
-                }
-                // Update striker stats for the ball (capture current striker before any strike rotation)
-                int facing_idx = gameState->striker_idx;
-                Player *facing = NULL;
-                if (facing_idx >= 0) facing = &gameState->batting_team->players[facing_idx];
-
-                // Update bowler stats
-                if (runsThisBall > 0 && prevBowler) prevBowler->match_runs_conceded += runsThisBall;
-                if (prevBowler) prevBowler->match_balls_bowled++;
-
-                // Update batsman stats
-                if (facing) {
-                    facing->total_runs += runsThisBall;
-                    facing->balls_faced++;
-                }
-                gameState->total_runs += runsThisBall;
-
-                // Rotate strike immediately on odd runs
-                if (runsThisBall % 2 != 0) {
-                    int tmp = gameState->striker_idx;
-                    gameState->striker_idx = gameState->non_striker_idx;
-                    gameState->non_striker_idx = tmp;
-                }
-
-                // Log using the original facing batsman and previous bowler
-                log_ball_data(gameState, 1, gameState->overs_completed, gameState->balls_bowled_in_over,
-                              facing ? facing : NULL,
-                              prevBowler ? prevBowler : NULL,
-                              runsThisBall, OUTCOME_RUNS, NULL, NULL);
-                PushBallOutcome(runsThisBall); // Record runs for boundary
                 currentPhase = PHASE_IDLE; // Allow next ball
                 boundaryAnimTimer = 0.0f;
             }
@@ -1785,19 +1933,18 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
                 gameState->striker_idx = 0;
                 gameState->non_striker_idx = 1;
                 gameState->bowler_idx = -1; // Will be selected before first ball
+                gameState->awaiting_bowler_selection = true;
 
                 ballHistoryCount = 0; // Clear ball history for new inning
                 designated_wk_idx = -1; // Reset designated wicketkeeper
-                UnloadTexture(scorecardAssets.flagBatting);
-                UnloadTexture(scorecardAssets.flagBowling);
-                scorecardAssets.loaded = false; // Mark as not loaded for next inning
 
                 currentPhase = PHASE_IDLE;
             }
             break;
         case PHASE_MATCH_OVER:
             if (!match_over_sound_played) {
-                PlaySound(sounds->firecrackers);
+                audio_clip_play(&sounds->firecrackers);
+                RateFinishedMatch(gameState);
                 match_over_sound_played = true;
             }
             // Match is finished, do nothing until user exits
@@ -1813,8 +1960,8 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
     // --- Handle RUN button logic ---
     Rectangle runButton = { GetScreenWidth() - 180, GetScreenHeight() / 2 - 25, 160, 50 };
     if (showRunButton) {
-        DrawRectangleRec(runButton, ICC_GREEN);
-        DrawText("RUN!", runButton.x + 50, runButton.y + 15, 20, ICC_WHITE);
+        GfxDrawRectangleRec(runButton, ICC_GREEN);
+        GfxDrawText("RUN!", runButton.x + 50, runButton.y + 15, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), runButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             runsThisBall++;
 
@@ -1843,7 +1990,28 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
         // In playing mode, get the standard setup
         drawing_setup_positions = get_field_setup(gameState->fielding_setup, striker);
     }
+
+    // The ball is only drawn when it's actually in play (traveling or in field)
+    bool ballInPlay = (currentPhase == PHASE_BALL_TRAVEL || currentPhase == PHASE_BALL_IN_FIELD || currentPhase == PHASE_BATSMAN_RUNNING || currentPhase == PHASE_BOUNDARY_ANIMATION);
+
+    if (spectatorHost) {
+        const char *message = "";
+        if (GetTime() < outcomeMessageEndTime) message = outcomeMessage;
+        else if (GetTime() < playMissMessageEndTime) message = "Play and Miss!";
+        GameplayView view = {
+            .phase = currentPhase, .fieldCenter = fieldCenter, .fieldScale = fieldRadius - 15,
+            .fielders = drawing_setup_positions,
+            .striker = strikerAnimPos, .nonStriker = nonStrikerAnimPos, .bowler = bowlerAnimPos,
+            .runner = fielderRunPos, .ball = ballPos, .ballAltitude = ballAltitude,
+            .ballVisible = ballInPlay, .runnerVisible = (currentPhase == PHASE_BALL_IN_FIELD),
+            .message = message, .celebrating = GetTime() < celebration_end_time,
+        };
+        PublishToSpectators(gameState, &view);
+    }
     
+    // All figures from here to the ball are collected and drawn together
+    figure_batch_begin();
+
     // Pass the drawing_setup to the DrawFielders helper.
     // Also pass dragging_fielder_idx
     DrawFielders(drawing_setup_positions, gameState, fieldCenter, fieldRadius, dragging_fielder_idx);
@@ -1922,33 +2090,34 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
     }
 
     // Draw main players
-    DrawPlayerFigure(strikerAnimPos, ICC_BLUE, true, gameState->batting_team->name, currentPhase == PHASE_BATSMAN_SWING);
-    DrawText(striker->name, strikerAnimPos.x - MeasureText(striker->name, 10)/2, strikerAnimPos.y + 30, 10, ICC_WHITE);
+    QueuePlayerFigure(strikerAnimPos, ICC_BLUE, currentPhase == PHASE_BATSMAN_SWING ? FIGURE_POSE_SWINGING : FIGURE_POSE_BATTING, gameState->batting_team->name);
+    figure_batch_label(striker->name, strikerAnimPos.x, strikerAnimPos.y + 30, 10, ICC_WHITE);
 
-    DrawPlayerFigure(nonStrikerAnimPos, ICC_BLUE, true, gameState->batting_team->name, false);
-    DrawText(non_striker->name, nonStrikerAnimPos.x - MeasureText(non_striker->name, 10)/2, nonStrikerAnimPos.y + 30, 10, ICC_WHITE);
+    QueuePlayerFigure(nonStrikerAnimPos, ICC_BLUE, FIGURE_POSE_BATTING, gameState->batting_team->name);
+    figure_batch_label(non_striker->name, nonStrikerAnimPos.x, nonStrikerAnimPos.y + 30, 10, ICC_WHITE);
 
     if (currentPhase == PHASE_BALL_IN_FIELD) {
-        DrawPlayerFigure(fielderRunPos, ICC_RED, false, NULL, false);
+        QueuePlayerFigure(fielderRunPos, ICC_RED, FIGURE_POSE_FIELDING, NULL);
     }
 
-    DrawPlayerFigure(bowlerAnimPos, ICC_RED, false, gameState->bowling_team->name, false);
-    DrawText(bowler->name, bowlerAnimPos.x - MeasureText(bowler->name, 10)/2, bowlerAnimPos.y + 30, 10, ICC_WHITE);
+    QueuePlayerFigure(bowlerAnimPos, ICC_RED, FIGURE_POSE_FIELDING, gameState->bowling_team->name);
+    figure_batch_label(bowler->name, bowlerAnimPos.x, bowlerAnimPos.y + 30, 10, ICC_WHITE);
+    figure_batch_flush();
     
     // Draw ball
-    // The ball is only drawn when it's actually in play (traveling or in field)
-    if (currentPhase == PHASE_BALL_TRAVEL || currentPhase == PHASE_BALL_IN_FIELD || currentPhase == PHASE_BATSMAN_RUNNING || currentPhase == PHASE_BOUNDARY_ANIMATION) {
+    if (ballInPlay) {
         if (ballAltitude > 0) {
-            DrawCircle(ballPos.x, ballPos.y, 6, Fade(BLACK, 0.4f)); // Shadow
+            GfxDrawCircle(ballPos.x, ballPos.y, 6, Fade(BLACK, 0.4f)); // Shadow
         }
-        DrawCircle(ballPos.x, ballPos.y - ballAltitude, 6, ICC_WHITE); // Ball
+        GfxDrawCircle(ballPos.x, ballPos.y - ballAltitude, 6, ICC_WHITE); // Ball
     }
 
     // --- Draw Scoreboard on top ---
     DrawScorecardUI(gameState, state);
+    DrawFixtureTicker();
     
     if (currentPhase == PHASE_IDLE && !isGameOver) {
-        DrawText("Press [SPACE] to Bowl Next Ball", 20, GetScreenHeight() - 230, 20, ICC_YELLOW);
+        GfxDrawText("Press [SPACE] to Bowl Next Ball", 20, GetScreenHeight() - 230, 20, ICC_YELLOW);
     } else if (isGameOver) {
         if (gameState->inning_num == 1) {
             currentPhase = PHASE_INNINGS_BREAK;
@@ -1960,46 +2129,29 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
     // ... (rest of the drawing logic for players, etc.)
 
     // --- Draw Final Match/Innings Status ---
-    if (currentPhase == PHASE_INNINGS_BREAK) {
-        DrawText("INNINGS BREAK", GetScreenWidth()/2 - MeasureText("INNINGS BREAK", 40)/2, GetScreenHeight()/2 - 40, 40, ICC_YELLOW);
-        char targetText[64];
-        sprintf(targetText, "Target: %d", gameState->target);
-        DrawText(targetText, GetScreenWidth()/2 - MeasureText(targetText, 30)/2, GetScreenHeight()/2 + 10, 30, ICC_WHITE);
-        DrawText("Press [SPACE] to start 2nd Innings", GetScreenWidth()/2 - MeasureText("Press [SPACE] to start 2nd Innings", 20)/2, GetScreenHeight()/2 + 50, 20, ICC_WHITE);
-    } else if (currentPhase == PHASE_MATCH_OVER) {
-        char winnerText[128];
-        if (gameState->total_runs >= gameState->target) {
-            sprintf(winnerText, "%s won by %d wickets!", gameState->batting_team->name, 10 - gameState->wickets);
-        } else if (gameState->total_runs == gameState->target - 1) {
-            sprintf(winnerText, "Match Tied!");
-        } else {
-            sprintf(winnerText, "%s won by %d runs!", gameState->bowling_team->name, gameState->target - gameState->total_runs -1);
-        }
-        DrawText("MATCH OVER", GetScreenWidth()/2 - MeasureText("MATCH OVER", 50)/2, GetScreenHeight()/2 - 40, 50, ICC_GREEN);
-        DrawText(winnerText, GetScreenWidth()/2 - MeasureText(winnerText, 30)/2, GetScreenHeight()/2 + 20, 30, ICC_WHITE);
-    }
+    DrawInningsStatus(currentPhase, gameState, true);
     
     // Draw the back button
-    DrawRectangleRec(backButton, ICC_GRAY);
-    DrawText("Back to Menu", backButton.x + backButton.width/2 - MeasureText("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(backButton, ICC_GRAY);
+    GfxDrawText("Back to Menu", backButton.x + backButton.width/2 - text_cache_measure("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
 
     // Draw "Play and Miss!" message if active
     if (GetTime() < playMissMessageEndTime) {
-        DrawText("Play and Miss!", GetScreenWidth()/2 - MeasureText("Play and Miss!", 40)/2, GetScreenHeight()/2, 40, ICC_YELLOW);
+        GfxDrawText("Play and Miss!", GetScreenWidth()/2 - text_cache_measure("Play and Miss!", 40)/2, GetScreenHeight()/2, 40, ICC_YELLOW);
     }
     if (GetTime() < outcomeMessageEndTime) {
-        DrawText(outcomeMessage, GetScreenWidth()/2 - MeasureText(outcomeMessage, 40)/2, GetScreenHeight()/2, 40, ICC_YELLOW);
+        GfxDrawText(outcomeMessage, GetScreenWidth()/2 - text_cache_measure(outcomeMessage, 40)/2, GetScreenHeight()/2, 40, ICC_YELLOW);
     }
 
     // Draw overlay scorecards when requested
     if (showBattingScorecard) {
         Rectangle overlay = { 60, 80, GetScreenWidth() - 120, GetScreenHeight() - 160 };
-        DrawRectangleRounded(overlay, 0.12f, 8, (Color){10,10,10,230});
+        GfxDrawRectangleRounded(overlay, 0.12f, 8, (Color){10,10,10,230});
         DrawTextBold("Batting Scorecard", overlay.x + 20, overlay.y + 12, 22, ICC_WHITE);
         // Close button
         Rectangle closeBtn = { overlay.x + overlay.width - 40, overlay.y + 8, 32, 24 };
-        DrawRectangleRec(closeBtn, ICC_RED);
-        DrawText("X", closeBtn.x + 9, closeBtn.y + 3, 16, ICC_WHITE);
+        GfxDrawRectangleRec(closeBtn, ICC_RED);
+        GfxDrawText("X", closeBtn.x + 9, closeBtn.y + 3, 16, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), closeBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) showBattingScorecard = false;
 
         // --- Dynamic Column Width Calculation for Batting Scorecard ---
@@ -2008,7 +2160,7 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
 
         // Determine max width for each column from headers
         for (int i = 0; i < 5; i++) {
-            col_widths[i] = MeasureText(batting_headers[i], 18);
+            col_widths[i] = text_cache_measure(batting_headers[i], 18);
         }
 
         // Determine max width from player data
@@ -2016,28 +2168,28 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
             Player *p = &gameState->batting_team->players[i];
             
             // # column
-            float num_width = MeasureText(TextFormat("%2d.", i + 1), 18);
+            float num_width = text_cache_measure(TextFormat("%2d.", i + 1), 18);
             if (num_width > col_widths[0]) col_widths[0] = num_width;
 
             // Player column
-            float player_name_width = MeasureText(p->name, 18);
+            float player_name_width = text_cache_measure(p->name, 18);
             if (player_name_width > col_widths[1]) col_widths[1] = player_name_width;
 
             // Status column
             float status_width;
             if (p->is_out) {
-                status_width = MeasureText(p->dismissal_info, 16); // Use smaller font size for dismissal info
+                status_width = text_cache_measure(p->dismissal_info, 16); // Use smaller font size for dismissal info
             } else {
-                status_width = MeasureText("Not Out", 18);
+                status_width = text_cache_measure("Not Out", 18);
             }
             if (status_width > col_widths[2]) col_widths[2] = status_width;
 
             // Runs column
-            float runs_width = MeasureText(TextFormat("%d", p->total_runs), 18);
+            float runs_width = text_cache_measure(TextFormat("%d", p->total_runs), 18);
             if (runs_width > col_widths[3]) col_widths[3] = runs_width;
 
             // Balls column
-            float balls_width = MeasureText(TextFormat("%d", p->balls_faced), 18);
+            float balls_width = text_cache_measure(TextFormat("%d", p->balls_faced), 18);
             if (balls_width > col_widths[4]) col_widths[4] = balls_width;
         }
 
@@ -2065,36 +2217,36 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
 
         // Column headers
         int y_start = overlay.y + 48;
-        DrawText(batting_headers[0], col_x[0], y_start, 18, ICC_YELLOW);
-        DrawText(batting_headers[1], col_x[1], y_start, 18, ICC_YELLOW);
-        DrawText(batting_headers[2], col_x[2], y_start, 18, ICC_YELLOW);
-        DrawText(batting_headers[3], col_x[3], y_start, 18, ICC_YELLOW);
-        DrawText(batting_headers[4], col_x[4], y_start, 18, ICC_YELLOW);
-        DrawLine(overlay.x + 20, y_start + 24, overlay.x + overlay.width - 20, y_start + 24, ICC_YELLOW);
+        GfxDrawText(batting_headers[0], col_x[0], y_start, 18, ICC_YELLOW);
+        GfxDrawText(batting_headers[1], col_x[1], y_start, 18, ICC_YELLOW);
+        GfxDrawText(batting_headers[2], col_x[2], y_start, 18, ICC_YELLOW);
+        GfxDrawText(batting_headers[3], col_x[3], y_start, 18, ICC_YELLOW);
+        GfxDrawText(batting_headers[4], col_x[4], y_start, 18, ICC_YELLOW);
+        GfxDrawLine(overlay.x + 20, y_start + 24, overlay.x + overlay.width - 20, y_start + 24, ICC_YELLOW);
 
         // List batting players
         for (int i = 0; i < gameState->batting_team->num_players; ++i) {
             Player *p = &gameState->batting_team->players[i];
             int y_pos = y_start + 30 + i * 24;
-            DrawText(TextFormat("%2d.", i + 1), col_x[0], y_pos, 18, ICC_WHITE);
-            DrawText(p->name, col_x[1], y_pos, 18, ICC_WHITE);
+            GfxDrawText(TextFormat("%2d.", i + 1), col_x[0], y_pos, 18, ICC_WHITE);
+            GfxDrawText(p->name, col_x[1], y_pos, 18, ICC_WHITE);
             if (p->is_out) {
-                DrawText(p->dismissal_info, col_x[2], y_pos, 16, ICC_GRAY);
+                GfxDrawText(p->dismissal_info, col_x[2], y_pos, 16, ICC_GRAY);
             } else {
-                DrawText("Not Out", col_x[2], y_pos, 18, ICC_GREEN);
+                GfxDrawText("Not Out", col_x[2], y_pos, 18, ICC_GREEN);
             }
-            DrawText(TextFormat("%d", p->total_runs), col_x[3], y_pos, 18, ICC_WHITE);
-            DrawText(TextFormat("%d", p->balls_faced), col_x[4], y_pos, 18, ICC_WHITE);
+            GfxDrawText(TextFormat("%d", p->total_runs), col_x[3], y_pos, 18, ICC_WHITE);
+            GfxDrawText(TextFormat("%d", p->balls_faced), col_x[4], y_pos, 18, ICC_WHITE);
         }
     }
 
     if (showBowlingScorecard) {
         Rectangle overlay = { 60, 80, GetScreenWidth() - 120, GetScreenHeight() - 160 };
-        DrawRectangleRounded(overlay, 0.12f, 8, (Color){10,10,10,230});
+        GfxDrawRectangleRounded(overlay, 0.12f, 8, (Color){10,10,10,230});
         DrawTextBold("Bowling Scorecard", overlay.x + 20, overlay.y + 12, 22, ICC_WHITE);
         Rectangle closeBtn = { overlay.x + overlay.width - 40, overlay.y + 8, 32, 24 };
-        DrawRectangleRec(closeBtn, ICC_RED);
-        DrawText("X", closeBtn.x + 9, closeBtn.y + 3, 16, ICC_WHITE);
+        GfxDrawRectangleRec(closeBtn, ICC_RED);
+        GfxDrawText("X", closeBtn.x + 9, closeBtn.y + 3, 16, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), closeBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) showBowlingScorecard = false;
 
         // --- Dynamic Column Width Calculation for Bowling Scorecard ---
@@ -2103,7 +2255,7 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
 
         // Determine max width for each column from headers
         for (int i = 0; i < 5; i++) {
-            col_widths[i] = MeasureText(bowling_headers[i], 18);
+            col_widths[i] = text_cache_measure(bowling_headers[i], 18);
         }
 
         // Determine max width from player data
@@ -2111,23 +2263,23 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
             Player *p = &gameState->bowling_team->players[i];
             if (p->bowling_skill > 0) { // Only consider players who can bowl
                 // # column
-                float num_width = MeasureText(TextFormat("%2d.", i + 1), 18);
+                float num_width = text_cache_measure(TextFormat("%2d.", i + 1), 18);
                 if (num_width > col_widths[0]) col_widths[0] = num_width;
 
                 // Player column
-                float player_name_width = MeasureText(p->name, 18);
+                float player_name_width = text_cache_measure(p->name, 18);
                 if (player_name_width > col_widths[1]) col_widths[1] = player_name_width;
 
                 // Overs column
-                float overs_width = MeasureText(TextFormat("%d", p->match_balls_bowled / 6), 18);
+                float overs_width = text_cache_measure(TextFormat("%d", p->match_balls_bowled / 6), 18);
                 if (overs_width > col_widths[2]) col_widths[2] = overs_width;
 
                 // Runs column
-                float runs_width = MeasureText(TextFormat("%d", p->match_runs_conceded), 18);
+                float runs_width = text_cache_measure(TextFormat("%d", p->match_runs_conceded), 18);
                 if (runs_width > col_widths[3]) col_widths[3] = runs_width;
 
                 // Wickets column
-                float wickets_width = MeasureText(TextFormat("%d", p->match_wickets), 18);
+                float wickets_width = text_cache_measure(TextFormat("%d", p->match_wickets), 18);
                 if (wickets_width > col_widths[4]) col_widths[4] = wickets_width;
             }
         }
@@ -2156,48 +2308,191 @@ static void UpdateDrawGameplayScreen(GuiState *state, GameState *gameState, Game
 
         // Column headers
         int y_start = overlay.y + 48;
-        DrawText(bowling_headers[0], col_x[0], y_start, 18, ICC_YELLOW);
-        DrawText(bowling_headers[1], col_x[1], y_start, 18, ICC_YELLOW);
-        DrawText(bowling_headers[2], col_x[2], y_start, 18, ICC_YELLOW);
-        DrawText(bowling_headers[3], col_x[3], y_start, 18, ICC_YELLOW);
-        DrawText(bowling_headers[4], col_x[4], y_start, 18, ICC_YELLOW);
-        DrawLine(overlay.x + 20, y_start + 24, overlay.x + overlay.width - 20, y_start + 24, ICC_YELLOW);
+        GfxDrawText(bowling_headers[0], col_x[0], y_start, 18, ICC_YELLOW);
+        GfxDrawText(bowling_headers[1], col_x[1], y_start, 18, ICC_YELLOW);
+        GfxDrawText(bowling_headers[2], col_x[2], y_start, 18, ICC_YELLOW);
+        GfxDrawText(bowling_headers[3], col_x[3], y_start, 18, ICC_YELLOW);
+        GfxDrawText(bowling_headers[4], col_x[4], y_start, 18, ICC_YELLOW);
+        GfxDrawLine(overlay.x + 20, y_start + 24, overlay.x + overlay.width - 20, y_start + 24, ICC_YELLOW);
 
         // List bowling players
         for (int i = 0; i < gameState->bowling_team->num_players; ++i) {
             Player *p = &gameState->bowling_team->players[i];
             if (p->bowling_skill > 0) { // Only show players who can bowl
                 int y_pos = y_start + 30 + i * 24;
-                DrawText(TextFormat("%2d.", i + 1), col_x[0], y_pos, 18, ICC_WHITE);
-                DrawText(p->name, col_x[1], y_pos, 18, ICC_WHITE);
-                DrawText(TextFormat("%d", p->match_balls_bowled / 6), col_x[2], y_pos, 18, ICC_WHITE);
-                DrawText(TextFormat("%d", p->match_runs_conceded), col_x[3], y_pos, 18, ICC_WHITE);
-                DrawText(TextFormat("%d", p->match_wickets), col_x[4], y_pos, 18, ICC_WHITE);
+                GfxDrawText(TextFormat("%2d.", i + 1), col_x[0], y_pos, 18, ICC_WHITE);
+                GfxDrawText(p->name, col_x[1], y_pos, 18, ICC_WHITE);
+                GfxDrawText(TextFormat("%d", p->match_balls_bowled / 6), col_x[2], y_pos, 18, ICC_WHITE);
+                GfxDrawText(TextFormat("%d", p->match_runs_conceded), col_x[3], y_pos, 18, ICC_WHITE);
+                GfxDrawText(TextFormat("%d", p->match_wickets), col_x[4], y_pos, 18, ICC_WHITE);
             }
         }
     }
-    EndDrawing();
+
+    // Current detail level, chosen by the frame time governor
+    static TextSlot lodSlot;
+    int frameTenthsMs = (int)(lod_average_frame_ms() * 10.0f);
+    if (text_slot_changed(&lodSlot, NULL, lod_level(), frameTenthsMs, 0)) {
+        snprintf(lodSlot.text, sizeof(lodSlot.text), "Detail: %s (%d.%d ms)", lod_level_name(lod_level()), frameTenthsMs / 10, frameTenthsMs % 10);
+    }
+    text_slot_draw(&lodSlot, 90, 20, 16, TEXT_STYLE_PLAIN, ICC_WHITE);
+    GfxEndDrawing();
 }
 
-// Case-insensitive string search (strstr)
-static const char* stristr(const char* haystack, const char* needle) {
-    if (!*needle) return haystack;
-    for (; *haystack; ++haystack) {
-        if (toupper((unsigned char)*haystack) == toupper((unsigned char)*needle)) {
-            const char* h, *n;
-            for (h = haystack, n = needle; *h && *n; ++h, ++n) {
-                if (toupper((unsigned char)*h) != toupper((unsigned char)*n)) break;
-            }
-            if (!*n) return haystack;
+// Puts a replicated player into one of two alternating shell slots. The scoreboard text is keyed
+// on the player's address, so a new name has to arrive at a new address to be redrawn.
+static int ShellPlayer(Team *team, int firstSlot, int *current, const char *name, int runs, int balls) {
+    if (strcmp(team->players[*current].name, name) != 0) {
+        *current = (*current == firstSlot) ? firstSlot + 1 : firstSlot;
+        snprintf(team->players[*current].name, sizeof(team->players[*current].name), "%s", name);
+    }
+    team->players[*current].total_runs = runs;
+    team->players[*current].balls_faced = balls;
+    return *current;
+}
+
+// Draws the match a host is playing, from what it sends. Nothing is simulated here.
+static void UpdateDrawSpectatorScreen(GuiState *state, GameSounds *sounds) {
+    static Team battingShell, bowlingShell;
+    static GameState shell;
+    static int strikerSlot = 0, nonStrikerSlot = 2, bowlerSlot = 0;
+    static int lastBallCount = -1, lastPhase = -1;
+
+    double now = GetTime();
+    spectator_viewer_poll(spectatorViewer, now);
+
+    Vector2 fieldCenter = { GetScreenWidth() / 2.0f, 120 + (GetScreenHeight() - 220) / 2.0f };
+    float fieldRadius = (GetScreenHeight() - 240) / 2.0f;
+    if (fieldRadius > (GetScreenWidth() - 100) / 2.0f) fieldRadius = (GetScreenWidth() - 100) / 2.0f;
+    const float fieldScale = fieldRadius - 15;
+
+    ReplicaState view;
+    bool live = spectator_viewer_state(spectatorViewer, now, &view);
+
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_GRAY);
+    DrawStadium(fieldCenter, fieldRadius, live && view.celebrating);
+
+    if (!live) {
+        const char *status = spectator_viewer_status(spectatorViewer) == SPECTATOR_DISCONNECTED ? "Host not reachable, retrying..." : "Connecting to host...";
+        GfxDrawText(status, GetScreenWidth()/2 - text_cache_measure(status, 30)/2, 40, 30, ICC_WHITE);
+        GfxDrawText("Press [ESC] to quit", 20, GetScreenHeight() - 30, 16, ICC_WHITE);
+        GfxEndDrawing();
+        return;
+    }
+
+    // Sounds follow the host's: one per delivery outcome, the run-up and the final firecrackers
+    if (lastBallCount != -1 && view.ball_count != lastBallCount && view.history_count > 0) {
+        if (view.last_ball < 0) audio_clip_play(&sounds->edge);
+        else if (view.last_ball == 6) audio_clip_play(&sounds->six);
+        else if (view.last_ball == 4) audio_clip_play(&sounds->four);
+        else if (view.last_ball == 0) audio_clip_play(&sounds->dot_ball);
+    }
+    if (view.phase != lastPhase && lastPhase != -1) {
+        if (view.phase == PHASE_BOWLER_RUNUP) audio_clip_play(&sounds->bowling);
+        else if (view.phase == PHASE_MATCH_OVER) audio_clip_play(&sounds->firecrackers);
+    }
+    lastBallCount = view.ball_count;
+    lastPhase = view.phase;
+
+    // A GameState just complete enough for the shared scoreboard and fielder drawing
+    snprintf(battingShell.name, sizeof(battingShell.name), "%s", view.batting_team);
+    snprintf(bowlingShell.name, sizeof(bowlingShell.name), "%s", view.bowling_team);
+    battingShell.num_players = 4;
+    bowlingShell.num_players = 3;
+    shell.batting_team = &battingShell;
+    shell.bowling_team = &bowlingShell;
+    shell.striker_idx = view.striker[0] ? ShellPlayer(&battingShell, 0, &strikerSlot, view.striker, view.striker_runs, view.striker_balls) : -1;
+    shell.non_striker_idx = view.non_striker[0] ? ShellPlayer(&battingShell, 2, &nonStrikerSlot, view.non_striker, view.non_striker_runs, view.non_striker_balls) : -1;
+    shell.bowler_idx = view.bowler[0] ? ShellPlayer(&bowlingShell, 0, &bowlerSlot, view.bowler, 0, 0) : -1;
+    if (shell.bowler_idx >= 0) {
+        Player *bowler = &bowlingShell.players[shell.bowler_idx];
+        bowler->match_balls_bowled = view.bowler_balls;
+        bowler->match_runs_conceded = view.bowler_runs;
+        bowler->match_wickets = view.bowler_wickets;
+    }
+    snprintf(bowlingShell.players[2].name, sizeof(bowlingShell.players[2].name), "%s", view.keeper);
+    bowlingShell.players[2].is_wicketkeeper = true;
+    shell.total_runs = view.total_runs;
+    shell.wickets = view.wickets;
+    shell.overs_completed = view.overs_completed;
+    shell.balls_bowled_in_over = view.balls_in_over;
+    shell.max_overs = view.max_overs;
+    shell.target = view.target;
+    shell.inning_num = view.inning_num;
+    shell.current_powerplay = view.powerplay;
+    shell.gameplay_mode = GAMEPLAY_MODE_PLAYING;
+
+    Vector2 fielders[REPLICA_FIELDERS];
+    for (int i = 0; i < REPLICA_FIELDERS; i++) fielders[i] = (Vector2){ view.fielders[i].x, view.fielders[i].y };
+#define TO_SCREEN(pt) ((Vector2){ fieldCenter.x + (pt).x * fieldScale, fieldCenter.y + (pt).y * fieldScale })
+    Vector2 strikerPos = TO_SCREEN(view.striker_pos);
+    Vector2 nonStrikerPos = TO_SCREEN(view.non_striker_pos);
+    Vector2 bowlerPos = TO_SCREEN(view.bowler_pos);
+    Vector2 runnerPos = TO_SCREEN(view.runner_pos);
+    Vector2 ballPos = TO_SCREEN(view.ball_pos);
+#undef TO_SCREEN
+    float ballAltitude = view.ball_altitude * fieldScale;
+
+    // Selection overlays stay on the host; the field keeps its last layout meanwhile
+    figure_batch_begin();
+    DrawFielders(fielders, &shell, fieldCenter, fieldRadius, -1);
+    if (shell.striker_idx >= 0) {
+        QueuePlayerFigure(strikerPos, ICC_BLUE, view.phase == PHASE_BATSMAN_SWING ? FIGURE_POSE_SWINGING : FIGURE_POSE_BATTING, view.batting_team);
+        figure_batch_label(view.striker, strikerPos.x, strikerPos.y + 30, 10, ICC_WHITE);
+    }
+    if (shell.non_striker_idx >= 0) {
+        QueuePlayerFigure(nonStrikerPos, ICC_BLUE, FIGURE_POSE_BATTING, view.batting_team);
+        figure_batch_label(view.non_striker, nonStrikerPos.x, nonStrikerPos.y + 30, 10, ICC_WHITE);
+    }
+    if (view.runner_visible) {
+        QueuePlayerFigure(runnerPos, ICC_RED, FIGURE_POSE_FIELDING, NULL);
+    }
+    if (shell.bowler_idx >= 0) {
+        QueuePlayerFigure(bowlerPos, ICC_RED, FIGURE_POSE_FIELDING, view.bowling_team);
+        figure_batch_label(view.bowler, bowlerPos.x, bowlerPos.y + 30, 10, ICC_WHITE);
+    }
+    figure_batch_flush();
+
+    if (view.ball_visible) {
+        if (ballAltitude > 0) {
+            GfxDrawCircle(ballPos.x, ballPos.y, 6, Fade(BLACK, 0.4f)); // Shadow
         }
+        GfxDrawCircle(ballPos.x, ballPos.y - ballAltitude, 6, ICC_WHITE);
     }
-    return NULL;
+
+    // The scoreboard's ball dots come from the screen's history, so lend it the host's
+    int savedHistory[MAX_BALL_HISTORY];
+    int savedHistoryCount = ballHistoryCount;
+    memcpy(savedHistory, ballHistory, sizeof(savedHistory));
+    ballHistoryCount = view.history_count < MAX_BALL_HISTORY ? view.history_count : MAX_BALL_HISTORY;
+    for (int i = 0; i < ballHistoryCount; i++) ballHistory[i] = view.history[i];
+    DrawScorecardUI(&shell, state);
+    memcpy(ballHistory, savedHistory, sizeof(savedHistory));
+    ballHistoryCount = savedHistoryCount;
+
+    if (view.waiting == REPLICA_WAIT_BOWLER) {
+        GfxDrawText("Host is choosing the next bowler...", 20, GetScreenHeight() - 230, 20, ICC_YELLOW);
+    } else if (view.waiting == REPLICA_WAIT_BATSMAN) {
+        GfxDrawText("Host is choosing the next batsman...", 20, GetScreenHeight() - 230, 20, ICC_YELLOW);
+    }
+    if (view.message[0]) {
+        GfxDrawText(view.message, GetScreenWidth()/2 - text_cache_measure(view.message, 40)/2, GetScreenHeight()/2, 40, ICC_YELLOW);
+    }
+    DrawInningsStatus((GameplayPhase)view.phase, &shell, false);
+
+    const char *status = TextFormat("SPECTATING%s  |  %.1f KB received  |  Press [ESC] to quit",
+                                    spectator_viewer_status(spectatorViewer) == SPECTATOR_LIVE ? "" : " (reconnecting)",
+                                    spectator_viewer_bytes_received(spectatorViewer) / 1024.0);
+    GfxDrawText(status, 20, 20, 18, ICC_WHITE);
+
+    GfxEndDrawing();
 }
 
 // Helper function to draw text with a bold effect
 static void DrawTextBold(const char *text, int posX, int posY, int fontSize, Color color) {
-    DrawText(text, posX + 1, posY + 1, fontSize, color); // Draw a slight shadow to create a bold effect
-    DrawText(text, posX, posY, fontSize, color);
+    // The glyph run includes the one pixel shadow, dropped at lower detail levels
+    text_cache_draw(text, posX, posY, fontSize, lod_settings()->text_shadow ? TEXT_STYLE_BOLD : TEXT_STYLE_PLAIN, color);
 }
 
 static void UpdateDrawUmpiresScreen(GuiState *state) {
@@ -2205,7 +2500,9 @@ static void UpdateDrawUmpiresScreen(GuiState *state) {
     static Umpire *umpires = NULL;
     static int num_umpires = 0;
     static bool needs_refresh = true;
-    static Vector2 scroll = { 0.0f, 0.0f };
+    static ListView list = { 0 };
+    static SearchIndex nameSearch = { 0 }, countrySearch = { 0 };
+    static bool filter_dirty = true; // Data changed, the filtered rows must be rebuilt
     static int editIndex = -1; // -1 means not editing, >= 0 is the index of the umpire being edited
 
     // Input boxes for adding/editing and filtering
@@ -2240,6 +2537,16 @@ static void UpdateDrawUmpiresScreen(GuiState *state) {
         if (umpires) free(umpires);
         umpires = load_umpires(&num_umpires);
         needs_refresh = false;
+
+        search_index_clear(&nameSearch);
+        search_index_clear(&countrySearch);
+        for (int i = 0; i < num_umpires; i++) {
+            search_index_add(&nameSearch, umpires[i].name);
+            search_index_add(&countrySearch, umpires[i].country);
+        }
+        search_index_finish(&nameSearch);
+        search_index_finish(&countrySearch);
+        filter_dirty = true;
     }
 
     HandleTextBox(&nameBox);
@@ -2304,110 +2611,110 @@ static void UpdateDrawUmpiresScreen(GuiState *state) {
     }
 
     // --- Drawing ---
-    BeginDrawing();
-    ClearBackground(ICC_BG);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
 
-    DrawTextBold("Manage Umpires", GetScreenWidth()/2 - MeasureText("Manage Umpires", 40)/2, 10, 40, ICC_GRAY);
+    DrawTextBold("Manage Umpires", GetScreenWidth()/2 - text_cache_measure("Manage Umpires", 40)/2, 10, 40, ICC_GRAY);
     
     // --- Draw Search and Filter UI ---
     DrawTextBold("Search Name:", searchBox.bounds.x, searchBox.bounds.y - 15, 10, ICC_GRAY);
-    DrawRectangleRec(searchBox.bounds, ICC_WHITE); DrawRectangleLinesEx(searchBox.bounds, 1, ICC_GRAY);
+    GfxDrawRectangleRec(searchBox.bounds, ICC_WHITE); GfxDrawRectangleLinesEx(searchBox.bounds, 1, ICC_GRAY);
     DrawTextBold(searchBox.text, searchBox.bounds.x + 5, searchBox.bounds.y + 5, 20, ICC_WHITE);
 
     DrawTextBold("Filter Country:", filterCountryBox.bounds.x, filterCountryBox.bounds.y - 15, 10, ICC_GRAY);
-    DrawRectangleRec(filterCountryBox.bounds, ICC_WHITE); DrawRectangleLinesEx(filterCountryBox.bounds, 1, ICC_GRAY);
+    GfxDrawRectangleRec(filterCountryBox.bounds, ICC_WHITE); GfxDrawRectangleLinesEx(filterCountryBox.bounds, 1, ICC_GRAY);
     DrawTextBold(filterCountryBox.text, filterCountryBox.bounds.x + 5, filterCountryBox.bounds.y + 5, 20, ICC_WHITE);
 
     DrawTextBold("Matches >=", filterMatchesBox.bounds.x, filterMatchesBox.bounds.y - 15, 10, ICC_GRAY);
-    DrawRectangleRec(filterMatchesBox.bounds, ICC_WHITE); DrawRectangleLinesEx(filterMatchesBox.bounds, 1, ICC_GRAY);
+    GfxDrawRectangleRec(filterMatchesBox.bounds, ICC_WHITE); GfxDrawRectangleLinesEx(filterMatchesBox.bounds, 1, ICC_GRAY);
     DrawTextBold(filterMatchesBox.text, filterMatchesBox.bounds.x + 5, filterMatchesBox.bounds.y + 5, 20, ICC_WHITE);
 
     DrawTextBold("Year >=", filterYearBox.bounds.x, filterYearBox.bounds.y - 15, 10, ICC_GRAY);
-    DrawRectangleRec(filterYearBox.bounds, ICC_WHITE); DrawRectangleLinesEx(filterYearBox.bounds, 1, ICC_GRAY);
+    GfxDrawRectangleRec(filterYearBox.bounds, ICC_WHITE); GfxDrawRectangleLinesEx(filterYearBox.bounds, 1, ICC_GRAY);
     DrawTextBold(filterYearBox.text, filterYearBox.bounds.x + 5, filterYearBox.bounds.y + 5, 20, ICC_WHITE);
 
-    DrawRectangleRec(clearFiltersButton, ICC_GRAY);
-    DrawTextBold("Clear", clearFiltersButton.x + clearFiltersButton.width/2 - MeasureText("Clear", 10)/2, clearFiltersButton.y + 8, 10, ICC_WHITE);
+    GfxDrawRectangleRec(clearFiltersButton, ICC_GRAY);
+    DrawTextBold("Clear", clearFiltersButton.x + clearFiltersButton.width/2 - text_cache_measure("Clear", 10)/2, clearFiltersButton.y + 8, 10, ICC_WHITE);
 
     // --- Filtering Logic ---
-    Umpire* filtered_umpires = NULL;
-    int num_filtered_umpires = 0;
-    int* original_indices = NULL;
-
-    if (num_umpires > 0) {
-        filtered_umpires = malloc(num_umpires * sizeof(Umpire));
-        original_indices = malloc(num_umpires * sizeof(int));
+    // Indices into umpires[], rebuilt only when a filter or the data changes
+    static int *original_indices = NULL;
+    static int num_filtered_umpires = 0;
+    static char filtered_for[512] = "";
+    static float max_name_width = 0, max_country_width = 0; // Column widths, see GrowColumnWidth
+    char filters[512];
+    snprintf(filters, sizeof(filters), "%s\x1f%s\x1f%s\x1f%s", searchBox.text, filterCountryBox.text, filterMatchesBox.text, filterYearBox.text);
+
+    if (filter_dirty || strcmp(filtered_for, filters) != 0) {
         int min_matches = atoi(filterMatchesBox.text);
         int min_year = atoi(filterYearBox.text);
-
-        for (int i = 0; i < num_umpires; i++) {
-            bool pass = true;
-            if (searchBox.charCount > 0 && !stristr(umpires[i].name, searchBox.text)) pass = false;
-            if (filterCountryBox.charCount > 0 && !stristr(umpires[i].country, filterCountryBox.text)) pass = false;
-            if (min_matches > 0 && umpires[i].matches_umpired < min_matches) pass = false;
-            if (min_year > 0 && umpires[i].since_year < min_year) pass = false;
-
-            if (pass) {
-                filtered_umpires[num_filtered_umpires] = umpires[i];
-                original_indices[num_filtered_umpires] = i;
-                num_filtered_umpires++;
-            }
+        int num_by_name = 0, num_by_country = 0;
+        const int *by_name = search_index_query(&nameSearch, searchBox.text, &num_by_name);
+        const int *by_country = search_index_query(&countrySearch, filterCountryBox.text, &num_by_country);
+
+        original_indices = realloc(original_indices, (num_umpires + 1) * sizeof(int));
+        num_filtered_umpires = 0;
+
+        // Both result lists are ascending, so they intersect in a single merge pass
+        for (int n = 0, c = 0; n < num_by_name && c < num_by_country; ) {
+            if (by_name[n] < by_country[c]) { n++; continue; }
+            if (by_name[n] > by_country[c]) { c++; continue; }
+            int i = by_name[n];
+            n++; c++;
+            if (min_matches > 0 && umpires[i].matches_umpired < min_matches) continue;
+            if (min_year > 0 && umpires[i].since_year < min_year) continue;
+            original_indices[num_filtered_umpires++] = i;
         }
+
+        strcpy(filtered_for, filters);
+        filter_dirty = false;
+
+        // Column widths restart from the headers along with the rows
+        max_name_width = text_cache_measure("Name", 20);
+        max_country_width = text_cache_measure("Country", 20);
     }
 
     // Draw input section
     DrawTextBold("Name", nameBox.bounds.x, nameBox.bounds.y - 20, 10, ICC_GRAY);
-    DrawRectangleRec(nameBox.bounds, ICC_GRAY); DrawTextBold(nameBox.text, nameBox.bounds.x + 5, nameBox.bounds.y + 8, 20, ICC_WHITE);
+    GfxDrawRectangleRec(nameBox.bounds, ICC_GRAY); DrawTextBold(nameBox.text, nameBox.bounds.x + 5, nameBox.bounds.y + 8, 20, ICC_WHITE);
     DrawTextBold("Country", countryBox.bounds.x, countryBox.bounds.y - 20, 10, ICC_GRAY);
-    DrawRectangleRec(countryBox.bounds, ICC_GRAY); DrawTextBold(countryBox.text, countryBox.bounds.x + 5, countryBox.bounds.y + 8, 20, ICC_WHITE);
+    GfxDrawRectangleRec(countryBox.bounds, ICC_GRAY); DrawTextBold(countryBox.text, countryBox.bounds.x + 5, countryBox.bounds.y + 8, 20, ICC_WHITE);
     DrawTextBold("Since (Year)", yearBox.bounds.x, yearBox.bounds.y - 20, 10, ICC_GRAY);
-    DrawRectangleRec(yearBox.bounds, ICC_GRAY); DrawTextBold(yearBox.text, yearBox.bounds.x + 5, yearBox.bounds.y + 8, 20, ICC_WHITE);
+    GfxDrawRectangleRec(yearBox.bounds, ICC_GRAY); DrawTextBold(yearBox.text, yearBox.bounds.x + 5, yearBox.bounds.y + 8, 20, ICC_WHITE);
     DrawTextBold("Matches", matchesBox.bounds.x, matchesBox.bounds.y - 20, 10, ICC_GRAY);
     const char* buttonText = (editIndex == -1) ? "Add New Umpire" : "Save Changes";
     // Draw "Add" or "Save" button based on edit mode
-    DrawRectangleRec(addButton, (editIndex == -1) ? ICC_GREEN : ICC_BLUE);
-    DrawTextBold(buttonText, addButton.x + addButton.width/2 - MeasureText(buttonText, 20)/2, addButton.y + 5, 20, ICC_WHITE);
+    GfxDrawRectangleRec(addButton, (editIndex == -1) ? ICC_GREEN : ICC_BLUE);
+    DrawTextBold(buttonText, addButton.x + addButton.width/2 - text_cache_measure(buttonText, 20)/2, addButton.y + 5, 20, ICC_WHITE);
     if (editIndex != -1) {
-        DrawRectangleRec(cancelEditButton, ICC_RED);
-        DrawTextBold("Cancel", cancelEditButton.x + cancelEditButton.width/2 - MeasureText("Cancel", 15)/2, cancelEditButton.y + 5, 15, ICC_WHITE);
+        GfxDrawRectangleRec(cancelEditButton, ICC_RED);
+        DrawTextBold("Cancel", cancelEditButton.x + cancelEditButton.width/2 - text_cache_measure("Cancel", 15)/2, cancelEditButton.y + 5, 15, ICC_WHITE);
     }
 
     // Draw list of current umpires
-    DrawRectangle(20, 150, GetScreenWidth() - 40, GetScreenHeight() - 210, DARKBROWN);
+    GfxDrawRectangle(20, 150, GetScreenWidth() - 40, GetScreenHeight() - 210, DARKBROWN);
     DrawTextBold("Current Umpires", 30, 160, 20, ICC_YELLOW);
-    DrawLine(30, 185, GetScreenWidth() - 50, 185, ICC_YELLOW);
+    GfxDrawLine(30, 185, GetScreenWidth() - 50, 185, ICC_YELLOW);
     
     // Define the scrollable view area
-    Rectangle view = { 20, 188, GetScreenWidth() - 40, GetScreenHeight() - 250 }; // The visible panel
-    const float itemHeight = 25.0f;
-    const float headerHeight = 40.0f;
-    // Calculate the total height of the content
-    const float contentHeight = (num_filtered_umpires * itemHeight) + headerHeight;
-
-    // Handle mouse wheel scrolling if content is larger than view
-    if (contentHeight > view.height && CheckCollisionPointRec(GetMousePosition(), view)) {
-        scroll.y += GetMouseWheelMove() * itemHeight; // Scroll one item at a time
-        if (scroll.y > 0) scroll.y = 0; // Clamp top
-        if (scroll.y < view.height - contentHeight) scroll.y = view.height - contentHeight; // Clamp bottom
-    }
+    list.bounds = (Rectangle){ 20, 188, GetScreenWidth() - 40, GetScreenHeight() - 250 }; // The visible panel
+    list.itemHeight = 25.0f;
+    list.headerHeight = 40.0f;
+    UpdateListView(&list, num_filtered_umpires);
+    Rectangle view = list.bounds;
 
     // Start clipping the drawing to the view rectangle
-    BeginScissorMode(view.x, view.y, view.width, view.height);
+    GfxBeginScissorMode(view.x, view.y, view.width, view.height);
 
     if (num_filtered_umpires > 0) {
         const float editButtonWidth = 60;
         const float deleteButtonWidth = 70;
         const float buttonHeight = 20;
         // --- DYNAMIC COLUMN WIDTH CALCULATION ---
-        // 1. Find the maximum width for each column to ensure perfect alignment
-        float max_name_width = MeasureText("Name", 20);
-        float max_country_width = MeasureText("Country", 20);
-
-        for (int i = 0; i < num_filtered_umpires; i++) {
-            float name_width = MeasureText(filtered_umpires[i].name, 20);
-            if (name_width > max_name_width) max_name_width = name_width;
-            float country_width = MeasureText(filtered_umpires[i].country, 20);
-            if (country_width > max_country_width) max_country_width = country_width;
+        // 1. Widen the columns for the rows now in view to keep them aligned
+        for (int i = list.first; i < list.last; i++) {
+            GrowColumnWidth(&max_name_width, umpires[original_indices[i]].name, 20);
+            GrowColumnWidth(&max_country_width, umpires[original_indices[i]].country, 20);
         }
 
         // 2. Define column start positions with padding
@@ -2415,37 +2722,41 @@ static void UpdateDrawUmpiresScreen(GuiState *state) {
         float col1_x = 40;
         float col2_x = col1_x + max_name_width + padding;
         float col3_x = col2_x + max_country_width + padding;
-        float col4_x = col3_x + MeasureText("Since: YYYY", 20) + padding; // Approx width
-        float col5_x = col4_x + MeasureText("Matches: 999", 20) + padding;
+        float col4_x = col3_x + text_cache_measure("Since: YYYY", 20) + padding; // Approx width
+        float col5_x = col4_x + text_cache_measure("Matches: 999", 20) + padding;
         
         // 3. Draw the header (it scrolls with the content)
-        int header_y = view.y + 5 + scroll.y;
+        int header_y = ListViewRowY(&list, -1) + 5;
         DrawTextBold("Name", col1_x, header_y, 20, ICC_YELLOW);
         DrawTextBold("Country", col2_x, header_y, 20, ICC_YELLOW);
         DrawTextBold("Since", col3_x, header_y, 20, ICC_YELLOW);
         DrawTextBold("Matches", col4_x, header_y, 20, ICC_YELLOW);
         DrawTextBold("Actions", col5_x, header_y, 20, ICC_YELLOW);
-        DrawLine(view.x + 10, header_y + 25, view.x + view.width - 20, header_y + 25, ICC_YELLOW);
+        GfxDrawLine(view.x + 10, header_y + 25, view.x + view.width - 20, header_y + 25, ICC_YELLOW);
 
-        // 4. Draw each umpire's details in perfectly aligned columns
-        for (int i = 0; i < num_filtered_umpires; i++) {
-            int y_pos = view.y + headerHeight + (i * itemHeight) + scroll.y;
+        // 4. Draw the visible umpires in perfectly aligned columns
+        for (int i = list.first; i < list.last; i++) {
+            int y_pos = ListViewRowY(&list, i);
             int original_index = original_indices[i];
+            const Umpire *ump = &umpires[original_index];
             Color textColor = (editIndex == original_index) ? ICC_YELLOW : ICC_WHITE; // Highlight the entry being edited
 
-            DrawTextBold(filtered_umpires[i].name, col1_x, y_pos, 20, textColor);
-            DrawTextBold(filtered_umpires[i].country, col2_x, y_pos, 20, textColor);
-            DrawTextBold(TextFormat("%d", filtered_umpires[i].since_year), col3_x, y_pos, 20, ICC_WHITE);
-            DrawTextBold(TextFormat("%d", filtered_umpires[i].matches_umpired), col4_x, y_pos, 20, ICC_WHITE);
+            DrawTextBold(ump->name, col1_x, y_pos, 20, textColor);
+            DrawTextBold(ump->country, col2_x, y_pos, 20, textColor);
+            DrawTextBold(TextFormat("%d", ump->since_year), col3_x, y_pos, 20, ICC_WHITE);
+            DrawTextBold(TextFormat("%d", ump->matches_umpired), col4_x, y_pos, 20, ICC_WHITE);
 
             // Define and draw Edit/Delete buttons for this row
             Rectangle editBtnRec = { col5_x, y_pos, editButtonWidth, buttonHeight };
             Rectangle deleteBtnRec = { col5_x + editButtonWidth + 5, y_pos, deleteButtonWidth, buttonHeight };
 
-            DrawRectangleRec(editBtnRec, ICC_YELLOW);
-            DrawTextBold("Edit", editBtnRec.x + editBtnRec.width/2 - MeasureText("Edit", 15)/2, editBtnRec.y + 2, 15, ICC_WHITE);
-            DrawRectangleRec(deleteBtnRec, ICC_RED);
-            DrawTextBold("Delete", deleteBtnRec.x + deleteBtnRec.width/2 - MeasureText("Delete", 15)/2, deleteBtnRec.y + 2, 15, ICC_WHITE);
+            GfxDrawRectangleRec(editBtnRec, ICC_YELLOW);
+            DrawTextBold("Edit", editBtnRec.x + editBtnRec.width/2 - text_cache_measure("Edit", 15)/2, editBtnRec.y + 2, 15, ICC_WHITE);
+            GfxDrawRectangleRec(deleteBtnRec, ICC_RED);
+            DrawTextBold("Delete", deleteBtnRec.x + deleteBtnRec.width/2 - text_cache_measure("Delete", 15)/2, deleteBtnRec.y + 2, 15, ICC_WHITE);
+
+            // Rows partly under the panel edges are drawn but must not take clicks
+            if (!CheckCollisionPointRec(GetMousePosition(), view)) continue;
 
             // Check for button clicks
             if (CheckCollisionPointRec(GetMousePosition(), editBtnRec) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
@@ -2474,27 +2785,22 @@ static void UpdateDrawUmpiresScreen(GuiState *state) {
     }
 
     // Stop clipping
-    EndScissorMode();
+    GfxEndScissorMode();
 
     // Draw the scrollbar if needed
-    if (contentHeight > view.height) {
-        Rectangle scrollBarArea = { view.x + view.width - 12, view.y, 10, view.height };
-        DrawRectangleRec(scrollBarArea, ICC_GRAY);
-        
-        float scrollBarHeight = (view.height / contentHeight) * view.height;
-        float scrollBarY = view.y + (-scroll.y / (contentHeight - view.height)) * (view.height - scrollBarHeight);
-        Rectangle scrollHandle = { scrollBarArea.x, scrollBarY, 10, scrollBarHeight };
-        DrawRectangleRec(scrollHandle, ICC_GRAY);
-    }
-
-    if (filtered_umpires) free(filtered_umpires);
-    if (original_indices) free(original_indices);
+    DrawListViewScrollbar(&list, num_filtered_umpires);
 
     // Back button
-    DrawRectangleRec(backButton, ICC_GRAY);
-    DrawTextBold("Back to Menu", backButton.x + backButton.width/2 - MeasureText("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(backButton, ICC_GRAY);
+    DrawTextBold("Back to Menu", backButton.x + backButton.width/2 - text_cache_measure("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
 
-    EndDrawing();
+    GfxEndDrawing();
+}
+
+// Carries a team's or player's rating over to its new name, as ratings are keyed like players.dat
+static void RenameRated(const char *team, const char *player, const char *new_name) {
+    if (strcmp(player ? player : team, new_name) == 0) return;
+    if (ratings_rename(GameRatings(), team, player, new_name)) ratings_save(GameRatings(), RATINGS_FILE);
 }
 
 static void UpdateDrawTeamsScreen(GuiState *state) {
@@ -2513,7 +2819,7 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
     // --- Left Panel (Teams List) ---
     static TextBox newTeamBox = { {0}, {0}, 0, false, false };
     static Rectangle addTeamButton;
-    static Vector2 teamScroll = { 0, 0 }; // For scrolling through teams
+    static ListView teamList = { 0 }; // For scrolling through teams
 
     // --- Right Panel (Players List & Add Player Form) ---
     static bool showAddPlayerForm = false;
@@ -2555,7 +2861,7 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
     // --- Logic ---
     if (needs_refresh) {
         if (teams) free(teams);
-        teams = load_teams(&num_teams);
+        teams = LoadTeamsPreloaded(&num_teams);
         needs_refresh = false;
     }
 
@@ -2586,6 +2892,7 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
                 new_team->is_deleted = false;
             } else { // Edit mode
                 // IMPORTANT: When renaming a team, we must save all teams to update players.dat correctly.
+                RenameRated(teams[editTeamIndex].name, NULL, newTeamBox.text);
                 strcpy(teams[editTeamIndex].name, newTeamBox.text);
                 editTeamIndex = -1; // Exit edit mode
             }
@@ -2612,6 +2919,7 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
                 } else {
                     // Updating an existing player
                     p = &selectedTeam->players[editPlayerIndex];
+                    RenameRated(selectedTeam->name, p->name, addPlayerNameBox.text);
                 }
                 *p = new_player_template; // Copy from the form template
                 strcpy(p->name, addPlayerNameBox.text); // Copy name from text box
@@ -2641,34 +2949,39 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
     }
 
     // --- Drawing ---
-    BeginDrawing();
-    ClearBackground(ICC_BG);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
 
     // Draw Left Panel (Teams)
-    DrawRectangleRec(panelLeft, (Color){ 240, 240, 240, 255 });
-    DrawRectangleLinesEx(panelLeft, 1, ICC_GRAY);
+    GfxDrawRectangleRec(panelLeft, (Color){ 240, 240, 240, 255 });
+    GfxDrawRectangleLinesEx(panelLeft, 1, ICC_GRAY);
     DrawTextBold("Teams", panelLeft.x + 10, panelLeft.y + 15, 20, ICC_GRAY);
-    DrawRectangleRec(newTeamBox.bounds, ICC_WHITE);
-    DrawRectangleLinesEx(newTeamBox.bounds, 1, editTeamIndex != -1 ? ICC_BLUE : ICC_GRAY);
-    DrawText(newTeamBox.text, newTeamBox.bounds.x + 5, newTeamBox.bounds.y + 5, 20, ICC_WHITE);
+    GfxDrawRectangleRec(newTeamBox.bounds, ICC_WHITE);
+    GfxDrawRectangleLinesEx(newTeamBox.bounds, 1, editTeamIndex != -1 ? ICC_BLUE : ICC_GRAY);
+    GfxDrawText(newTeamBox.text, newTeamBox.bounds.x + 5, newTeamBox.bounds.y + 5, 20, ICC_WHITE);
     
     const char* teamButtonText = (editTeamIndex == -1) ? "Add" : "Save";
-    DrawRectangleRec(addTeamButton, (editTeamIndex == -1) ? ICC_GREEN : ICC_BLUE);
-    DrawText(teamButtonText, addTeamButton.x + 5, addTeamButton.y + 5, 20, ICC_WHITE);
-
-    // Scrollable area for teams
-    Rectangle teamListView = { panelLeft.x + 1, newTeamBox.bounds.y + newTeamBox.bounds.height + 10, panelLeft.width - 2, panelLeft.height - newTeamBox.bounds.height - 70 };
-    // TODO: Implement scrolling for team list if it gets long
-    DrawRectangleRec(teamListView, ICC_WHITE);
+    GfxDrawRectangleRec(addTeamButton, (editTeamIndex == -1) ? ICC_GREEN : ICC_BLUE);
+    GfxDrawText(teamButtonText, addTeamButton.x + 5, addTeamButton.y + 5, 20, ICC_WHITE);
+
+    // Scrollable area for teams, stops short of the back button
+    Rectangle teamListView = { panelLeft.x + 1, newTeamBox.bounds.y + newTeamBox.bounds.height + 10, panelLeft.width - 2, backButton.y - (newTeamBox.bounds.y + newTeamBox.bounds.height + 10) - 10 };
+    teamList.bounds = teamListView;
+    teamList.itemHeight = 30.0f;
+    teamList.headerHeight = 5.0f;
+    UpdateListView(&teamList, num_teams);
+    GfxDrawRectangleRec(teamListView, ICC_WHITE);
+    GfxBeginScissorMode(teamListView.x, teamListView.y, teamListView.width, teamListView.height);
+    bool mouseInTeamList = CheckCollisionPointRec(GetMousePosition(), teamListView);
     
-    // Team list logic
-    for (int i = 0; i < num_teams; i++) {
-        Rectangle itemRec = { teamListView.x + 5, teamListView.y + 5 + (i * 30) + teamScroll.y, teamListView.width - 175, 25 };
+    // Team list logic, only the rows in view
+    for (int i = teamList.first; i < teamList.last; i++) {
+        Rectangle itemRec = { teamListView.x + 5, ListViewRowY(&teamList, i), teamListView.width - 190, 25 }; // Leaves room for the scrollbar
         Rectangle editBtn = { itemRec.x + itemRec.width + 5, itemRec.y, 50, 25 };
         Rectangle deleteBtn = { editBtn.x + editBtn.width + 5, itemRec.y, 50, 25 };
         Rectangle hideBtn = { deleteBtn.x + deleteBtn.width + 5, itemRec.y, 50, 25 };
 
-        if (CheckCollisionPointRec(GetMousePosition(), itemRec) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        if (CheckCollisionPointRec(GetMousePosition(), itemRec) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && mouseInTeamList) {
             if (editTeamIndex != -1) editTeamIndex = -1; // Cancel edit if selecting another team
             selectedTeamIndex = i;
             showAddPlayerForm = false; // Always hide form when selecting a new team
@@ -2676,51 +2989,53 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
         Color bgColor = (selectedTeamIndex == i) ? SKYBLUE : (teams[i].is_deleted ? ICC_GRAY : ICC_GRAY);
         Color textColor = teams[i].is_deleted ? ICC_GRAY : ICC_WHITE;
 
-        DrawRectangleRec(itemRec, bgColor);
+        GfxDrawRectangleRec(itemRec, bgColor);
         char teamNameDisplay[MAX_TEAM_NAME_LEN + 24] = {0};
         strcpy(teamNameDisplay, teams[i].name);
         if (teams[i].is_deleted) strcat(teamNameDisplay, " [Deleted]");
         if (teams[i].is_hidden && !teams[i].is_deleted) strcat(teamNameDisplay, " [Hidden]");
-        DrawText(teamNameDisplay, itemRec.x + 5, itemRec.y + 5, 20, textColor);
+        GfxDrawText(teamNameDisplay, itemRec.x + 5, itemRec.y + 5, 20, textColor);
 
         // --- Draw Conditional Buttons: Edit/Delete for active teams, Recover for deleted teams ---
         if (teams[i].is_deleted) {
             // Draw only a "Recover" button
             Rectangle recoverBtn = { editBtn.x, editBtn.y, 105, 25 };
-            DrawRectangleRec(recoverBtn, ICC_GREEN);
-            DrawText("Recover", recoverBtn.x + 20, recoverBtn.y + 5, 15, ICC_WHITE);
-            if (CheckCollisionPointRec(GetMousePosition(), recoverBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            GfxDrawRectangleRec(recoverBtn, ICC_GREEN);
+            GfxDrawText("Recover", recoverBtn.x + 20, recoverBtn.y + 5, 15, ICC_WHITE);
+            if (CheckCollisionPointRec(GetMousePosition(), recoverBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && mouseInTeamList) {
                 teams[i].is_deleted = false;
                 save_teams(teams, num_teams);
                 needs_refresh = true;
             }
         } else {
             // Draw Edit/Delete/Hide buttons for active teams
-            DrawRectangleRec(editBtn, ICC_YELLOW); DrawText("Edit", editBtn.x + 10, editBtn.y + 5, 15, ICC_WHITE);
-            DrawRectangleRec(deleteBtn, ICC_RED); DrawText("Del", deleteBtn.x + 10, deleteBtn.y + 5, 15, ICC_WHITE);
+            GfxDrawRectangleRec(editBtn, ICC_YELLOW); GfxDrawText("Edit", editBtn.x + 10, editBtn.y + 5, 15, ICC_WHITE);
+            GfxDrawRectangleRec(deleteBtn, ICC_RED); GfxDrawText("Del", deleteBtn.x + 10, deleteBtn.y + 5, 15, ICC_WHITE);
 
             const char* hideText = teams[i].is_hidden ? "Show" : "Hide";
-            DrawRectangleRec(hideBtn, teams[i].is_hidden ? SKYBLUE : VIOLET);
-            DrawText(hideText, hideBtn.x + 10, hideBtn.y + 5, 15, ICC_WHITE);
+            GfxDrawRectangleRec(hideBtn, teams[i].is_hidden ? SKYBLUE : VIOLET);
+            GfxDrawText(hideText, hideBtn.x + 10, hideBtn.y + 5, 15, ICC_WHITE);
 
-            if (CheckCollisionPointRec(GetMousePosition(), editBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            if (CheckCollisionPointRec(GetMousePosition(), editBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && mouseInTeamList) {
                 editTeamIndex = i;
                 strcpy(newTeamBox.text, teams[i].name); newTeamBox.charCount = strlen(newTeamBox.text);
             }
-            if (CheckCollisionPointRec(GetMousePosition(), deleteBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            if (CheckCollisionPointRec(GetMousePosition(), deleteBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && mouseInTeamList) {
                 teams[i].is_deleted = true;
                 save_teams(teams, num_teams); needs_refresh = true;
             }
-            if (CheckCollisionPointRec(GetMousePosition(), hideBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            if (CheckCollisionPointRec(GetMousePosition(), hideBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && mouseInTeamList) {
                 teams[i].is_hidden = !teams[i].is_hidden;
                 save_teams(teams, num_teams); needs_refresh = true;
             }
         }
     }
+    GfxEndScissorMode();
+    DrawListViewScrollbar(&teamList, num_teams);
 
     // Draw Right Panel (Players)
-    DrawRectangleRec(panelRight, (Color){ 250, 250, 250, 255 });
-    DrawRectangleLinesEx(panelRight, 1, ICC_GRAY);
+    GfxDrawRectangleRec(panelRight, (Color){ 250, 250, 250, 255 });
+    GfxDrawRectangleLinesEx(panelRight, 1, ICC_GRAY);
 
     if (showAddPlayerForm) {
         // --- DRAW THE DETAILED ADD PLAYER FORM ---
@@ -2743,17 +3058,17 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
             if (formScroll.y < formView.height - contentHeight) formScroll.y = formView.height - contentHeight;
         }
 
-        BeginScissorMode(formView.x, formView.y, formView.width, formView.height);
+        GfxBeginScissorMode(formView.x, formView.y, formView.width, formView.height);
         // --- Column 1: Primary Details ---
-        DrawRectangle(COL1_X - 10, currentY, (formView.width / 2.0f) - 20, 30, ICC_GRAY);
+        GfxDrawRectangle(COL1_X - 10, currentY, (formView.width / 2.0f) - 20, 30, ICC_GRAY);
         DrawTextBold("Primary Details", COL1_X, currentY + 5, 20, ICC_WHITE);
         currentY += 40;
 
         // Player Name
         DrawTextBold("Player Name:", COL1_X, currentY - 15, 10, ICC_GRAY);
         addPlayerNameBox.bounds = (Rectangle){ COL1_X, currentY, (formView.width / 2.0f) - 40, 35 }; // This was line 1206
-        DrawRectangleRec(addPlayerNameBox.bounds, ICC_WHITE); DrawRectangleLinesEx(addPlayerNameBox.bounds, 1, ICC_GRAY);
-        DrawText(addPlayerNameBox.text, addPlayerNameBox.bounds.x + 10, addPlayerNameBox.bounds.y + 8, 20, ICC_WHITE);
+        GfxDrawRectangleRec(addPlayerNameBox.bounds, ICC_WHITE); GfxDrawRectangleLinesEx(addPlayerNameBox.bounds, 1, ICC_GRAY);
+        GfxDrawText(addPlayerNameBox.text, addPlayerNameBox.bounds.x + 10, addPlayerNameBox.bounds.y + 8, 20, ICC_WHITE);
         currentY += ROW_HEIGHT;
 
         // Player Type
@@ -2761,8 +3076,8 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
         for (int i = 0; i < 4; i++) {
             Rectangle typeBtn = { COL1_X + (i * 120), currentY, 110, 35 };
             bool isSelected = (new_player_template.type == (PlayerType)i);
-            DrawRectangleRec(typeBtn, isSelected ? ICC_BLUE : ICC_GRAY);
-            DrawText(playerTypeNames[i], typeBtn.x + 10, typeBtn.y + 8, 20, isSelected ? ICC_WHITE : ICC_WHITE);
+            GfxDrawRectangleRec(typeBtn, isSelected ? ICC_BLUE : ICC_GRAY);
+            GfxDrawText(playerTypeNames[i], typeBtn.x + 10, typeBtn.y + 8, 20, isSelected ? ICC_WHITE : ICC_WHITE);
             if (CheckCollisionPointRec(GetMousePosition(), typeBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) new_player_template.type = (PlayerType)i;
         }
         currentY += ROW_HEIGHT;
@@ -2770,14 +3085,14 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
         // Batting and Bowling Style
         DrawTextBold("Batting Style:", COL1_X, currentY - 15, 10, ICC_GRAY);
         Rectangle batStyleBtn = { COL1_X, currentY, 230, 35 };
-        DrawRectangleRec(batStyleBtn, ICC_GRAY);
-        DrawText(batStyleNames[new_player_template.batting_style], batStyleBtn.x + 10, batStyleBtn.y + 8, 20, ICC_WHITE);
+        GfxDrawRectangleRec(batStyleBtn, ICC_GRAY);
+        GfxDrawText(batStyleNames[new_player_template.batting_style], batStyleBtn.x + 10, batStyleBtn.y + 8, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), batStyleBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) new_player_template.batting_style = (BattingStyle)!new_player_template.batting_style;
 
         DrawTextBold("Bowling Style:", COL1_X + 250, currentY - 15, 10, ICC_GRAY);
         Rectangle bowlStyleBtn = { COL1_X + 250, currentY, 230, 35 };
-        DrawRectangleRec(bowlStyleBtn, ICC_GRAY);
-        DrawText(bowlStyleNames[new_player_template.bowling_style], bowlStyleBtn.x + 10, bowlStyleBtn.y + 8, 20, ICC_WHITE);
+        GfxDrawRectangleRec(bowlStyleBtn, ICC_GRAY);
+        GfxDrawText(bowlStyleNames[new_player_template.bowling_style], bowlStyleBtn.x + 10, bowlStyleBtn.y + 8, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), bowlStyleBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             new_player_template.bowling_style = (BowlingStyle)((new_player_template.bowling_style + 1) % (sizeof(bowlStyleNames)/sizeof(bowlStyleNames[0])));
         }
@@ -2785,21 +3100,21 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
 
         // Status (Wicketkeeper, Active)
         Rectangle wkCheck = { COL1_X, currentY, 25, 25 };
-        DrawRectangleRec(wkCheck, ICC_GRAY);
-        if (new_player_template.is_wicketkeeper) DrawRectangle(wkCheck.x + 5, wkCheck.y + 5, 15, 15, ICC_BLUE);
+        GfxDrawRectangleRec(wkCheck, ICC_GRAY);
+        if (new_player_template.is_wicketkeeper) GfxDrawRectangle(wkCheck.x + 5, wkCheck.y + 5, 15, 15, ICC_BLUE);
         DrawTextBold("Is Wicketkeeper?", wkCheck.x + 35, wkCheck.y + 5, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), (Rectangle){wkCheck.x, wkCheck.y, 200, 25}) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) new_player_template.is_wicketkeeper = !new_player_template.is_wicketkeeper;
 
         Rectangle activeCheck = { COL1_X + 250, currentY, 25, 25 };
-        DrawRectangleRec(activeCheck, ICC_GRAY);
-        if (new_player_template.is_active) DrawRectangle(activeCheck.x + 5, activeCheck.y + 5, 15, 15, ICC_GREEN);
+        GfxDrawRectangleRec(activeCheck, ICC_GRAY);
+        if (new_player_template.is_active) GfxDrawRectangle(activeCheck.x + 5, activeCheck.y + 5, 15, 15, ICC_GREEN);
         DrawTextBold("Is Active?", activeCheck.x + 35, activeCheck.y + 5, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), (Rectangle){activeCheck.x, activeCheck.y, 150, 25}) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) new_player_template.is_active = !new_player_template.is_active;
         currentY += ROW_HEIGHT;
 
         // --- Column 2: Skills and Stats ---
         currentY = formView.y + 10 + formScroll.y; // Reset Y for the second column
-        DrawRectangle(COL2_X - 10, currentY, (formView.width / 2.0f) - 20, 30, ICC_GRAY);
+        GfxDrawRectangle(COL2_X - 10, currentY, (formView.width / 2.0f) - 20, 30, ICC_GRAY);
         DrawTextBold("Skills & Career Stats", COL2_X, currentY + 5, 20, ICC_WHITE);
         currentY += 40;
 
@@ -2808,12 +3123,12 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
         batSkillBox.bounds = (Rectangle){ COL2_X, currentY, 100, 35 };
         bowlSkillBox.bounds = (Rectangle){ COL2_X + 120, currentY, 100, 35 };
         fieldSkillBox.bounds = (Rectangle){ COL2_X + 240, currentY, 100, 35 };
-        DrawText("Bat", batSkillBox.bounds.x, batSkillBox.bounds.y + 37, 10, ICC_GRAY);
-        DrawRectangleRec(batSkillBox.bounds, ICC_WHITE); DrawText(batSkillBox.text, batSkillBox.bounds.x + 10, batSkillBox.bounds.y + 8, 20, ICC_WHITE);
-        DrawText("Bowl", bowlSkillBox.bounds.x, bowlSkillBox.bounds.y + 37, 10, ICC_GRAY);
-        DrawRectangleRec(bowlSkillBox.bounds, ICC_WHITE); DrawText(bowlSkillBox.text, bowlSkillBox.bounds.x + 10, bowlSkillBox.bounds.y + 8, 20, ICC_WHITE);
-        DrawText("Field", fieldSkillBox.bounds.x, fieldSkillBox.bounds.y + 37, 10, ICC_GRAY);
-        DrawRectangleRec(fieldSkillBox.bounds, ICC_WHITE); DrawText(fieldSkillBox.text, fieldSkillBox.bounds.x + 10, fieldSkillBox.bounds.y + 8, 20, ICC_WHITE);
+        GfxDrawText("Bat", batSkillBox.bounds.x, batSkillBox.bounds.y + 37, 10, ICC_GRAY);
+        GfxDrawRectangleRec(batSkillBox.bounds, ICC_WHITE); GfxDrawText(batSkillBox.text, batSkillBox.bounds.x + 10, batSkillBox.bounds.y + 8, 20, ICC_WHITE);
+        GfxDrawText("Bowl", bowlSkillBox.bounds.x, bowlSkillBox.bounds.y + 37, 10, ICC_GRAY);
+        GfxDrawRectangleRec(bowlSkillBox.bounds, ICC_WHITE); GfxDrawText(bowlSkillBox.text, bowlSkillBox.bounds.x + 10, bowlSkillBox.bounds.y + 8, 20, ICC_WHITE);
+        GfxDrawText("Field", fieldSkillBox.bounds.x, fieldSkillBox.bounds.y + 37, 10, ICC_GRAY);
+        GfxDrawRectangleRec(fieldSkillBox.bounds, ICC_WHITE); GfxDrawText(fieldSkillBox.text, fieldSkillBox.bounds.x + 10, fieldSkillBox.bounds.y + 8, 20, ICC_WHITE);
         currentY += ROW_HEIGHT;
 
         // Career Stats
@@ -2823,24 +3138,24 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
         wicketsBox.bounds = (Rectangle){ COL2_X + 240, currentY, 100, 35 };
         stumpsBox.bounds = (Rectangle){ COL2_X, currentY + 45, 100, 35 };
         runOutsBox.bounds = (Rectangle){ COL2_X + 120, currentY + 45, 100, 35 };
-        DrawText("Matches", matchesBox.bounds.x, matchesBox.bounds.y + 37, 10, ICC_GRAY);
-        DrawRectangleRec(matchesBox.bounds, ICC_WHITE); DrawText(matchesBox.text, matchesBox.bounds.x + 10, matchesBox.bounds.y + 8, 20, ICC_WHITE);
-        DrawText("Runs", runsBox.bounds.x, runsBox.bounds.y + 37, 10, ICC_GRAY);
-        DrawRectangleRec(runsBox.bounds, ICC_WHITE); DrawText(runsBox.text, runsBox.bounds.x + 10, runsBox.bounds.y + 8, 20, ICC_WHITE);
-        DrawText("Wickets", wicketsBox.bounds.x, wicketsBox.bounds.y + 37, 10, ICC_GRAY);
-        DrawRectangleRec(wicketsBox.bounds, ICC_WHITE); DrawText(wicketsBox.text, wicketsBox.bounds.x + 10, wicketsBox.bounds.y + 8, 20, ICC_WHITE);
-        DrawText("Stumps", stumpsBox.bounds.x, stumpsBox.bounds.y + 37, 10, ICC_GRAY);
-        DrawRectangleRec(stumpsBox.bounds, ICC_WHITE); DrawText(stumpsBox.text, stumpsBox.bounds.x + 10, stumpsBox.bounds.y + 8, 20, ICC_WHITE);
-        DrawText("RunOuts", runOutsBox.bounds.x, runOutsBox.bounds.y + 37, 10, ICC_GRAY);
-        DrawRectangleRec(runOutsBox.bounds, ICC_WHITE); DrawText(runOutsBox.text, runOutsBox.bounds.x + 10, runOutsBox.bounds.y + 8, 20, ICC_WHITE);
-
-        EndScissorMode();
+        GfxDrawText("Matches", matchesBox.bounds.x, matchesBox.bounds.y + 37, 10, ICC_GRAY);
+        GfxDrawRectangleRec(matchesBox.bounds, ICC_WHITE); GfxDrawText(matchesBox.text, matchesBox.bounds.x + 10, matchesBox.bounds.y + 8, 20, ICC_WHITE);
+        GfxDrawText("Runs", runsBox.bounds.x, runsBox.bounds.y + 37, 10, ICC_GRAY);
+        GfxDrawRectangleRec(runsBox.bounds, ICC_WHITE); GfxDrawText(runsBox.text, runsBox.bounds.x + 10, runsBox.bounds.y + 8, 20, ICC_WHITE);
+        GfxDrawText("Wickets", wicketsBox.bounds.x, wicketsBox.bounds.y + 37, 10, ICC_GRAY);
+        GfxDrawRectangleRec(wicketsBox.bounds, ICC_WHITE); GfxDrawText(wicketsBox.text, wicketsBox.bounds.x + 10, wicketsBox.bounds.y + 8, 20, ICC_WHITE);
+        GfxDrawText("Stumps", stumpsBox.bounds.x, stumpsBox.bounds.y + 37, 10, ICC_GRAY);
+        GfxDrawRectangleRec(stumpsBox.bounds, ICC_WHITE); GfxDrawText(stumpsBox.text, stumpsBox.bounds.x + 10, stumpsBox.bounds.y + 8, 20, ICC_WHITE);
+        GfxDrawText("RunOuts", runOutsBox.bounds.x, runOutsBox.bounds.y + 37, 10, ICC_GRAY);
+        GfxDrawRectangleRec(runOutsBox.bounds, ICC_WHITE); GfxDrawText(runOutsBox.text, runOutsBox.bounds.x + 10, runOutsBox.bounds.y + 8, 20, ICC_WHITE);
+
+        GfxEndScissorMode();
 
         // Draw Save/Cancel buttons for the form
         const char* saveButtonText = (editPlayerIndex == -1) ? "Save Player" : "Save Changes";
-        DrawRectangleRec(savePlayerButton, (editPlayerIndex == -1) ? ICC_GREEN : ICC_BLUE);
+        GfxDrawRectangleRec(savePlayerButton, (editPlayerIndex == -1) ? ICC_GREEN : ICC_BLUE);
         DrawTextBold(saveButtonText, savePlayerButton.x + 20, savePlayerButton.y + 10, 20, ICC_WHITE);
-        DrawRectangleRec(cancelPlayerButton, ICC_RED);
+        GfxDrawRectangleRec(cancelPlayerButton, ICC_RED);
         DrawTextBold("Cancel", cancelPlayerButton.x + 40, cancelPlayerButton.y + 10, 20, ICC_WHITE);
 
 
@@ -2855,7 +3170,7 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
 
         // Button to show the add player form
         Rectangle openAddPlayerFormButton = { panelRight.x + panelRight.width - 220, panelRight.y + 10, 200, 30 };
-        DrawRectangleRec(openAddPlayerFormButton, ICC_GREEN);
+        GfxDrawRectangleRec(openAddPlayerFormButton, ICC_GREEN);
         DrawTextBold("Add New Player", openAddPlayerFormButton.x + 20, openAddPlayerFormButton.y + 5, 20, ICC_WHITE);
         if (CheckCollisionPointRec(GetMousePosition(), openAddPlayerFormButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             showAddPlayerForm = true;
@@ -2878,49 +3193,21 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
         // --- Player List Refactored with Scrollbars ---
         // --- DYNAMIC COLUMN WIDTH CALCULATION ---
         const char* col_headers[] = { "Name", "Role", "Bat", "Bowl", "WK", "Active", "Bat Skl", "Bwl Skl", "Fld Skl", "M", "Runs", "Wkts", "Stumps", "RunOuts", "Actions" };
-        const int num_cols = sizeof(col_headers) / sizeof(col_headers[0]);
-        float col_widths[num_cols];
-
-        // 1. Initialize with header widths
-        for (int i = 0; i < num_cols; i++) {
-            col_widths[i] = MeasureText(col_headers[i], 20) + 10; // Add some padding
-        }
-        col_widths[num_cols - 1] = 120; // Actions column is fixed
-
-        // 2. Iterate through players to find max widths
-        for (int i = 0; i < selectedTeam->num_players; i++) {
-            Player* p = &selectedTeam->players[i];
-            char buffer[256];
-
-            // Player Name (with suffixes)
-            char name_suffix[16] = {0};
-            if (p->is_wicketkeeper) strcat(name_suffix, " (WK)");
-            if (i == selectedTeam->captain_idx) strcat(name_suffix, " (C)");
-            if (i == selectedTeam->vice_captain_idx) strcat(name_suffix, " (VC)");
-            snprintf(buffer, sizeof(buffer), "%s%s", p->name, name_suffix);
-            if (MeasureText(buffer, 20) > col_widths[0]) col_widths[0] = MeasureText(buffer, 20);
-
-            // Role
-            if (MeasureText(playerTypeNames[p->type], 20) > col_widths[1]) col_widths[1] = MeasureText(playerTypeNames[p->type], 20);
-            // Batting Style
-            if (MeasureText(p->batting_style == BATTING_STYLE_RHB ? "RHB" : "LHB", 20) > col_widths[2]) col_widths[2] = MeasureText(p->batting_style == BATTING_STYLE_RHB ? "RHB" : "LHB", 20);
-            // Bowling Style
-            if (MeasureText(bowlStyleNames[p->bowling_style], 20) > col_widths[3]) col_widths[3] = MeasureText(bowlStyleNames[p->bowling_style], 20);
-            // WK & Active (Yes/No)
-            if (MeasureText("Yes", 20) > col_widths[4]) col_widths[4] = MeasureText("Yes", 20);
-            if (MeasureText("Yes", 20) > col_widths[5]) col_widths[5] = MeasureText("Yes", 20);
-
-            // Skills
-            if (MeasureText(TextFormat("%d", p->batting_skill), 20) > col_widths[6]) col_widths[6] = MeasureText(TextFormat("%d", p->batting_skill), 20);
-            if (MeasureText(TextFormat("%d", p->bowling_skill), 20) > col_widths[7]) col_widths[7] = MeasureText(TextFormat("%d", p->bowling_skill), 20);
-            if (MeasureText(TextFormat("%d", p->fielding_skill), 20) > col_widths[8]) col_widths[8] = MeasureText(TextFormat("%d", p->fielding_skill), 20);
-
-            // Stats
-            if (MeasureText(TextFormat("%d", p->matches_played), 20) > col_widths[9]) col_widths[9] = MeasureText(TextFormat("%d", p->matches_played), 20);
-            if (MeasureText(TextFormat("%d", p->total_runs), 20) > col_widths[10]) col_widths[10] = MeasureText(TextFormat("%d", p->total_runs), 20);
-            if (MeasureText(TextFormat("%d", p->total_wickets), 20) > col_widths[11]) col_widths[11] = MeasureText(TextFormat("%d", p->total_wickets), 20);
-            if (MeasureText(TextFormat("%d", p->total_stumpings), 20) > col_widths[12]) col_widths[12] = MeasureText(TextFormat("%d", p->total_stumpings), 20);
-            if (MeasureText(TextFormat("%d", p->total_run_outs), 20) > col_widths[13]) col_widths[13] = MeasureText(TextFormat("%d", p->total_run_outs), 20);
+        #define PLAYER_LIST_COLS 15
+        const int num_cols = PLAYER_LIST_COLS;
+        // Widths persist between frames and only grow as rows scroll into view
+        static float col_widths[PLAYER_LIST_COLS];
+        static int widths_for_team = -1;
+        static int widths_for_count = -1;
+
+        // 1. Start from the header widths whenever a different roster is shown
+        if (widths_for_team != selectedTeamIndex || widths_for_count != selectedTeam->num_players) {
+            for (int i = 0; i < num_cols; i++) {
+                col_widths[i] = text_cache_measure(col_headers[i], 20) + 10; // Add some padding
+            }
+            col_widths[num_cols - 1] = 120; // Actions column is fixed
+            widths_for_team = selectedTeamIndex;
+            widths_for_count = selectedTeam->num_players;
         }
 
         const int col_padding = 25; // Increased padding
@@ -2934,7 +3221,7 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
         Rectangle playerListView = { panelRight.x + 1, panelRight.y + 50, panelRight.width - 2, panelRight.height - 60 };
         
         Rectangle view = playerListView; // The area where content is drawn
-        DrawRectangleRec(view, ICC_WHITE); // Draw background for the whole area
+        GfxDrawRectangleRec(view, ICC_WHITE); // Draw background for the whole area
 
         bool horizScrollbarRequired = contentWidth > view.width;
         bool vertScrollbarRequired = contentHeight > view.height;
@@ -2961,7 +3248,44 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
             }
         }
         
-        BeginScissorMode(scissorView.x, scissorView.y, scissorView.width, scissorView.height);
+        // 2. Work out which rows are in view and widen the columns for them only
+        int first_row = (int)floorf(-playerScroll.y / 25.0f);
+        int last_row = (int)ceilf((-playerScroll.y + scissorView.height - 40) / 25.0f);
+        if (first_row < 0) first_row = 0;
+        if (last_row > selectedTeam->num_players) last_row = selectedTeam->num_players;
+
+        for (int i = first_row; i < last_row; i++) {
+            Player* p = &selectedTeam->players[i];
+            char buffer[256];
+
+            // Player Name (with suffixes)
+            char name_suffix[16] = {0};
+            if (p->is_wicketkeeper) strcat(name_suffix, " (WK)");
+            if (i == selectedTeam->captain_idx) strcat(name_suffix, " (C)");
+            if (i == selectedTeam->vice_captain_idx) strcat(name_suffix, " (VC)");
+            snprintf(buffer, sizeof(buffer), "%s%s", p->name, name_suffix);
+            GrowColumnWidth(&col_widths[0], buffer, 20);
+
+            GrowColumnWidth(&col_widths[1], playerTypeNames[p->type], 20);
+            GrowColumnWidth(&col_widths[2], p->batting_style == BATTING_STYLE_RHB ? "RHB" : "LHB", 20);
+            GrowColumnWidth(&col_widths[3], bowlStyleNames[p->bowling_style], 20);
+            GrowColumnWidth(&col_widths[4], "Yes", 20);
+            GrowColumnWidth(&col_widths[5], "Yes", 20);
+
+            // Skills
+            GrowColumnWidth(&col_widths[6], TextFormat("%d", p->batting_skill), 20);
+            GrowColumnWidth(&col_widths[7], TextFormat("%d", p->bowling_skill), 20);
+            GrowColumnWidth(&col_widths[8], TextFormat("%d", p->fielding_skill), 20);
+
+            // Stats
+            GrowColumnWidth(&col_widths[9], TextFormat("%d", p->matches_played), 20);
+            GrowColumnWidth(&col_widths[10], TextFormat("%d", p->total_runs), 20);
+            GrowColumnWidth(&col_widths[11], TextFormat("%d", p->total_wickets), 20);
+            GrowColumnWidth(&col_widths[12], TextFormat("%d", p->total_stumpings), 20);
+            GrowColumnWidth(&col_widths[13], TextFormat("%d", p->total_run_outs), 20);
+        }
+
+        GfxBeginScissorMode(scissorView.x, scissorView.y, scissorView.width, scissorView.height);
 
         // Draw Headers
         float col_x[num_cols];
@@ -2973,11 +3297,10 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
             DrawTextBold(col_headers[i], col_x[i], scissorView.y + 10, 20, ICC_GRAY);
         }
 
-        // Draw Players
-        for (int i = 0; i < selectedTeam->num_players; i++) {
+        // Draw Players (visible rows only)
+        for (int i = first_row; i < last_row; i++) {
             Player* p = &selectedTeam->players[i];
             float y_pos = scissorView.y + 40 + (i * 25) + playerScroll.y;
-             if (y_pos < scissorView.y - 25 || y_pos > scissorView.y + scissorView.height) continue; // Culling
             
             Color textColor = ICC_WHITE;
             char name_suffix[16] = {0};
@@ -2996,25 +3319,25 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
             char player_display_name[MAX_PLAYER_NAME_LEN + 16];
             snprintf(player_display_name, sizeof(player_display_name), "%s%s", p->name, name_suffix);
 
-            DrawText(player_display_name, col_x[0], y_pos, 20, textColor);
-            DrawText(playerTypeNames[p->type], col_x[1], y_pos, 20, ICC_GRAY);
-            DrawText(p->batting_style == BATTING_STYLE_RHB ? "RHB" : "LHB", col_x[2], y_pos, 20, ICC_GRAY);
-            DrawText(bowlStyleNames[p->bowling_style], col_x[3], y_pos, 20, ICC_GRAY);
-            DrawText(p->is_wicketkeeper ? "Yes" : "No", col_x[4], y_pos, 20, ICC_GRAY);
-            DrawText(p->is_active ? "Yes" : "No", col_x[5], y_pos, 20, ICC_GRAY);
-            DrawText(TextFormat("%d", p->batting_skill), col_x[6], y_pos, 20, ICC_BLUE);
-            DrawText(TextFormat("%d", p->bowling_skill), col_x[7], y_pos, 20, ICC_BLUE);
-            DrawText(TextFormat("%d", p->fielding_skill), col_x[8], y_pos, 20, ICC_BLUE);
-            DrawText(TextFormat("%d", p->matches_played), col_x[9], y_pos, 20, DARKPURPLE);
-            DrawText(TextFormat("%d", p->total_runs), col_x[10], y_pos, 20, DARKPURPLE);
-            DrawText(TextFormat("%d", p->total_wickets), col_x[11], y_pos, 20, DARKPURPLE);
-            DrawText(TextFormat("%d", p->total_stumpings), col_x[12], y_pos, 20, DARKPURPLE);
-            DrawText(TextFormat("%d", p->total_run_outs), col_x[13], y_pos, 20, DARKPURPLE);
+            GfxDrawText(player_display_name, col_x[0], y_pos, 20, textColor);
+            GfxDrawText(playerTypeNames[p->type], col_x[1], y_pos, 20, ICC_GRAY);
+            GfxDrawText(p->batting_style == BATTING_STYLE_RHB ? "RHB" : "LHB", col_x[2], y_pos, 20, ICC_GRAY);
+            GfxDrawText(bowlStyleNames[p->bowling_style], col_x[3], y_pos, 20, ICC_GRAY);
+            GfxDrawText(p->is_wicketkeeper ? "Yes" : "No", col_x[4], y_pos, 20, ICC_GRAY);
+            GfxDrawText(p->is_active ? "Yes" : "No", col_x[5], y_pos, 20, ICC_GRAY);
+            GfxDrawText(TextFormat("%d", p->batting_skill), col_x[6], y_pos, 20, ICC_BLUE);
+            GfxDrawText(TextFormat("%d", p->bowling_skill), col_x[7], y_pos, 20, ICC_BLUE);
+            GfxDrawText(TextFormat("%d", p->fielding_skill), col_x[8], y_pos, 20, ICC_BLUE);
+            GfxDrawText(TextFormat("%d", p->matches_played), col_x[9], y_pos, 20, DARKPURPLE);
+            GfxDrawText(TextFormat("%d", p->total_runs), col_x[10], y_pos, 20, DARKPURPLE);
+            GfxDrawText(TextFormat("%d", p->total_wickets), col_x[11], y_pos, 20, DARKPURPLE);
+            GfxDrawText(TextFormat("%d", p->total_stumpings), col_x[12], y_pos, 20, DARKPURPLE);
+            GfxDrawText(TextFormat("%d", p->total_run_outs), col_x[13], y_pos, 20, DARKPURPLE);
 
             Rectangle editBtn = { col_x[14], y_pos, 50, 20 };
             Rectangle deleteBtn = { col_x[14] + 55, y_pos, 60, 20 };
-            DrawRectangleRec(editBtn, ICC_YELLOW); DrawText("Edit", editBtn.x + 10, editBtn.y + 2, 15, ICC_WHITE);
-            DrawRectangleRec(deleteBtn, ICC_RED); DrawText("Delete", deleteBtn.x + 5, deleteBtn.y + 2, 15, ICC_WHITE);
+            GfxDrawRectangleRec(editBtn, ICC_YELLOW); GfxDrawText("Edit", editBtn.x + 10, editBtn.y + 2, 15, ICC_WHITE);
+            GfxDrawRectangleRec(deleteBtn, ICC_RED); GfxDrawText("Delete", deleteBtn.x + 5, deleteBtn.y + 2, 15, ICC_WHITE);
 
             if (CheckCollisionPointRec(GetMousePosition(), editBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                 editPlayerIndex = i;
@@ -3042,18 +3365,18 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
             }
         }
         
-        EndScissorMode();
+        GfxEndScissorMode();
         
         // --- Draw and Handle Vertical Scrollbar ---
         if (vertScrollbarRequired) {
             Rectangle scrollBarArea = { scissorView.x + scissorView.width, scissorView.y, 10, scissorView.height };
-            DrawRectangleRec(scrollBarArea, ICC_GRAY);
+            GfxDrawRectangleRec(scrollBarArea, ICC_GRAY);
             
             float handleHeight = (scissorView.height / contentHeight) * scissorView.height;
             if (handleHeight < 20) handleHeight = 20; // Minimum handle size
             float handleY = scissorView.y + (-playerScroll.y / (contentHeight - scissorView.height)) * (scissorView.height - handleHeight);
             Rectangle scrollHandle = { scrollBarArea.x, handleY, 10, handleHeight };
-            DrawRectangleRec(scrollHandle, ICC_GRAY);
+            GfxDrawRectangleRec(scrollHandle, ICC_GRAY);
 
             static bool isDragging = false;
             if (CheckCollisionPointRec(GetMousePosition(), scrollHandle) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) isDragging = true;
@@ -3069,13 +3392,13 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
         // --- Draw and Handle Horizontal Scrollbar ---
         if (horizScrollbarRequired) {
             Rectangle scrollBarArea = { scissorView.x, scissorView.y + scissorView.height, scissorView.width, 10 };
-            DrawRectangleRec(scrollBarArea, ICC_GRAY);
+            GfxDrawRectangleRec(scrollBarArea, ICC_GRAY);
             
             float handleWidth = (scissorView.width / contentWidth) * scissorView.width;
             if (handleWidth < 20) handleWidth = 20; // Minimum handle size
             float handleX = scissorView.x + (-playerScroll.x / (contentWidth - scissorView.width)) * (scissorView.width - handleWidth);
             Rectangle scrollHandle = { handleX, scrollBarArea.y, handleWidth, 10 };
-            DrawRectangleRec(scrollHandle, ICC_GRAY);
+            GfxDrawRectangleRec(scrollHandle, ICC_GRAY);
 
             static bool isDragging = false;
             if (CheckCollisionPointRec(GetMousePosition(), scrollHandle) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) isDragging = true;
@@ -3095,10 +3418,10 @@ static void UpdateDrawTeamsScreen(GuiState *state) {
     // Draw Back Button
 
     // Draw Back Button
-    DrawRectangleRec(backButton, ICC_RED);
-    DrawTextBold("Back", backButton.x + backButton.width/2 - MeasureText("Back", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(backButton, ICC_RED);
+    DrawTextBold("Back", backButton.x + backButton.width/2 - text_cache_measure("Back", 20)/2, backButton.y + 10, 20, ICC_WHITE);
 
-    EndDrawing();
+    GfxEndDrawing();
 }
 
 
@@ -3110,12 +3433,80 @@ static void UpdateDrawPlaceholderScreen(GuiState *state, const char *title) {
         ChangeScreen(state, state->previousScreen);
     }
 
-    BeginDrawing();
-    ClearBackground(ICC_BG);
-    DrawText(title, GetScreenWidth()/2 - MeasureText(title, 40)/2, 150, 40, ICC_GRAY);
-    DrawRectangleRec(backButton, ICC_GRAY);
-    DrawText("Back to Menu", backButton.x + backButton.width/2 - MeasureText("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
-    EndDrawing();
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
+    GfxDrawText(title, GetScreenWidth()/2 - text_cache_measure(title, 40)/2, 150, 40, ICC_GRAY);
+    GfxDrawRectangleRec(backButton, ICC_GRAY);
+    GfxDrawText("Back to Menu", backButton.x + backButton.width/2 - text_cache_measure("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxEndDrawing();
+}
+
+#define RANKINGS_TEAM_ROWS 16
+#define RANKINGS_PLAYER_ROWS 24
+#define RANKINGS_MIN_BALLS 30      // Deliveries before a player is ranked
+
+// Team and player ratings as the game keeps them, ranked again each time the screen is opened
+// and when a rebuild is swapped in
+static void UpdateDrawRankingsScreen(GuiState *state) {
+    const Ratings *ratings = GameRatings();
+    static bool needs_refresh = true;
+    static unsigned ranked_generation = 0;
+    static int team_ids[RANKINGS_TEAM_ROWS], player_ids[RANKINGS_PLAYER_ROWS];
+    static int num_team_rows = 0, num_player_rows = 0;
+    const Rectangle backButton = { 20, GetScreenHeight() - 60, 150, 40 };
+    const Rectangle rebuildButton = { 190, GetScreenHeight() - 60, 300, 40 };
+
+    if (needs_refresh || ranked_generation != gameRatingsGeneration) {
+        num_team_rows = ratings_rank(ratings, RATING_TEAM, 1, team_ids, RANKINGS_TEAM_ROWS);
+        num_player_rows = ratings_rank(ratings, RATING_PLAYER, RANKINGS_MIN_BALLS, player_ids, RANKINGS_PLAYER_ROWS);
+        ranked_generation = gameRatingsGeneration;
+        needs_refresh = false;
+    }
+
+    if (!ratingsRebuildRunning && CheckCollisionPointRec(GetMousePosition(), rebuildButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        StartRatingsRebuild();
+    }
+    if (CheckCollisionPointRec(GetMousePosition(), backButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        if (!ratingsRebuildRunning) ratingsRebuildStatus[0] = '\0';
+        needs_refresh = true; // Matches played meanwhile show up next time
+        ChangeScreen(state, state->previousScreen);
+    }
+
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
+    DrawTextBold("Rankings", GetScreenWidth()/2 - text_cache_measure("Rankings", 40)/2, 20, 40, ICC_GRAY);
+
+    const int columnX[2] = { 60, GetScreenWidth()/2 + 20 };
+    text_cache_draw("Teams", columnX[0], 90, 24, TEXT_STYLE_PLAIN, ICC_YELLOW);
+    text_cache_draw("Players", columnX[1], 90, 24, TEXT_STYLE_PLAIN, ICC_YELLOW);
+    for (int i = 0; i < num_team_rows; i++) {
+        int id = team_ids[i];
+        float y = 130 + i * 26.0f;
+        text_cache_draw(TextFormat("%2d. %s", i + 1, ratings->name[id]), columnX[0], y, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
+        text_cache_draw(TextFormat("%.0f  (%u matches)", ratings->rating[id], ratings->events[id]), columnX[0] + 280, y, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
+    }
+    for (int i = 0; i < num_player_rows; i++) {
+        int id = player_ids[i];
+        float y = 130 + i * 26.0f;
+        text_cache_draw(TextFormat("%2d. %s (%s)", i + 1, ratings->name[id], ratings->team[id]), columnX[1], y, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
+        text_cache_draw(TextFormat("%.0f", ratings->rating[id]), columnX[1] + 320, y, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
+    }
+    if (num_team_rows == 0) {
+        text_cache_draw("No rated matches yet. Play a match or rebuild from the match logs.", columnX[0], 130, 18, TEXT_STYLE_PLAIN, ICC_GRAY);
+    }
+
+    GfxDrawRectangleRec(backButton, ICC_GRAY);
+    GfxDrawText("Back to Menu", backButton.x + backButton.width/2 - text_cache_measure("Back to Menu", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(rebuildButton, ratingsRebuildRunning ? ICC_GRAY : ICC_BLUE);
+    GfxDrawText("Rebuild from match logs", rebuildButton.x + rebuildButton.width/2 - text_cache_measure("Rebuild from match logs", 20)/2, rebuildButton.y + 10, 20, ICC_WHITE);
+    const char *status = ratingsRebuildStatus;
+    if (ratingsRebuildRunning) {
+        int total = __atomic_load_n(&ratingsRebuild.progress.total, __ATOMIC_RELAXED);
+        int done = __atomic_load_n(&ratingsRebuild.progress.done, __ATOMIC_RELAXED);
+        status = total ? TextFormat("Rebuilding... %d/%d match logs", done, total) : "Reading the match logs...";
+    }
+    if (status[0]) GfxDrawText(status, rebuildButton.x + rebuildButton.width + 20, rebuildButton.y + 10, 20, ICC_GRAY);
+    GfxEndDrawing();
 }
 
 static void UpdateDrawMatchSetupScreen(GuiState *state) {
@@ -3136,16 +3527,16 @@ static void UpdateDrawMatchSetupScreen(GuiState *state) {
 
     const Rectangle backButton = { 20, screenHeight - 60, 150, 40 };
 
-    BeginDrawing();
-    ClearBackground(ICC_BG);
-    DrawTextBold(title, screenWidth / 2 - MeasureText(title, 40) / 2, startY - 80, 40, ICC_GRAY);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
+    DrawTextBold(title, screenWidth / 2 - text_cache_measure(title, 40) / 2, startY - 80, 40, ICC_GRAY);
 
     for (int i = 0; i < numOptions; i++) {
         Rectangle buttonRect = { screenWidth / 2.0f - buttonWidth / 2.0f, startY + i * (buttonHeight + buttonSpacing), buttonWidth, buttonHeight };
         bool hovered = CheckCollisionPointRec(GetMousePosition(), buttonRect);
 
-        DrawRectangleRec(buttonRect, hovered ? SKYBLUE : ICC_GRAY);
-        DrawText(options[i], buttonRect.x + buttonRect.width / 2 - MeasureText(options[i], 20) / 2, buttonRect.y + 15, 20, ICC_WHITE);
+        GfxDrawRectangleRec(buttonRect, hovered ? SKYBLUE : ICC_GRAY);
+        GfxDrawText(options[i], buttonRect.x + buttonRect.width / 2 - text_cache_measure(options[i], 20) / 2, buttonRect.y + 15, 20, ICC_WHITE);
 
         if (hovered && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             if (strcmp(options[i], "One Day World Cup") == 0) {
@@ -3159,11 +3550,11 @@ static void UpdateDrawMatchSetupScreen(GuiState *state) {
 
 
     // Draw Back Button
-    DrawRectangleRec(backButton, ICC_RED);
-    DrawTextBold("Back", backButton.x + backButton.width/2 - MeasureText("Back", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(backButton, ICC_RED);
+    DrawTextBold("Back", backButton.x + backButton.width/2 - text_cache_measure("Back", 20)/2, backButton.y + 10, 20, ICC_WHITE);
     if (CheckCollisionPointRec(GetMousePosition(), backButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) ChangeScreen(state, state->previousScreen);
 
-    EndDrawing();
+    GfxEndDrawing();
 }
 
 static Player generate_random_player_with_role(PlayerType type) {
@@ -3202,13 +3593,152 @@ static Player generate_random_player_with_role(PlayerType type) {
     return p;
 }
 
+#define WC_RESULT_PENDING -2 // Otherwise 0 = teamA won, 1 = teamB won, -1 = tie
+
+// Packs the (already shuffled) fixtures into match days on which no team plays twice, then
+// reorders them day by day. match_day[i] receives the day of the reordered fixture i.
+static int ScheduleMatchDays(Match *matches, int count, const Team *teams, int *match_day) {
+    Match ordered[MAX_MATCHES_IN_TOURNAMENT];
+    bool placed[MAX_MATCHES_IN_TOURNAMENT] = { false };
+    bool busy[MAX_TEAMS_IN_TOURNAMENT];
+    int num_ordered = 0, day = 0;
+
+    while (num_ordered < count) {
+        memset(busy, 0, sizeof(busy));
+        int today = 0;
+        for (int i = 0; i < count && today < WC_MAX_FIXTURES_PER_DAY; i++) {
+            if (placed[i]) continue;
+            int a = (int)(matches[i].teamA - teams), b = (int)(matches[i].teamB - teams);
+            bool tracked = a < MAX_TEAMS_IN_TOURNAMENT && b < MAX_TEAMS_IN_TOURNAMENT; // Beyond that only the daily cap applies
+            if (tracked && (busy[a] || busy[b])) continue;
+            if (tracked) busy[a] = busy[b] = true;
+            placed[i] = true;
+            match_day[num_ordered] = day;
+            ordered[num_ordered++] = matches[i];
+            today++;
+        }
+        day++;
+    }
+    memcpy(matches, ordered, count * sizeof(Match));
+    return day;
+}
+
+// Days and grounds from the format scheduler: a day off between a team's matches, a day between
+// two matches on a ground, home grounds first. The teams are seeded in a random order so the
+// fixture list differs from one World Cup to the next. Fills matches, match_day and venue in day
+// order and returns the number of days, or -1 when the format scheduler cannot take these teams.
+static int ScheduleWorldCup(Match *matches, int *count, Team *teams, int num_teams, int *match_day, char (*venue)[MAX_GROUND_NAME_LEN]) {
+    if (num_teams > FORMAT_MAX_GROUP) return -1;
+    Team *seeded[FORMAT_MAX_GROUP];
+    for (int i = 0; i < num_teams; i++) seeded[i] = &teams[i];
+    for (int i = num_teams - 1; i > 0; i--) {
+        int j = GetRandomValue(0, i);
+        Team *temp = seeded[i];
+        seeded[i] = seeded[j];
+        seeded[j] = temp;
+    }
+
+    FormatSpec spec = format_preset(FORMAT_LEAGUE, num_teams);
+    FormatPlan *plan = format_plan_create(&spec, seeded, num_teams);
+    int num_grounds = 0;
+    Ground *grounds = load_grounds(&num_grounds);
+    FormatScheduleRules rules = { .min_rest_days = 1, .ground_rest_days = 1, .max_matches_per_day = WC_MAX_FIXTURES_PER_DAY };
+    if (!plan || !format_schedule(plan, grounds, num_grounds, &rules)) {
+        format_plan_destroy(plan);
+        free(grounds);
+        return -1;
+    }
+
+    int n = 0, days = 0, on_day[MAX_MATCHES_IN_TOURNAMENT];
+    for (int day = 0; day < plan->num_days && n < MAX_MATCHES_IN_TOURNAMENT; day++) {
+        int today = format_matches_on_day(plan, day, on_day, MAX_MATCHES_IN_TOURNAMENT - n);
+        for (int i = 0; i < today; i++) {
+            const FormatMatch *fm = &plan->matches[on_day[i]];
+            matches[n] = (Match){ .teamA = seeded[fm->team[0]], .teamB = seeded[fm->team[1]], .format = FORMAT_ODI };
+            match_day[n] = day;
+            snprintf(venue[n], MAX_GROUND_NAME_LEN, "%s", fm->ground >= 0 ? grounds[fm->ground].name : "TBD");
+            n++;
+        }
+        if (today > 0) days = day + 1;
+    }
+    *count = n;
+    format_plan_destroy(plan);
+    free(grounds);
+    return days;
+}
+
+static bool UserFixtureFinished(const GameState *gameState) {
+    return gameState->inning_num == 2 && sim_innings_over(gameState);
+}
+
+// Same rule as the gameplay screen's result banner, mapped back to the fixture's sides
+static int UserFixtureWinner(const Match *fixture, const GameState *gameState) {
+    const Team *winner;
+    if (gameState->total_runs >= gameState->target) winner = gameState->batting_team;
+    else if (gameState->total_runs == gameState->target - 1) return -1;
+    else winner = gameState->bowling_team;
+    return strcmp(winner->name, fixture->teamA->name) == 0 ? 0 : 1;
+}
+
+// Two points for a win and one each for a tie, from the user's results and the finished background fixtures.
+// user_scores has the runs and charged balls of the user's fixtures, for the net run rate.
+static int BuildPointsTable(PointsTableEntry *table, Team *teams, int num_teams, const Match *matches, int num_matches,
+                            const int *user_results, const QualFixture *user_scores) {
+    static PointsTable points;
+    points_table_init(&points, teams, num_teams);
+
+    for (int i = 0; i < num_matches; i++) {
+        int winner = user_results[i];
+        int runs[2] = { user_scores[i].runs[0], user_scores[i].runs[1] };
+        int balls[2] = { user_scores[i].balls[0], user_scores[i].balls[1] };
+        SimFixtureView view;
+        if (sim_service_view(i, &view)) {
+            winner = (view.status == SIM_FIXTURE_FINISHED) ? view.winner : WC_RESULT_PENDING;
+            for (int k = 0; k < 2; k++) {
+                int side = (k == 0) ? view.batting_first : 1 - view.batting_first; // Innings k was batted by `side`
+                runs[side] = view.runs[k];
+                balls[side] = view.wickets[k] >= 10 ? SIM_MAX_OVERS * 6 : view.balls[k];
+            }
+        }
+        if (winner == WC_RESULT_PENDING) continue;
+        points_table_record(&points, (int)(matches[i].teamA - teams), (int)(matches[i].teamB - teams), winner, runs, balls);
+    }
+
+    int order[MAX_TEAMS_IN_TOURNAMENT];
+    int n = points_table_standings(&points, order);
+    for (int r = 0; r < n; r++) table[r] = points.entries[order[r]];
+    return n;
+}
+
+// The fixtures as the odds engine sees them: only what the points table shows counts as played
+static int BuildQualFixtures(QualFixture *out, Team *teams, const Match *matches, int num_matches, const int *user_results, const QualFixture *user_scores) {
+    for (int i = 0; i < num_matches; i++) {
+        QualFixture *f = &out[i];
+        *f = user_scores[i];
+        f->team_a = (int)(matches[i].teamA - teams);
+        f->team_b = (int)(matches[i].teamB - teams);
+        f->winner = user_results[i];
+
+        SimFixtureView view;
+        if (!sim_service_view(i, &view)) continue;
+        f->winner = (view.status == SIM_FIXTURE_FINISHED) ? view.winner : WC_RESULT_PENDING;
+        for (int k = 0; k < 2 && f->winner != WC_RESULT_PENDING; k++) {
+            int side = (k == 0) ? view.batting_first : 1 - view.batting_first; // Innings k was batted by `side`
+            f->runs[side] = view.runs[k];
+            f->balls[side] = view.wickets[k] >= 10 ? SIM_MAX_OVERS * 6 : view.balls[k];
+        }
+    }
+    return num_matches;
+}
+
 typedef enum {
     WC_STEP_TEAM_SELECTION,
     WC_STEP_SQUAD_SELECTION,
     WC_STEP_USER_TEAM_CHOICE,
     WC_STEP_FIXTURES,
     WC_STEP_PRE_MATCH,
-    WC_STEP_GROUND_UMPIRE_SELECTION
+    WC_STEP_GROUND_UMPIRE_SELECTION,
+    WC_STEP_MATCH_DAY               // Today's fixtures live, the points table, on to the next day
 } WorldCupSetupStep;
 
 static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameSounds *sounds) {
@@ -3235,6 +3765,22 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
     static int current_match_idx = 0;
     static int num_wc_matches = 0;
 
+    // Match days: the fixtures are ordered by day, the user's are played on the GUI and
+    // the rest by the background simulation service
+    static int wc_match_day[MAX_MATCHES_IN_TOURNAMENT];
+    static char wc_match_venue[MAX_MATCHES_IN_TOURNAMENT][MAX_GROUND_NAME_LEN];
+    static int num_wc_days = 0;
+    static int current_day = 0;
+    static int day_to_open = -1;
+    static int wc_results[MAX_MATCHES_IN_TOURNAMENT]; // User fixtures only, WC_RESULT_PENDING until played
+    static QualFixture wc_user_scores[MAX_MATCHES_IN_TOURNAMENT]; // Runs and balls of the user's finished fixtures, for net run rate
+    static bool show_odds = false;
+    static bool wc_odds_dirty = true;
+    static bool user_match_started = false;
+    static PointsTableEntry wc_points[MAX_TEAMS_IN_TOURNAMENT];
+    static int num_wc_points = 0;
+    static bool wc_points_dirty = true;
+
     // State for pre-match setup
     static time_t tournament_start_date;
     static float rain_percentage = 0.0f;
@@ -3245,20 +3791,27 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
     static float toss_rotation = 0.0f;
     static float toss_velocity = 3600.0f;
     static int toss_call = -1; // 0 for Heads, 1 for Tails
-    static double toss_end_time = 0.0;
     static int toss_result = -1;
 
     static Vector2 scroll = {0, 0};
 
+    // Fixture table layout, rebuilt only when the fixtures or the start date change
+    static bool fixtures_layout_dirty = true;
+    static time_t fixtures_layout_date = 0;
+    static float fixture_col_widths[6];
+    static char fixture_dates[MAX_MATCHES_IN_TOURNAMENT][32];
+
     const Rectangle backButton = { 20, GetScreenHeight() - 60, 150, 40 };
 
     // --- Logic ---
     if (needs_refresh) {
+        sim_service_stop(); // Its copies of the teams outlive wc_teams, but the results are for this tournament only
+        qualification_stop();
         if (all_teams) free(all_teams);
         if (selected_teams_mask) free(selected_teams_mask);
         if (wc_teams) { free(wc_teams); wc_teams = NULL; }
 
-        all_teams = load_teams(&num_all_teams);
+        all_teams = LoadTeamsPreloaded(&num_all_teams);
         if (num_all_teams > 0) {
             selected_teams_mask = calloc(num_all_teams, sizeof(bool));
         }
@@ -3269,27 +3822,50 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
         validation_error[0] = '\0';
         num_wc_matches = 0;
         current_match_idx = 0;
-        toss_call = -1; toss_result = -1; toss_end_time = 0.0;
+        num_wc_days = 0;
+        current_day = 0;
+        day_to_open = -1;
+        user_match_started = false;
+        toss_call = -1; toss_result = -1;
         squad_selection_turn = 0;
     }
 
+    // Open a match day: its background fixtures go live and the user plays theirs first, if any
+    if (day_to_open >= 0) {
+        int first = 0, last = 0;
+        while (first < num_wc_matches && wc_match_day[first] < day_to_open) first++;
+        last = first;
+        while (last < num_wc_matches && wc_match_day[last] == day_to_open) last++;
+        sim_service_open_day(first, last);
+
+        current_day = day_to_open;
+        current_match_idx = -1;
+        for (int i = first; i < last; i++) {
+            if (wc_matches[i].teamA == &wc_teams[user_team_idx] || wc_matches[i].teamB == &wc_teams[user_team_idx]) current_match_idx = i;
+        }
+        user_match_started = false;
+        currentStep = (current_match_idx >= 0) ? WC_STEP_PRE_MATCH : WC_STEP_MATCH_DAY;
+        wc_points_dirty = true;
+        day_to_open = -1;
+    }
+
     if (CheckCollisionPointRec(GetMousePosition(), backButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-        if (IsSoundPlaying(sounds->toss)) StopSound(sounds->toss);
+        if (audio_clip_is_playing(&sounds->toss)) audio_clip_stop(&sounds->toss);
         ChangeScreen(state, SCREEN_MATCH_SETUP);
         needs_refresh = true; // Force a full refresh next time we enter this screen
     }
 
     // --- Drawing ---
-    BeginDrawing();
-    ClearBackground(ICC_BG);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
 
     switch (currentStep) {
         case WC_STEP_TEAM_SELECTION: {
-            DrawTextBold("World Cup Setup: Select Teams", GetScreenWidth() / 2 - MeasureText("World Cup Setup: Select Teams", 40) / 2, 20, 40, ICC_GRAY);
-            DrawText("Choose the teams that will participate in the tournament.", GetScreenWidth() / 2 - MeasureText("Choose the teams that will participate in the tournament.", 20) / 2, 70, 20, ICC_GRAY);
+            DrawTextBold("World Cup Setup: Select Teams", GetScreenWidth() / 2 - text_cache_measure("World Cup Setup: Select Teams", 40) / 2, 20, 40, ICC_GRAY);
+            GfxDrawText("Choose the teams that will participate in the tournament.", GetScreenWidth() / 2 - text_cache_measure("Choose the teams that will participate in the tournament.", 20) / 2, 70, 20, ICC_GRAY);
 
             if (num_all_teams == 0) {
-                DrawText("No teams available. Please create teams first.", 50, 150, 20, ICC_RED);
+                GfxDrawText("No teams available. Please create teams first.", 50, 150, 20, ICC_RED);
             } else {
                 const int buttonWidth = 300;
                 const int buttonHeight = 40;
@@ -3304,8 +3880,8 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                     Rectangle teamButton = { 50 + col * (buttonWidth + 20), 120 + row * (buttonHeight + 10), buttonWidth, buttonHeight };
                     
                     bool isSelected = selected_teams_mask[i];
-                    DrawRectangleRec(teamButton, isSelected ? ICC_BLUE : ICC_GRAY);
-                    DrawText(all_teams[i].name, teamButton.x + 15, teamButton.y + 10, 20, isSelected ? ICC_WHITE : ICC_WHITE);
+                    GfxDrawRectangleRec(teamButton, isSelected ? ICC_BLUE : ICC_GRAY);
+                    GfxDrawText(all_teams[i].name, teamButton.x + 15, teamButton.y + 10, 20, isSelected ? ICC_WHITE : ICC_WHITE);
 
                     if (CheckCollisionPointRec(GetMousePosition(), teamButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                         selected_teams_mask[i] = !selected_teams_mask[i];
@@ -3318,7 +3894,7 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 float startX = (GetScreenWidth() - totalButtonsWidth) / 2;
 
                 Rectangle selectAllButton = { startX, buttonRowY, 150, 40 };
-                DrawRectangleRec(selectAllButton, ICC_BLUE);
+                GfxDrawRectangleRec(selectAllButton, ICC_BLUE);
                 DrawTextBold("Select All", selectAllButton.x + 35, selectAllButton.y + 10, 20, ICC_WHITE);
                 if (CheckCollisionPointRec(GetMousePosition(), selectAllButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     for (int i = 0; i < num_all_teams; i++) {
@@ -3329,7 +3905,7 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 }
 
                 Rectangle deselectAllButton = { startX + 160, buttonRowY, 150, 40 };
-                DrawRectangleRec(deselectAllButton, ICC_RED);
+                GfxDrawRectangleRec(deselectAllButton, ICC_RED);
                 DrawTextBold("Deselect All", deselectAllButton.x + 25, deselectAllButton.y + 10, 20, ICC_WHITE);
                 if (CheckCollisionPointRec(GetMousePosition(), deselectAllButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     for (int i = 0; i < num_all_teams; i++) {
@@ -3339,7 +3915,7 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
 
                 // "Next" button to proceed to squad selection
                 Rectangle nextButton = { GetScreenWidth() - 200, buttonRowY, 150, 40 };
-    DrawRectangleRec(nextButton, ICC_GREEN);
+    GfxDrawRectangleRec(nextButton, ICC_GREEN);
                 DrawTextBold("Next", nextButton.x + 50, nextButton.y + 10, 20, ICC_WHITE);
                 if (CheckCollisionPointRec(GetMousePosition(), nextButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     // Count selected teams and prepare for squad selection
@@ -3364,14 +3940,14 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                     }
                 }
                 if (validation_error[0] != '\0') {
-                    DrawText(validation_error, GetScreenWidth() - MeasureText(validation_error, 20) - 220, GetScreenHeight() - 50, 20, ICC_RED);
+                    GfxDrawText(validation_error, GetScreenWidth() - text_cache_measure(validation_error, 20) - 220, GetScreenHeight() - 50, 20, ICC_RED);
                 }
             }
             break;
         }
         case WC_STEP_USER_TEAM_CHOICE: {
-            DrawTextBold("Choose Your Team", GetScreenWidth() / 2 - MeasureText("Choose Your Team", 40) / 2, 20, 40, ICC_GRAY);
-            DrawText("Select the team you want to play as for the World Cup.", GetScreenWidth() / 2 - MeasureText("Select the team you want to play as for the World Cup.", 20) / 2, 70, 20, ICC_GRAY);
+            DrawTextBold("Choose Your Team", GetScreenWidth() / 2 - text_cache_measure("Choose Your Team", 40) / 2, 20, 40, ICC_GRAY);
+            GfxDrawText("Select the team you want to play as for the World Cup.", GetScreenWidth() / 2 - text_cache_measure("Select the team you want to play as for the World Cup.", 20) / 2, 70, 20, ICC_GRAY);
 
             const int buttonWidth = 300;
             const int buttonHeight = 40;
@@ -3381,8 +3957,8 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 int col = i % columns;
                 int row = i / columns;
                 Rectangle teamButton = { 50 + col * (buttonWidth + 20), 120 + row * (buttonHeight + 10), buttonWidth, buttonHeight };
-                DrawRectangleRec(teamButton, ICC_GRAY);
-                DrawText(wc_teams[i].name, teamButton.x + 15, teamButton.y + 10, 20, ICC_WHITE);
+                GfxDrawRectangleRec(teamButton, ICC_GRAY);
+                GfxDrawText(wc_teams[i].name, teamButton.x + 15, teamButton.y + 10, 20, ICC_WHITE);
 
                 if (CheckCollisionPointRec(GetMousePosition(), teamButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     user_team_idx = i;
@@ -3441,67 +4017,80 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                             }
                         }
                     }
-                    // Shuffle the matches to randomize order
-                    for (int i = num_wc_matches - 1; i > 0; i--) {
-                        int j = GetRandomValue(0, i);
-                        Match temp = wc_matches[i];
-                        wc_matches[i] = wc_matches[j];
-                        wc_matches[j] = temp;
+                    num_wc_days = ScheduleWorldCup(wc_matches, &num_wc_matches, wc_teams, num_wc_teams, wc_match_day, wc_match_venue);
+                    if (num_wc_days < 0) {
+                        // Shuffle the matches to randomize order
+                        for (int i = num_wc_matches - 1; i > 0; i--) {
+                            int j = GetRandomValue(0, i);
+                            Match temp = wc_matches[i];
+                            wc_matches[i] = wc_matches[j];
+                            wc_matches[j] = temp;
+                        }
+                        num_wc_days = ScheduleMatchDays(wc_matches, num_wc_matches, wc_teams, wc_match_day);
+                        for (int i = 0; i < num_wc_matches; i++) strcpy(wc_match_venue[i], "TBD");
                     }
+                    fixtures_layout_dirty = true;
                     currentStep = WC_STEP_FIXTURES;
                 }
             }
             break;
         }
         case WC_STEP_FIXTURES: {
-            DrawTextBold("Tournament Fixtures", GetScreenWidth() / 2 - MeasureText("Tournament Fixtures", 40) / 2, 20, 40, ICC_GRAY);
-            DrawText("All teams will play each other once.", GetScreenWidth() / 2 - MeasureText("All teams will play each other once.", 20) / 2, 70, 20, ICC_GRAY);
+            DrawTextBold("Tournament Fixtures", GetScreenWidth() / 2 - text_cache_measure("Tournament Fixtures", 40) / 2, 20, 40, ICC_GRAY);
+            GfxDrawText("All teams will play each other once.", GetScreenWidth() / 2 - text_cache_measure("All teams will play each other once.", 20) / 2, 70, 20, ICC_GRAY);
 
             Rectangle view = { 50, 110, GetScreenWidth() - 100, GetScreenHeight() - 220 };
-            DrawRectangleLinesEx(view, 1, ICC_GRAY);
+            GfxDrawRectangleLinesEx(view, 1, ICC_GRAY);
 
             const float itemHeight = 30.0f;
+            const float flagWidth = 27.0f, flagHeight = 18.0f; // Small flag drawn before each team name
+            const float flagSpace = flagWidth + 6.0f;
             
             // --- Dynamic Column Width Calculation ---
-            const char* fixture_headers[] = { "#", "Team A", "Team B", "Date", "Time" };
-            float col_widths[5] = {0}; // Initialize with 0
-
-            // Determine max width for each column from headers
-            for (int i = 0; i < 5; i++) {
-                col_widths[i] = MeasureText(fixture_headers[i], 18);
-            }
-
-            // Determine max width from match data
-            for (int i = 0; i < num_wc_matches; i++) {
-                char buffer[64];
-                // Match #
-                sprintf(buffer, "%d.", i + 1);
-                float width = MeasureText(buffer, 18);
-                if (width > col_widths[0]) col_widths[0] = width;
-
-                // Team A
-                width = MeasureText(wc_matches[i].teamA->name, 18);
-                if (width > col_widths[1]) col_widths[1] = width;
-
-                // Team B
-                width = MeasureText(wc_matches[i].teamB->name, 18);
-                if (width > col_widths[2]) col_widths[2] = width;
+            const char* fixture_headers[] = { "#", "Team A", "Team B", "Date", "Time", "Ground" };
+            float *col_widths = fixture_col_widths;
 
-                // Date
-                time_t match_date_t = tournament_start_date + (i * 24 * 60 * 60);
-                struct tm *match_tm = localtime(&match_date_t);
-                char date_str[32];
-                strftime(date_str, sizeof(date_str), "%a, %b %d", match_tm);
-                width = MeasureText(date_str, 18);
-                if (width > col_widths[3]) col_widths[3] = width;
+            if (fixtures_layout_dirty || fixtures_layout_date != tournament_start_date) {
+                // Determine max width for each column from headers
+                for (int i = 0; i < 6; i++) {
+                    col_widths[i] = text_cache_measure(fixture_headers[i], 18);
+                }
 
+                // Determine max width from match data
+                for (int i = 0; i < num_wc_matches; i++) {
+                    // Match #
+                    float width = text_cache_measure(TextFormat("%d.", i + 1), 18);
+                    if (width > col_widths[0]) col_widths[0] = width;
+
+                    // Team A
+                    width = flagSpace + text_cache_measure(wc_matches[i].teamA->name, 18);
+                    if (width > col_widths[1]) col_widths[1] = width;
+
+                    // Team B
+                    width = flagSpace + text_cache_measure(wc_matches[i].teamB->name, 18);
+                    if (width > col_widths[2]) col_widths[2] = width;
+
+                    // Date
+                    time_t match_date_t = tournament_start_date + (wc_match_day[i] * 24 * 60 * 60);
+                    struct tm *match_tm = localtime(&match_date_t);
+                    strftime(fixture_dates[i], sizeof(fixture_dates[i]), "%a, %b %d", match_tm);
+                    width = text_cache_measure(fixture_dates[i], 18);
+                    if (width > col_widths[3]) col_widths[3] = width;
+
+                    // Ground
+                    width = text_cache_measure(wc_match_venue[i], 18);
+                    if (width > col_widths[5]) col_widths[5] = width;
+                }
                 // Time (fixed for now)
-                width = MeasureText("10:00 AM", 18);
+                float width = text_cache_measure("10:00 AM", 18);
                 if (width > col_widths[4]) col_widths[4] = width;
+
+                fixtures_layout_dirty = false;
+                fixtures_layout_date = tournament_start_date;
             }
             const int col_padding = 25;
             float contentWidth = 20; // Initial left padding
-            for (int i = 0; i < 5; i++) {
+            for (int i = 0; i < 6; i++) {
                 contentWidth += col_widths[i] + col_padding;
             }
             float contentHeight = 40 + (num_wc_matches * itemHeight);
@@ -3527,56 +4116,61 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 }
             }
             
-            BeginScissorMode(scissorView.x, scissorView.y, scissorView.width, scissorView.height);
+            GfxBeginScissorMode(scissorView.x, scissorView.y, scissorView.width, scissorView.height);
 
             // Calculate column x positions
-            float col_x[5];
+            float col_x[6];
             col_x[0] = scissorView.x + 10 + scroll.x;
-            for (int i = 1; i < 5; i++) {
+            for (int i = 1; i < 6; i++) {
                 col_x[i] = col_x[i-1] + col_widths[i-1] + col_padding;
             }
 
             // Draw Headers
             int y_header = view.y + 10 + scroll.y;
-            for (int i = 0; i < 5; i++) {
-                DrawText(fixture_headers[i], col_x[i], y_header, 18, ICC_YELLOW);
+            for (int i = 0; i < 6; i++) {
+                text_cache_draw(fixture_headers[i], col_x[i], y_header, 18, TEXT_STYLE_PLAIN, ICC_YELLOW);
             }
-            DrawLine(view.x + 10, y_header + 24, view.x + view.width - 10, y_header + 24, ICC_YELLOW);
+            GfxDrawLine(view.x + 10, y_header + 24, view.x + view.width - 10, y_header + 24, ICC_YELLOW);
 
 
-            // Draw Match Data
-            for (int i = 0; i < num_wc_matches; i++) {
+            // Draw Match Data (only the rows inside the view)
+            int first_row = (int)((-scroll.y - 40) / itemHeight);
+            int last_row = (int)((-scroll.y + scissorView.height - 40) / itemHeight) + 1;
+            if (first_row < 0) first_row = 0;
+            if (last_row > num_wc_matches) last_row = num_wc_matches;
+            for (int i = first_row; i < last_row; i++) {
                 float y_pos = view.y + 40 + (i * itemHeight) + scroll.y;
                 
                 // Match #
-                DrawText(TextFormat("%d.", i + 1), col_x[0], y_pos, 18, ICC_WHITE);
+                text_cache_draw(TextFormat("%d.", i + 1), col_x[0], y_pos, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
 
                 // Team A
-                DrawText(wc_matches[i].teamA->name, col_x[1], y_pos, 18, ICC_WHITE);
+                flag_atlas_draw(wc_matches[i].teamA->name, (Rectangle){ col_x[1], y_pos, flagWidth, flagHeight }, ICC_WHITE);
+                text_cache_draw(wc_matches[i].teamA->name, col_x[1] + flagSpace, y_pos, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
 
                 // Team B
-                DrawText(wc_matches[i].teamB->name, col_x[2], y_pos, 18, ICC_WHITE);
+                flag_atlas_draw(wc_matches[i].teamB->name, (Rectangle){ col_x[2], y_pos, flagWidth, flagHeight }, ICC_WHITE);
+                text_cache_draw(wc_matches[i].teamB->name, col_x[2] + flagSpace, y_pos, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
 
                 // Date
-                time_t match_date_t = tournament_start_date + (i * 24 * 60 * 60);
-                struct tm *match_tm = localtime(&match_date_t);
-                char date_str[32];
-                strftime(date_str, sizeof(date_str), "%a, %b %d", match_tm);
-                DrawText(date_str, col_x[3], y_pos, 18, ICC_WHITE);
+                text_cache_draw(fixture_dates[i], col_x[3], y_pos, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
 
                 // Time
-                DrawText("10:00 AM", col_x[4], y_pos, 18, ICC_WHITE);
+                text_cache_draw("10:00 AM", col_x[4], y_pos, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
+
+                // Ground
+                text_cache_draw(wc_match_venue[i], col_x[5], y_pos, 18, TEXT_STYLE_PLAIN, ICC_WHITE);
             }
-            EndScissorMode();
+            GfxEndScissorMode();
             if (vertScrollbarRequired) {
                 Rectangle scrollBarArea = { scissorView.x + scissorView.width, scissorView.y, 10, scissorView.height };
-                DrawRectangleRec(scrollBarArea, LIGHTGRAY);
+                GfxDrawRectangleRec(scrollBarArea, LIGHTGRAY);
                 
                 float handleHeight = (scissorView.height / contentHeight) * scissorView.height;
                 if (handleHeight < 20) handleHeight = 20; // Minimum handle size
                 float handleY = scissorView.y + (-scroll.y / (contentHeight - scissorView.height)) * (scissorView.height - handleHeight);
                 Rectangle scrollHandle = { scrollBarArea.x, handleY, 10, handleHeight };
-                DrawRectangleRec(scrollHandle, GRAY);
+                GfxDrawRectangleRec(scrollHandle, GRAY);
 
                 static bool isDragging = false;
                 if (CheckCollisionPointRec(GetMousePosition(), scrollHandle) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) isDragging = true;
@@ -3590,13 +4184,13 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
             }
             if (horizScrollbarRequired) {
                 Rectangle scrollBarArea = { scissorView.x, scissorView.y + scissorView.height, scissorView.width, 10 };
-                DrawRectangleRec(scrollBarArea, LIGHTGRAY);
+                GfxDrawRectangleRec(scrollBarArea, LIGHTGRAY);
                 
                 float handleWidth = (scissorView.width / contentWidth) * scissorView.width;
                 if (handleWidth < 20) handleWidth = 20; // Minimum handle size
                 float handleX = scissorView.x + (-scroll.x / (contentWidth - scissorView.width)) * (scissorView.width - handleWidth);
                 Rectangle scrollHandle = { handleX, scrollBarArea.y, handleWidth, 10 };
-                DrawRectangleRec(scrollHandle, GRAY);
+                GfxDrawRectangleRec(scrollHandle, GRAY);
 
                 static bool isDragging = false;
                 if (CheckCollisionPointRec(GetMousePosition(), scrollHandle) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) isDragging = true;
@@ -3610,13 +4204,21 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
             }
 
             Rectangle startButton = { GetScreenWidth() - 220, GetScreenHeight() - 60, 200, 40 };
-            DrawRectangleRec(startButton, ICC_GREEN);
+            GfxDrawRectangleRec(startButton, ICC_GREEN);
             DrawTextBold("Start Tournament", startButton.x + 20, startButton.y + 10, 20, ICC_WHITE);
             if (CheckCollisionPointRec(GetMousePosition(), startButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                current_match_idx = 0;
                 tournament_start_date = time(NULL); // Set start date to today
-                // TODO: Here we would start iterating through matches. For now, we go to pre-match for the first user match.
-                currentStep = WC_STEP_PRE_MATCH;
+
+                // Every fixture without the user is played out on the worker pool right away
+                bool background[MAX_MATCHES_IN_TOURNAMENT];
+                for (int i = 0; i < num_wc_matches; i++) {
+                    background[i] = wc_matches[i].teamA != &wc_teams[user_team_idx] && wc_matches[i].teamB != &wc_teams[user_team_idx];
+                    wc_results[i] = WC_RESULT_PENDING;
+                    wc_user_scores[i] = (QualFixture){ 0 };
+                }
+                wc_odds_dirty = true;
+                sim_service_start(workerPool, wc_matches, background, num_wc_matches, (uint32_t)tournament_start_date, GameRatings());
+                day_to_open = 0;
             }
             break;
         }
@@ -3625,33 +4227,22 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
             char title[256];
             
             // Calculate match date
-            time_t match_date_t = tournament_start_date + (current_match_idx * 24 * 60 * 60); // Add days
+            time_t match_date_t = tournament_start_date + (wc_match_day[current_match_idx] * 24 * 60 * 60); // Add days
             struct tm *match_tm = localtime(&match_date_t);
             char date_str[64];
             strftime(date_str, sizeof(date_str), "%A, %B %d, %Y", match_tm);
 
             sprintf(title, "%s vs %s", currentMatch->teamA->name, currentMatch->teamB->name);
-            DrawTextBold(title, GetScreenWidth() / 2 - MeasureText(title, 40) / 2, 20, 40, ICC_GRAY);
-            DrawText(date_str, GetScreenWidth() / 2 - MeasureText(date_str, 20) / 2, 70, 20, ICC_GRAY);
+            DrawTextBold(title, GetScreenWidth() / 2 - text_cache_measure(title, 40) / 2, 20, 40, ICC_GRAY);
+            GfxDrawText(date_str, GetScreenWidth() / 2 - text_cache_measure(date_str, 20) / 2, 70, 20, ICC_GRAY);
             
             // --- Distinguish between User and AI matches ---
             Team* user_team = &wc_teams[user_team_idx];
             bool is_user_match = (currentMatch->teamA == user_team) || (currentMatch->teamB == user_team);
 
             if (!is_user_match) {
-                DrawText("Simulating AI vs AI match...", GetScreenWidth()/2 - MeasureText("Simulating AI vs AI match...", 30)/2, GetScreenHeight()/2, 30, ICC_GRAY);
-                
-                // Use the toss_end_time as a delay timer before skipping to the next match
-                if (toss_end_time == 0) toss_end_time = GetTime() + 1.5; // Initial delay
-                if (GetTime() > toss_end_time) {
-                    current_match_idx++;
-                    if (current_match_idx >= num_wc_matches) {
-                        currentStep = WC_STEP_FIXTURES; // Loop back to fixtures for now
-                    }
-                    // Reset for the next match (which might also be AI)
-                    toss_end_time = GetTime() + 1.5; 
-                }
-                break; // Skip the rest of the pre-match logic for AI matches
+                currentStep = WC_STEP_MATCH_DAY; // AI fixtures are played by the simulation service
+                break;
             }
 
 
@@ -3663,30 +4254,31 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                     toss_velocity = 0;
                     toss_in_progress = false;
                     toss_result = (rand() % 2); // 0 for Heads, 1 for Tails
-                    toss_end_time = GetTime() + 5.0; // Set time to hold the result for 5 seconds
                 }
-                DrawCircle(GetScreenWidth() / 2, GetScreenHeight() / 2, 100, ICC_YELLOW);
-                DrawTextPro(GetFontDefault(), "H", (Vector2){GetScreenWidth()/2, GetScreenHeight()/2}, (Vector2){50,50}, toss_rotation, 100, 10, ICC_WHITE);
+                GfxDrawCircle(GetScreenWidth() / 2, GetScreenHeight() / 2, 100, ICC_YELLOW);
+                GfxDrawTextPro(GetFontDefault(), "H", (Vector2){GetScreenWidth()/2, GetScreenHeight()/2}, (Vector2){50,50}, toss_rotation, 100, 10, ICC_WHITE);
             } else if (toss_call == -1) { // Ask for user's call
-                if (!IsSoundPlaying(sounds->toss)) PlaySound(sounds->toss);
+                if (!audio_clip_is_playing(&sounds->toss)) audio_clip_play(&sounds->toss);
                 // --- Draw the captains and umpire before the toss ---
                 Vector2 captainAPos = { GetScreenWidth()/2 - 200, GetScreenHeight()/2 };
                 Vector2 captainBPos = { GetScreenWidth()/2 + 200, GetScreenHeight()/2 };
                 Vector2 umpirePos = { GetScreenWidth()/2, GetScreenHeight()/2 - 50 };
 
-                DrawPlayerFigure(captainAPos, ICC_BLUE, false, currentMatch->teamA->name, false);
-                DrawText(currentMatch->teamA->players[0].name, captainAPos.x - MeasureText(currentMatch->teamA->players[0].name, 10)/2, captainAPos.y + 30, 10, ICC_WHITE);
+                figure_batch_begin();
+                QueuePlayerFigure(captainAPos, ICC_BLUE, FIGURE_POSE_FIELDING, currentMatch->teamA->name);
+                figure_batch_label(currentMatch->teamA->players[0].name, captainAPos.x, captainAPos.y + 30, 10, ICC_WHITE);
 
-                DrawPlayerFigure(captainBPos, ICC_RED, false, currentMatch->teamB->name, false);
-                DrawText(currentMatch->teamB->players[0].name, captainBPos.x - MeasureText(currentMatch->teamB->players[0].name, 10)/2, captainBPos.y + 30, 10, ICC_WHITE);
+                QueuePlayerFigure(captainBPos, ICC_RED, FIGURE_POSE_FIELDING, currentMatch->teamB->name);
+                figure_batch_label(currentMatch->teamB->players[0].name, captainBPos.x, captainBPos.y + 30, 10, ICC_WHITE);
 
-                DrawPlayerFigure(umpirePos, ICC_WHITE, false, "Umpire", false);
+                QueuePlayerFigure(umpirePos, ICC_WHITE, FIGURE_POSE_FIELDING, "Umpire");
+                figure_batch_flush();
 // ---
-                DrawText("Call the Toss!", GetScreenWidth() / 2 - MeasureText("Call the Toss!", 30) / 2, 200, 30, ICC_BLUE);
+                GfxDrawText("Call the Toss!", GetScreenWidth() / 2 - text_cache_measure("Call the Toss!", 30) / 2, 200, 30, ICC_BLUE);
                 Rectangle headsBtn = { GetScreenWidth() / 2 - 210, 250, 200, 50 };
                 Rectangle tailsBtn = { GetScreenWidth() / 2 + 10, 250, 200, 50 };
-                DrawRectangleRec(headsBtn, ICC_GRAY); DrawText("HEADS", headsBtn.x + 60, headsBtn.y + 15, 20, ICC_WHITE);
-                DrawRectangleRec(tailsBtn, ICC_GRAY); DrawText("TAILS", tailsBtn.x + 65, tailsBtn.y + 15, 20, ICC_WHITE);
+                GfxDrawRectangleRec(headsBtn, ICC_GRAY); GfxDrawText("HEADS", headsBtn.x + 60, headsBtn.y + 15, 20, ICC_WHITE);
+                GfxDrawRectangleRec(tailsBtn, ICC_GRAY); GfxDrawText("TAILS", tailsBtn.x + 65, tailsBtn.y + 15, 20, ICC_WHITE);
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     if (CheckCollisionPointRec(GetMousePosition(), headsBtn)) toss_call = 0;
                     if (CheckCollisionPointRec(GetMousePosition(), tailsBtn)) toss_call = 1;
@@ -3701,20 +4293,20 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 static int toss_choice = -1; // 0 for bat, 1 for field
 
                 sprintf(toss_result_text, "It's %s. You %s the toss!", toss_result == 0 ? "Heads" : "Tails", user_won_toss ? "WON" : "LOST");
-                DrawText(toss_result_text, GetScreenWidth() / 2 - MeasureText(toss_result_text, 30) / 2, 120, 30, user_won_toss ? ICC_GREEN : ICC_RED);
+                GfxDrawText(toss_result_text, GetScreenWidth() / 2 - text_cache_measure(toss_result_text, 30) / 2, 120, 30, user_won_toss ? ICC_GREEN : ICC_RED);
 
                 // --- Draw the stationary coin showing the correct result ---
                 const char* coin_face = (toss_result == 0) ? "H" : "T";
-                DrawCircle(GetScreenWidth() / 2, GetScreenHeight() / 2, 100, ICC_YELLOW);
-                DrawText(coin_face, GetScreenWidth() / 2 - MeasureText(coin_face, 100)/2, GetScreenHeight() / 2 - 50, 100, ICC_WHITE);
+                GfxDrawCircle(GetScreenWidth() / 2, GetScreenHeight() / 2, 100, ICC_YELLOW);
+                GfxDrawText(coin_face, GetScreenWidth() / 2 - text_cache_measure(coin_face, 100)/2, GetScreenHeight() / 2 - 50, 100, ICC_WHITE);
 
                 if (user_won_toss) {
                     if (toss_choice == -1) {
-                        DrawText("What will you do?", GetScreenWidth() / 2 - MeasureText("What will you do?", 20) / 2, 300, 20, ICC_WHITE);
+                        GfxDrawText("What will you do?", GetScreenWidth() / 2 - text_cache_measure("What will you do?", 20) / 2, 300, 20, ICC_WHITE);
                         Rectangle batBtn = { GetScreenWidth() / 2 - 155, 330, 150, 50 };
                         Rectangle fieldBtn = { GetScreenWidth() / 2 + 5, 330, 150, 50 };
-                        DrawRectangleRec(batBtn, ICC_GRAY); DrawText("BAT", batBtn.x + 55, batBtn.y + 15, 20, ICC_WHITE);
-                        DrawRectangleRec(fieldBtn, ICC_GRAY); DrawText("FIELD", fieldBtn.x + 50, fieldBtn.y + 15, 20, ICC_WHITE);
+                        GfxDrawRectangleRec(batBtn, ICC_GRAY); GfxDrawText("BAT", batBtn.x + 55, batBtn.y + 15, 20, ICC_WHITE);
+                        GfxDrawRectangleRec(fieldBtn, ICC_GRAY); GfxDrawText("FIELD", fieldBtn.x + 50, fieldBtn.y + 15, 20, ICC_WHITE);
 
                         if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                             if (CheckCollisionPointRec(GetMousePosition(), batBtn)) {
@@ -3738,14 +4330,14 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                     } else {
                         sprintf(choice_text, "Opponent chose to %s first.", toss_choice == 0 ? "BAT" : "FIELD");
                     }
-                    DrawText(choice_text, GetScreenWidth() / 2 - MeasureText(choice_text, 20) / 2, GetScreenHeight() - 100, 20, ICC_BLUE);
+                    GfxDrawText(choice_text, GetScreenWidth() / 2 - text_cache_measure(choice_text, 20) / 2, GetScreenHeight() - 100, 20, ICC_BLUE);
                     
                     // --- Proceed Button ---
                     Rectangle proceedButton = { GetScreenWidth() - 220, GetScreenHeight() - 60, 200, 40 };
-                    DrawRectangleRec(proceedButton, ICC_GREEN);
+                    GfxDrawRectangleRec(proceedButton, ICC_GREEN);
                     DrawTextBold("Select Playing XI", proceedButton.x + 15, proceedButton.y + 10, 20, ICC_WHITE);
                     if (CheckCollisionPointRec(GetMousePosition(), proceedButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                        if (IsSoundPlaying(sounds->toss)) StopSound(sounds->toss);
+                        if (audio_clip_is_playing(&sounds->toss)) audio_clip_stop(&sounds->toss);
                         // Transition to the player selection screen for this match
                         currentStep = WC_STEP_SQUAD_SELECTION;
                         squad_selection_turn = 0; // Start with the user's team
@@ -3783,33 +4375,22 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 team_to_select_for = opponent_team;
             }
 
-            // Autoplay logic for non-user matches
-             if (currentMatch->teamA != user_team && currentMatch->teamB != user_team) {
-                 // This is not the user's match, so it should be autoplayed.
-                 // For now, we'll just go to a placeholder.
-                 // TODO: Implement autoplay logic for non-user matches.
-                 DrawText("AUTOPLAYING MATCH...", 100, 100, 30, ICC_GRAY);
-                 // In a real scenario, you'd simulate the match here and move to the next one.
-                 // For now, we just get stuck on a placeholder.
-                 break;
-             }
-
             char title[256];
             sprintf(title, "Select Playing XI for %s", team_to_select_for->name);
-            DrawTextBold(title, GetScreenWidth() / 2 - MeasureText(title, 40) / 2, 20, 40, ICC_GRAY);
+            DrawTextBold(title, GetScreenWidth() / 2 - text_cache_measure(title, 40) / 2, 20, 40, ICC_GRAY);
 
             int selected_count = 0;
             Rectangle defaultXIButton = { GetScreenWidth() - 230, 75, 200, 30 };
-            DrawRectangleRec(defaultXIButton, VIOLET);
+            GfxDrawRectangleRec(defaultXIButton, VIOLET);
             DrawTextBold("Select Default XI", defaultXIButton.x + 20, defaultXIButton.y + 5, 20, ICC_WHITE);
 
 
             for(int i=0; i<team_to_select_for->num_players; i++) if(player_selection_mask[i]) selected_count++;
-            DrawText(TextFormat("Selected: %d/11", selected_count), 50, 80, 20, selected_count == 11 ? ICC_GREEN : ICC_WHITE);
+            GfxDrawText(TextFormat("Selected: %d/11", selected_count), 50, 80, 20, selected_count == 11 ? ICC_GREEN : ICC_WHITE);
 
             // Player list
             Rectangle view = { 50, 110, GetScreenWidth() - 100, GetScreenHeight() - 220 };
-            DrawRectangleLinesEx(view, 1, ICC_GRAY);
+            GfxDrawRectangleLinesEx(view, 1, ICC_GRAY);
 
             const float itemHeight = 30.0f;
             if (CheckCollisionPointRec(GetMousePosition(), view)) {
@@ -3817,18 +4398,18 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 if (scroll.y > 0) scroll.y = 0;
             }
 
-            BeginScissorMode(view.x, view.y, view.width, view.height);
+            GfxBeginScissorMode(view.x, view.y, view.width, view.height);
             for (int i = 0; i < team_to_select_for->num_players; i++) {
                 Rectangle playerButton = { view.x + 10, view.y + 10 + (i * itemHeight) + scroll.y, view.width - 200, itemHeight - 2 };
                 bool isSelected = player_selection_mask[i];
-                DrawRectangleRec(playerButton, isSelected ? SKYBLUE : ICC_GRAY);
+                GfxDrawRectangleRec(playerButton, isSelected ? SKYBLUE : ICC_GRAY);
                 
                 char player_text[256];
                 sprintf(player_text, "%s", team_to_select_for->players[i].name);
                 if (i == designated_wk_idx) strcat(player_text, " (WK)");
                 if (i == team_to_select_for->captain_idx) strcat(player_text, " (C)");
                 if (i == team_to_select_for->vice_captain_idx) strcat(player_text, " (VC)");
-                DrawText(player_text, playerButton.x + 10, playerButton.y + 5, 20, ICC_WHITE);
+                GfxDrawText(player_text, playerButton.x + 10, playerButton.y + 5, 20, ICC_WHITE);
 
                 if (CheckCollisionPointRec(GetMousePosition(), playerButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     player_selection_mask[i] = !player_selection_mask[i];
@@ -3838,8 +4419,8 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
 
                 if (team_to_select_for->players[i].is_wicketkeeper) {
                     Rectangle wk_button = { buttonX, playerButton.y, 40, itemHeight - 2 };
-                    DrawRectangleRec(wk_button, (i == designated_wk_idx) ? ICC_GREEN : ICC_GRAY);
-                    DrawText("WK", wk_button.x + 10, wk_button.y + 5, 20, ICC_WHITE);
+                    GfxDrawRectangleRec(wk_button, (i == designated_wk_idx) ? ICC_GREEN : ICC_GRAY);
+                    GfxDrawText("WK", wk_button.x + 10, wk_button.y + 5, 20, ICC_WHITE);
                     if (CheckCollisionPointRec(GetMousePosition(), wk_button) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                         designated_wk_idx = i;
                     }
@@ -3849,10 +4430,10 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 Rectangle c_button = { buttonX, playerButton.y, 40, itemHeight - 2 };
                 Rectangle vc_button = { c_button.x + c_button.width + 5, playerButton.y, 40, itemHeight - 2 };
 
-                DrawRectangleRec(c_button, (i == team_to_select_for->captain_idx) ? ICC_YELLOW : ICC_GRAY);
-                DrawText("C", c_button.x + 15, c_button.y + 5, 20, ICC_WHITE);
-                DrawRectangleRec(vc_button, (i == team_to_select_for->vice_captain_idx) ? SILVER : ICC_GRAY);
-                DrawText("VC", vc_button.x + 10, vc_button.y + 5, 20, ICC_WHITE);
+                GfxDrawRectangleRec(c_button, (i == team_to_select_for->captain_idx) ? ICC_YELLOW : ICC_GRAY);
+                GfxDrawText("C", c_button.x + 15, c_button.y + 5, 20, ICC_WHITE);
+                GfxDrawRectangleRec(vc_button, (i == team_to_select_for->vice_captain_idx) ? SILVER : ICC_GRAY);
+                GfxDrawText("VC", vc_button.x + 10, vc_button.y + 5, 20, ICC_WHITE);
 
                 if (CheckCollisionPointRec(GetMousePosition(), c_button) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     if (i != team_to_select_for->vice_captain_idx) {
@@ -3866,7 +4447,7 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                     }
                 }
             }
-            EndScissorMode();
+            GfxEndScissorMode();
 
             // Handle "Select Default XI" button click
             if (CheckCollisionPointRec(GetMousePosition(), defaultXIButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
@@ -3905,7 +4486,7 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
             // "Start Match" button
             const char* nextButtonText = (squad_selection_turn == 0) ? "Select Opponent XI" : "Start Match";
             Rectangle nextButton = { GetScreenWidth() - 240, GetScreenHeight() - 60, 220, 40 };
-            DrawRectangleRec(nextButton, ICC_GREEN);
+            GfxDrawRectangleRec(nextButton, ICC_GREEN);
             DrawTextBold(nextButtonText, nextButton.x + 20, nextButton.y + 10, 20, ICC_WHITE);
             if (CheckCollisionPointRec(GetMousePosition(), nextButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                 // Validation
@@ -3988,6 +4569,7 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
 
                             // Ensure gameplay mode is set (memset cleared it)
                             gameState->gameplay_mode = GAMEPLAY_MODE_PLAYING;
+                            sim_engine_init(&matchEngine, gameState, (uint32_t)GetRandomValue(1, 0x7FFFFFFF), 0); // No ball left in the field from before
 
                             currentStep = WC_STEP_GROUND_UMPIRE_SELECTION;
                         }
@@ -3995,7 +4577,7 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 }
             }
             if (validation_error[0] != '\0') {
-                DrawText(validation_error, nextButton.x - MeasureText(validation_error, 20) - 20, nextButton.y + 10, 20, ICC_RED);
+                GfxDrawText(validation_error, nextButton.x - text_cache_measure(validation_error, 20) - 20, nextButton.y + 10, 20, ICC_RED);
             }
             break;
         }
@@ -4015,27 +4597,27 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
                 data_loaded = true;
             }
 
-            DrawTextBold("Select Ground and Umpires", GetScreenWidth() / 2 - MeasureText("Select Ground and Umpires", 40) / 2, 20, 40, ICC_GRAY);
+            DrawTextBold("Select Ground and Umpires", GetScreenWidth() / 2 - text_cache_measure("Select Ground and Umpires", 40) / 2, 20, 40, ICC_GRAY);
 
             // Ground Selection
-            DrawText("Select Ground", 50, 100, 20, ICC_GRAY);
+            GfxDrawText("Select Ground", 50, 100, 20, ICC_GRAY);
             for (int i = 0; i < num_grounds; i++) {
                 Rectangle groundButton = { 50, 130 + i * 30, 300, 25 };
                 bool isSelected = (i == ground_idx);
-                DrawRectangleRec(groundButton, isSelected ? ICC_BLUE : ICC_GRAY);
-                DrawText(grounds[i].name, groundButton.x + 10, groundButton.y + 5, 20, isSelected ? ICC_WHITE : ICC_WHITE);
+                GfxDrawRectangleRec(groundButton, isSelected ? ICC_BLUE : ICC_GRAY);
+                GfxDrawText(grounds[i].name, groundButton.x + 10, groundButton.y + 5, 20, isSelected ? ICC_WHITE : ICC_WHITE);
                 if (CheckCollisionPointRec(GetMousePosition(), groundButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     ground_idx = i;
                 }
             }
 
             // Umpire Selection
-            DrawText("Select Two Umpires", 400, 100, 20, ICC_GRAY);
+            GfxDrawText("Select Two Umpires", 400, 100, 20, ICC_GRAY);
             for (int i = 0; i < num_umpires; i++) {
                 Rectangle umpireButton = { 400, 130 + i * 30, 300, 25 };
                 bool isSelected = (i == umpire1_idx || i == umpire2_idx);
-                DrawRectangleRec(umpireButton, isSelected ? ICC_BLUE : ICC_GRAY);
-                DrawText(umpires[i].name, umpireButton.x + 10, umpireButton.y + 5, 20, isSelected ? ICC_WHITE : ICC_WHITE);
+                GfxDrawRectangleRec(umpireButton, isSelected ? ICC_BLUE : ICC_GRAY);
+                GfxDrawText(umpires[i].name, umpireButton.x + 10, umpireButton.y + 5, 20, isSelected ? ICC_WHITE : ICC_WHITE);
                 if (CheckCollisionPointRec(GetMousePosition(), umpireButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     if (umpire1_idx == -1) {
                         umpire1_idx = i;
@@ -4049,27 +4631,179 @@ static void UpdateDrawWcSetupScreen(GuiState *state, GameState *gameState, GameS
             }
 
             Rectangle startButton = { GetScreenWidth() - 220, GetScreenHeight() - 60, 200, 40 };
-            DrawRectangleRec(startButton, ICC_GREEN);
+            GfxDrawRectangleRec(startButton, ICC_GREEN);
             DrawTextBold("Start Match", startButton.x + 40, startButton.y + 10, 20, ICC_WHITE);
 
             if (CheckCollisionPointRec(GetMousePosition(), startButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                 if (ground_idx != -1 && umpire1_idx != -1 && umpire2_idx != -1) {
                     strcpy(state->groundName, grounds[ground_idx].name);
                     snprintf(state->umpireNames, sizeof(state->umpireNames), "%s, %s", umpires[umpire1_idx].name, umpires[umpire2_idx].name);
+                    user_match_started = true;
+                    currentStep = WC_STEP_MATCH_DAY; // Where "Back to Menu" from the match lands
                     ChangeScreen(state, SCREEN_GAMEPLAY);
                 }
             }
             break;
         }
+        case WC_STEP_MATCH_DAY: {
+            Team* user_team = &wc_teams[user_team_idx];
+            int first = 0, last = 0;
+            sim_service_day_range(&first, &last);
+
+            // The user's fixture counts once its second innings is over
+            if (current_match_idx >= 0 && user_match_started && wc_results[current_match_idx] == WC_RESULT_PENDING &&
+                UserFixtureFinished(gameState)) {
+                wc_results[current_match_idx] = UserFixtureWinner(&wc_matches[current_match_idx], gameState);
+                // The chasing side's score is on the GameState; the side batting first is charged its full overs either way
+                QualFixture *score = &wc_user_scores[current_match_idx];
+                int chaser = strcmp(gameState->batting_team->name, wc_matches[current_match_idx].teamA->name) == 0 ? 0 : 1;
+                score->runs[1 - chaser] = gameState->target - 1;
+                score->balls[1 - chaser] = gameState->max_overs * 6;
+                score->runs[chaser] = gameState->total_runs;
+                score->balls[chaser] = gameState->wickets >= 10 ? gameState->max_overs * 6 : gameState->overs_completed * 6 + gameState->balls_bowled_in_over;
+                wc_points_dirty = true;
+            }
+            if (wc_points_dirty || fixtureResultsChanged) {
+                num_wc_points = BuildPointsTable(wc_points, wc_teams, num_wc_teams, wc_matches, num_wc_matches, wc_results, wc_user_scores);
+                wc_points_dirty = false;
+                fixtureResultsChanged = false;
+                wc_odds_dirty = true;
+            }
+            if (show_odds && wc_odds_dirty) {
+                static QualFixture fixtures[MAX_MATCHES_IN_TOURNAMENT];
+                int count = BuildQualFixtures(fixtures, wc_teams, wc_matches, num_wc_matches, wc_results, wc_user_scores);
+                qualification_start(workerPool, wc_teams, num_wc_teams, fixtures, count, SIM_MAX_OVERS, 4, QUAL_DEFAULT_RUNS, (uint32_t)tournament_start_date);
+                wc_odds_dirty = false;
+            }
+
+            char title[64];
+            snprintf(title, sizeof(title), "Match Day %d of %d", current_day + 1, num_wc_days);
+            DrawTextBold(title, GetScreenWidth() / 2 - text_cache_measure(title, 40) / 2, 20, 40, ICC_GRAY);
+            time_t day_date = tournament_start_date + (current_day * 24 * 60 * 60);
+            char date_str[64];
+            strftime(date_str, sizeof(date_str), "%A, %B %d, %Y", localtime(&day_date));
+            GfxDrawText(date_str, GetScreenWidth() / 2 - text_cache_measure(date_str, 20) / 2, 70, 20, ICC_GRAY);
+
+            // Today's fixtures, live
+            const float listWidth = GetScreenWidth() * 0.55f - 60;
+            const float rowHeight = 44.0f;
+            static TextSlot fixture_slots[WC_MAX_FIXTURES_PER_DAY];
+            GfxDrawText("Today", 50, 110, 20, ICC_YELLOW);
+            for (int i = first; i < last && i - first < WC_MAX_FIXTURES_PER_DAY; i++) {
+                float y = 140 + (i - first) * rowHeight;
+                Rectangle row = { 50, y, listWidth, rowHeight - 6 };
+                bool is_user_match = (wc_matches[i].teamA == user_team) || (wc_matches[i].teamB == user_team);
+                GfxDrawRectangleRec(row, is_user_match ? ICC_BLUE : ICC_GRAY);
+                flag_atlas_draw(wc_matches[i].teamA->name, (Rectangle){ row.x + 8, row.y + 10, 27, 18 }, ICC_WHITE);
+                flag_atlas_draw(wc_matches[i].teamB->name, (Rectangle){ row.x + 40, row.y + 10, 27, 18 }, ICC_WHITE);
+
+                TextSlot *slot = &fixture_slots[i - first];
+                SimFixtureView view;
+                if (sim_service_view(i, &view)) {
+                    if (text_slot_changed(slot, &wc_matches[i], view.status * 2 + view.innings, view.runs[view.innings] * 1000 + view.wickets[view.innings], view.balls[view.innings])) {
+                        sim_service_describe(i, slot->text, sizeof(slot->text));
+                    }
+                } else if (wc_results[i] != WC_RESULT_PENDING) {
+                    if (text_slot_changed(slot, &wc_matches[i], wc_results[i], -1, 0)) {
+                        if (wc_results[i] == -1) snprintf(slot->text, sizeof(slot->text), "%s v %s tied", wc_matches[i].teamA->tag, wc_matches[i].teamB->tag);
+                        else snprintf(slot->text, sizeof(slot->text), "%s beat %s", (wc_results[i] == 0 ? wc_matches[i].teamA : wc_matches[i].teamB)->tag,
+                                      (wc_results[i] == 0 ? wc_matches[i].teamB : wc_matches[i].teamA)->tag);
+                    }
+                } else if (user_match_started) {
+                    if (text_slot_changed(slot, &wc_matches[i], gameState->inning_num * 1000 + gameState->wickets, gameState->total_runs,
+                                          gameState->overs_completed * 6 + gameState->balls_bowled_in_over)) {
+                        snprintf(slot->text, sizeof(slot->text), "%s %d/%d (%d.%d) - your match, in progress", gameState->batting_team->tag,
+                                 gameState->total_runs, gameState->wickets, gameState->overs_completed, gameState->balls_bowled_in_over);
+                    }
+                } else {
+                    if (text_slot_changed(slot, &wc_matches[i], -2, 0, 0)) {
+                        snprintf(slot->text, sizeof(slot->text), "%s v %s - your match", wc_matches[i].teamA->tag, wc_matches[i].teamB->tag);
+                    }
+                }
+                text_slot_draw(slot, row.x + 80, row.y + 10, 20, TEXT_STYLE_PLAIN, ICC_WHITE);
+            }
+
+            // Points table, rebuilt whenever a result comes in, or each team's odds from the rest of the tournament
+            const float tableX = GetScreenWidth() * 0.55f + 10;
+            const float tableWidth = GetScreenWidth() - tableX - 50;
+            const char* points_headers[] = { "Team", "P", "W", "L", "T", "Pts", "NRR" };
+            const float points_cols[] = { 0, tableWidth - 270, tableWidth - 230, tableWidth - 190, tableWidth - 150, tableWidth - 110, tableWidth - 60 };
+            const char* odds_headers[] = { "Team", "Top 4", "Title" };
+            const float odds_cols[] = { 0, tableWidth - 250, tableWidth - 125 };
+            GfxDrawText(show_odds ? "Odds" : "Points Table", tableX, 110, 20, ICC_YELLOW);
+            Rectangle oddsButton = { tableX + tableWidth - 120, 106, 120, 26 };
+            GfxDrawRectangleRec(oddsButton, ICC_BLUE);
+            const char *odds_label = show_odds ? "Show Table" : "Show Odds";
+            GfxDrawText(odds_label, oddsButton.x + oddsButton.width / 2 - text_cache_measure(odds_label, 16) / 2, oddsButton.y + 5, 16, ICC_WHITE);
+            if (CheckCollisionPointRec(GetMousePosition(), oddsButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) show_odds = !show_odds;
+
+            int num_cols = show_odds ? 3 : 7;
+            for (int c = 0; c < num_cols; c++) {
+                text_cache_draw(show_odds ? odds_headers[c] : points_headers[c], tableX + (show_odds ? odds_cols[c] : points_cols[c]), 140, 18, TEXT_STYLE_PLAIN, ICC_YELLOW);
+            }
+            GfxDrawLine(tableX, 162, tableX + tableWidth, 162, ICC_YELLOW);
+
+            GfxBeginScissorMode(tableX, 166, tableWidth, GetScreenHeight() - 246);
+            bool odds_ready = show_odds && qualification_ready();
+            for (int r = 0; r < num_wc_points; r++) {
+                const PointsTableEntry *e = &wc_points[r];
+                float y = 170 + r * 26;
+                Color color = (e->team == user_team) ? SKYBLUE : ICC_WHITE;
+                text_cache_draw(TextFormat("%d. %s", r + 1, e->team->name), tableX + points_cols[0], y, 18, TEXT_STYLE_PLAIN, color);
+                if (!show_odds) {
+                    const int values[] = { e->played, e->wins, e->losses, e->draws, e->points };
+                    for (int c = 0; c < 5; c++) text_cache_draw(TextFormat("%d", values[c]), tableX + points_cols[c + 1], y, 18, TEXT_STYLE_PLAIN, color);
+                    text_cache_draw(TextFormat("%+.2f", points_table_nrr(e)), tableX + points_cols[6], y, 18, TEXT_STYLE_PLAIN, color);
+                    continue;
+                }
+                QualOdds odds;
+                if (!odds_ready || !qualification_odds((int)(e->team - wc_teams), &odds)) continue;
+                // Percent with the half width of the 95% interval
+                const QualEstimate *est[] = { &odds.semi_final, &odds.title };
+                for (int c = 0; c < 2; c++) {
+                    text_cache_draw(TextFormat("%.1f%% +/-%.1f", est[c]->p * 100, (est[c]->high - est[c]->low) * 50), tableX + odds_cols[c + 1], y, 18, TEXT_STYLE_PLAIN, color);
+                }
+            }
+            GfxEndScissorMode();
+            if (show_odds && !odds_ready) {
+                GfxDrawText("Playing out the rest of the tournament...", tableX, 170 + num_wc_points * 26 + 10, 18, ICC_GRAY);
+            } else if (odds_ready) {
+                GfxDrawText(TextFormat("From %d simulated tournaments", qualification_runs()), tableX, 170 + num_wc_points * 26 + 10, 16, ICC_GRAY);
+            }
+
+            // Moving on never waits: the other fixtures were computed when the tournament started
+            Rectangle actionButton = { GetScreenWidth() - 240, GetScreenHeight() - 60, 220, 40 };
+            const char *action = NULL;
+            bool user_match_pending = current_match_idx >= 0 && wc_results[current_match_idx] == WC_RESULT_PENDING;
+            if (user_match_pending) action = user_match_started ? "Resume Match" : "Play Your Match";
+            else if (current_day + 1 < num_wc_days) action = "Next Match Day";
+            else if (!sim_service_day_finished()) action = "Finish Day";
+
+            if (action) {
+                GfxDrawRectangleRec(actionButton, ICC_GREEN);
+                DrawTextBold(action, actionButton.x + actionButton.width / 2 - text_cache_measure(action, 20) / 2, actionButton.y + 10, 20, ICC_WHITE);
+                if (CheckCollisionPointRec(GetMousePosition(), actionButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+                    if (user_match_pending && user_match_started) ChangeScreen(state, SCREEN_GAMEPLAY);
+                    else if (user_match_pending) currentStep = WC_STEP_PRE_MATCH;
+                    else if (current_day + 1 < num_wc_days) day_to_open = current_day + 1; // Today's other fixtures finish instantly
+                    else sim_service_finish_day();
+                }
+            } else if (num_wc_points > 0) {
+                char complete[160];
+                snprintf(complete, sizeof(complete), "Tournament complete: %s top the table", wc_points[0].team->name);
+                DrawTextBold(complete, GetScreenWidth() - text_cache_measure(complete, 20) - 30, GetScreenHeight() - 50, 20, ICC_GREEN);
+            }
+            break;
+        }
         default:
             break;
     }
 
     // Draw Back Button on all steps
-    DrawRectangleRec(backButton, ICC_RED);
-    DrawTextBold("Back", backButton.x + backButton.width/2 - MeasureText("Back", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(backButton, ICC_RED);
+    DrawTextBold("Back", backButton.x + backButton.width/2 - text_cache_measure("Back", 20)/2, backButton.y + 10, 20, ICC_WHITE);
 
-    EndDrawing();
+    GfxEndDrawing();
 }
 
 static void UpdateDrawManageUsersScreen(GuiState *state) {
@@ -4077,7 +4811,7 @@ static void UpdateDrawManageUsersScreen(GuiState *state) {
     static Account *accounts = NULL;
     static int num_accounts = 0;
     static bool needs_refresh = true;
-    static Vector2 scroll = { 0.0f, 0.0f };
+    static ListView list = { 0 };
     static int editIndex = -1; // -1 for adding, >= 0 for editing
 
     // --- UI element definitions ---
@@ -4151,50 +4885,46 @@ static void UpdateDrawManageUsersScreen(GuiState *state) {
     }
 
     // --- Drawing ---
-    BeginDrawing();
-    ClearBackground(ICC_BG);
-    DrawTextBold("Manage Users & Admins", GetScreenWidth()/2 - MeasureText("Manage Users & Admins", 40)/2, 10, 40, ICC_GRAY);
+    GfxBeginDrawing();
+    GfxClearBackground(ICC_BG);
+    DrawTextBold("Manage Users & Admins", GetScreenWidth()/2 - text_cache_measure("Manage Users & Admins", 40)/2, 10, 40, ICC_GRAY);
 
     // --- Draw Input Form ---
     DrawTextBold("Name", nameBox.bounds.x, nameBox.bounds.y - 20, 10, ICC_GRAY);
-    DrawRectangleRec(nameBox.bounds, ICC_GRAY); DrawText(nameBox.text, nameBox.bounds.x + 5, nameBox.bounds.y + 8, 20, ICC_WHITE);
+    GfxDrawRectangleRec(nameBox.bounds, ICC_GRAY); GfxDrawText(nameBox.text, nameBox.bounds.x + 5, nameBox.bounds.y + 8, 20, ICC_WHITE);
 
     DrawTextBold("Email", emailBox.bounds.x, emailBox.bounds.y - 20, 10, ICC_GRAY);
-    DrawRectangleRec(emailBox.bounds, ICC_GRAY);
-    if (editIndex != -1) DrawRectangleRec(emailBox.bounds, (Color){220,220,220,255}); // Gray out email on edit
-    DrawText(emailBox.text, emailBox.bounds.x + 5, emailBox.bounds.y + 8, 20, ICC_WHITE);
+    GfxDrawRectangleRec(emailBox.bounds, ICC_GRAY);
+    if (editIndex != -1) GfxDrawRectangleRec(emailBox.bounds, (Color){220,220,220,255}); // Gray out email on edit
+    GfxDrawText(emailBox.text, emailBox.bounds.x + 5, emailBox.bounds.y + 8, 20, ICC_WHITE);
 
     DrawTextBold(editIndex == -1 ? "Password" : "New Password (optional)", passwordBox.bounds.x, passwordBox.bounds.y - 20, 10, ICC_GRAY);
-    DrawRectangleRec(passwordBox.bounds, ICC_GRAY);
+    GfxDrawRectangleRec(passwordBox.bounds, ICC_GRAY);
     char pass_display[128] = {0}; for(int i=0; i<passwordBox.charCount; ++i) strcat(pass_display, "*");
-    DrawText(pass_display, passwordBox.bounds.x + 5, passwordBox.bounds.y + 8, 20, ICC_WHITE);
+    GfxDrawText(pass_display, passwordBox.bounds.x + 5, passwordBox.bounds.y + 8, 20, ICC_WHITE);
 
     Rectangle adminCheck = { 700, 100, 25, 25 };
-    DrawRectangleRec(adminCheck, ICC_GRAY);
-    if (isAdminFlag) DrawRectangle(adminCheck.x + 5, adminCheck.y + 5, 15, 15, ICC_BLUE);
+    GfxDrawRectangleRec(adminCheck, ICC_GRAY);
+    if (isAdminFlag) GfxDrawRectangle(adminCheck.x + 5, adminCheck.y + 5, 15, 15, ICC_BLUE);
     DrawTextBold("Is Admin?", adminCheck.x + 35, adminCheck.y + 5, 20, ICC_WHITE);
     if (CheckCollisionPointRec(GetMousePosition(), (Rectangle){adminCheck.x, adminCheck.y, 150, 25}) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) isAdminFlag = !isAdminFlag;
 
     const char* buttonText = (editIndex == -1) ? "Add User" : "Save Changes";
-    DrawRectangleRec(addButton, (editIndex == -1) ? ICC_GREEN : ICC_BLUE);
-    DrawTextBold(buttonText, addButton.x + addButton.width/2 - MeasureText(buttonText, 20)/2, addButton.y + 5, 20, ICC_WHITE);
+    GfxDrawRectangleRec(addButton, (editIndex == -1) ? ICC_GREEN : ICC_BLUE);
+    DrawTextBold(buttonText, addButton.x + addButton.width/2 - text_cache_measure(buttonText, 20)/2, addButton.y + 5, 20, ICC_WHITE);
 
     // --- Draw User List ---
     Rectangle view = { 20, 150, GetScreenWidth() - 40, GetScreenHeight() - 210 };
-    DrawRectangleRec(view, (Color){230, 230, 230, 255});
-    DrawRectangleLinesEx(view, 1, ICC_GRAY);
+    GfxDrawRectangleRec(view, (Color){230, 230, 230, 255});
+    GfxDrawRectangleLinesEx(view, 1, ICC_GRAY);
 
-    // Handle scrolling
-    const float itemHeight = 30.0f;
-    const float contentHeight = num_accounts * itemHeight;
-    if (CheckCollisionPointRec(GetMousePosition(), view)) {
-        scroll.y += GetMouseWheelMove() * itemHeight;
-        if (scroll.y > 0) scroll.y = 0;
-        if (contentHeight > view.height && scroll.y < view.height - contentHeight) scroll.y = view.height - contentHeight;
-        else if (contentHeight <= view.height) scroll.y = 0;
-    }
+    // Handle scrolling, the header stays put while the rows scroll under it
+    list.bounds = view;
+    list.itemHeight = 30.0f;
+    list.headerHeight = 40.0f;
+    UpdateListView(&list, num_accounts);
 
-    BeginScissorMode(view.x, view.y, view.width, view.height);
+    GfxBeginScissorMode(view.x, view.y, view.width, view.height);
     
     // List Header
     DrawTextBold("Name", view.x + 20, view.y + 10, 20, ICC_GRAY);
@@ -4202,26 +4932,29 @@ static void UpdateDrawManageUsersScreen(GuiState *state) {
     DrawTextBold("Role", view.x + 650, view.y + 10, 20, ICC_GRAY);
     DrawTextBold("Actions", view.x + 800, view.y + 10, 20, ICC_GRAY);
 
-    for (int i = 0; i < num_accounts; i++) {
-        float y_pos = view.y + 40 + (i * itemHeight) + scroll.y;
-        if (y_pos < view.y - itemHeight || y_pos > view.y + view.height) continue; // Culling
+    for (int i = list.first; i < list.last; i++) {
+        float y_pos = ListViewRowY(&list, i);
+        bool superadmin = is_superadmin(accounts[i].email);
 
         Color textColor = (editIndex == i) ? ICC_BLUE : ICC_WHITE;
-        DrawText(accounts[i].name, view.x + 20, y_pos, 20, textColor);
-        DrawText(accounts[i].email, view.x + 300, y_pos, 20, textColor);
+        GfxDrawText(accounts[i].name, view.x + 20, y_pos, 20, textColor);
+        GfxDrawText(accounts[i].email, view.x + 300, y_pos, 20, textColor);
 
         const char* role = "User";
-        if (is_superadmin(accounts[i].email)) role = "Superadmin";
+        if (superadmin) role = "Superadmin";
         else if (accounts[i].isAdmin) role = "Admin";
-        DrawText(role, view.x + 650, y_pos, 20, (strcmp(role,"User")==0) ? ICC_GRAY : ICC_BLUE);
+        GfxDrawText(role, view.x + 650, y_pos, 20, (strcmp(role,"User")==0) ? ICC_GRAY : ICC_BLUE);
 
         // Action buttons
-        if (!is_superadmin(accounts[i].email)) {
+        if (!superadmin) {
             Rectangle editBtn = { view.x + 800, y_pos, 60, 25 };
             Rectangle deleteBtn = { view.x + 870, y_pos, 70, 25 };
 
-            DrawRectangleRec(editBtn, ICC_YELLOW); DrawText("Edit", editBtn.x + 15, editBtn.y + 5, 15, ICC_WHITE);
-            DrawRectangleRec(deleteBtn, ICC_RED); DrawText("Delete", deleteBtn.x + 10, deleteBtn.y + 5, 15, ICC_WHITE);
+            GfxDrawRectangleRec(editBtn, ICC_YELLOW); GfxDrawText("Edit", editBtn.x + 15, editBtn.y + 5, 15, ICC_WHITE);
+            GfxDrawRectangleRec(deleteBtn, ICC_RED); GfxDrawText("Delete", deleteBtn.x + 10, deleteBtn.y + 5, 15, ICC_WHITE);
+
+            // Rows partly under the panel edges are drawn but must not take clicks
+            if (!CheckCollisionPointRec(GetMousePosition(), view)) continue;
 
             if (CheckCollisionPointRec(GetMousePosition(), editBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                 editIndex = i;
@@ -4243,13 +4976,14 @@ static void UpdateDrawManageUsersScreen(GuiState *state) {
             }
         }
     }
-    EndScissorMode();
+    GfxEndScissorMode();
+    DrawListViewScrollbar(&list, num_accounts);
 
     // Back button
-    DrawRectangleRec(backButton, ICC_GRAY);
-    DrawTextBold("Back", backButton.x + backButton.width/2 - MeasureText("Back", 20)/2, backButton.y + 10, 20, ICC_WHITE);
+    GfxDrawRectangleRec(backButton, ICC_GRAY);
+    DrawTextBold("Back", backButton.x + backButton.width/2 - text_cache_measure("Back", 20)/2, backButton.y + 10, 20, ICC_WHITE);
 
-    EndDrawing();
+    GfxEndDrawing();
 }
 
 // A helper function to manage text box input logic
@@ -4276,7 +5010,72 @@ static void HandleTextBox(TextBox *box) {
         
         // Add a blinking cursor effect
         if ((((int)(GetTime()*2.0f)) % 2) == 0) {
-            DrawText("|", box->bounds.x + 8 + MeasureText(box->text, 20), box->bounds.y + 12, 20, ICC_WHITE);
+            GfxDrawText("|", box->bounds.x + 8 + text_cache_measure(box->text, 20), box->bounds.y + 12, 20, ICC_WHITE);
+        }
+    }
+}
+
+// Scrolls a list and works out which rows intersect its view. Only rows in
+// [first, last) need to be measured, hit-tested or drawn, so the cost of a
+// frame no longer depends on how many rows the list holds.
+static void UpdateListView(ListView *list, int itemCount) {
+    float contentHeight = list->headerHeight + itemCount * list->itemHeight;
+    float maxScroll = contentHeight - list->bounds.height;
+    if (maxScroll < 0) maxScroll = 0;
+
+    if (maxScroll > 0 && CheckCollisionPointRec(GetMousePosition(), list->bounds)) {
+        list->scrollY += GetMouseWheelMove() * list->itemHeight; // Scroll one item at a time
+    }
+
+    // Dragging the handle maps the mouse straight onto the content, which stays usable for very long lists
+    if (list->dragging) {
+        if (!IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
+            list->dragging = false;
+        } else if (maxScroll > 0) {
+            float handleHeight = fmaxf((list->bounds.height / contentHeight) * list->bounds.height, 20.0f);
+            float t = (GetMousePosition().y - list->bounds.y - handleHeight / 2) / (list->bounds.height - handleHeight);
+            list->scrollY = -Clamp(t, 0.0f, 1.0f) * maxScroll;
         }
     }
+
+    if (list->scrollY > 0) list->scrollY = 0; // Clamp top
+    if (list->scrollY < -maxScroll) list->scrollY = -maxScroll; // Clamp bottom (also after the list shrinks)
+
+    float top = -list->scrollY - list->headerHeight;
+    list->first = (int)floorf(top / list->itemHeight);
+    list->last = (int)ceilf((top + list->bounds.height) / list->itemHeight);
+    if (list->first < 0) list->first = 0;
+    if (list->last > itemCount) list->last = itemCount;
+    if (list->first > list->last) list->first = list->last;
+}
+
+// Screen y of a row, pass -1 for the header
+static float ListViewRowY(const ListView *list, int row) {
+    if (row < 0) return list->bounds.y + list->scrollY;
+    return list->bounds.y + list->headerHeight + row * list->itemHeight + list->scrollY;
+}
+
+static void DrawListViewScrollbar(ListView *list, int itemCount) {
+    float contentHeight = list->headerHeight + itemCount * list->itemHeight;
+    if (contentHeight <= list->bounds.height) return;
+
+    Rectangle scrollBarArea = { list->bounds.x + list->bounds.width - 12, list->bounds.y, 10, list->bounds.height };
+    GfxDrawRectangleRec(scrollBarArea, ICC_GRAY);
+
+    float handleHeight = fmaxf((list->bounds.height / contentHeight) * list->bounds.height, 20.0f);
+    float handleY = list->bounds.y + (-list->scrollY / (contentHeight - list->bounds.height)) * (list->bounds.height - handleHeight);
+    Rectangle scrollHandle = { scrollBarArea.x, handleY, 10, handleHeight };
+    GfxDrawRectangleRec(scrollHandle, list->dragging ? ICC_YELLOW : ICC_WHITE);
+
+    if (CheckCollisionPointRec(GetMousePosition(), scrollBarArea) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        list->dragging = true;
+    }
+}
+
+// Column widths only ever grow while scrolling, so they are measured once per
+// row as it comes into view instead of for every row on every frame.
+// Reset the width to the header's width when the underlying data changes.
+static void GrowColumnWidth(float *width, const char *text, int fontSize) {
+    float w = text_cache_measure(text, fontSize);
+    if (w > *width) *width = w;
 }
@@ -0,0 +1,134 @@
+#include "job_queue.h"
+#include <stdlib.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+typedef struct Job {
+    JobFunc func;
+    void *arg;
+    struct Job *next;
+} Job;
+
+struct JobQueue {
+    pthread_t workers[JOB_QUEUE_MAX_WORKERS];
+    int num_workers;
+    pthread_mutex_t lock;
+    pthread_cond_t has_work;  // Signalled when a job is pushed or on shutdown
+    pthread_cond_t all_done;  // Signalled when pending drops to zero
+    Job *head, *tail;
+    int pending;
+    bool shutting_down;
+};
+
+int job_queue_cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+static void* worker_main(void *arg) {
+    JobQueue *queue = (JobQueue*)arg;
+
+    pthread_mutex_lock(&queue->lock);
+    for (;;) {
+        while (queue->head == NULL && !queue->shutting_down) {
+            pthread_cond_wait(&queue->has_work, &queue->lock);
+        }
+        if (queue->head == NULL) break; // Shutting down and nothing left
+
+        Job *job = queue->head;
+        queue->head = job->next;
+        if (queue->head == NULL) queue->tail = NULL;
+        pthread_mutex_unlock(&queue->lock);
+
+        job->func(job->arg);
+        free(job);
+
+        pthread_mutex_lock(&queue->lock);
+        if (--queue->pending == 0) pthread_cond_broadcast(&queue->all_done);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return NULL;
+}
+
+JobQueue* job_queue_create(int num_workers) {
+    if (num_workers <= 0) num_workers = job_queue_cpu_count();
+    if (num_workers > JOB_QUEUE_MAX_WORKERS) num_workers = JOB_QUEUE_MAX_WORKERS;
+
+    JobQueue *queue = calloc(1, sizeof(JobQueue));
+    if (!queue) return NULL;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->has_work, NULL);
+    pthread_cond_init(&queue->all_done, NULL);
+
+    for (int i = 0; i < num_workers; i++) {
+        if (pthread_create(&queue->workers[queue->num_workers], NULL, worker_main, queue) == 0) {
+            queue->num_workers++;
+        }
+    }
+    return queue;
+}
+
+void job_queue_push(JobQueue *queue, JobFunc func, void *arg) {
+    // Without any worker the job simply runs on the caller's thread
+    if (queue == NULL || queue->num_workers == 0) {
+        func(arg);
+        return;
+    }
+
+    Job *job = malloc(sizeof(Job));
+    job->func = func;
+    job->arg = arg;
+    job->next = NULL;
+
+    pthread_mutex_lock(&queue->lock);
+    if (queue->tail) queue->tail->next = job; else queue->head = job;
+    queue->tail = job;
+    queue->pending++;
+    pthread_cond_signal(&queue->has_work);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+int job_queue_pending(JobQueue *queue) {
+    if (queue == NULL) return 0;
+    pthread_mutex_lock(&queue->lock);
+    int pending = queue->pending;
+    pthread_mutex_unlock(&queue->lock);
+    return pending;
+}
+
+void job_queue_wait(JobQueue *queue) {
+    if (queue == NULL) return;
+    pthread_mutex_lock(&queue->lock);
+    while (queue->pending > 0) {
+        pthread_cond_wait(&queue->all_done, &queue->lock);
+    }
+    pthread_mutex_unlock(&queue->lock);
+}
+
+void job_queue_destroy(JobQueue *queue) {
+    if (queue == NULL) return;
+
+    pthread_mutex_lock(&queue->lock);
+    queue->shutting_down = true;
+    pthread_cond_broadcast(&queue->has_work);
+    pthread_mutex_unlock(&queue->lock);
+
+    for (int i = 0; i < queue->num_workers; i++) {
+        pthread_join(queue->workers[i], NULL);
+    }
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->has_work);
+    pthread_cond_destroy(&queue->all_done);
+    free(queue);
+}
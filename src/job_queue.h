@@ -0,0 +1,21 @@
+#ifndef JOB_QUEUE_H
+#define JOB_QUEUE_H
+
+#include <stdbool.h>
+
+#define JOB_QUEUE_MAX_WORKERS 16
+
+typedef void (*JobFunc)(void *arg);
+
+typedef struct JobQueue JobQueue;
+
+// Fixed pool of worker threads pulling jobs from one FIFO queue
+JobQueue* job_queue_create(int num_workers); // num_workers <= 0 picks one per CPU core
+void job_queue_push(JobQueue *queue, JobFunc func, void *arg);
+int job_queue_pending(JobQueue *queue);      // Jobs queued or still running
+void job_queue_wait(JobQueue *queue);        // Blocks until every pushed job has finished
+void job_queue_destroy(JobQueue *queue);     // Finishes the queued jobs, then joins the workers
+
+int job_queue_cpu_count(void);
+
+#endif // JOB_QUEUE_H
@@ -0,0 +1,220 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // shm_open, ftruncate, kill
+#endif
+#include "live_feed.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define LIVE_FEED_MAGIC 0x4556494Cu // "LIVE"
+#define LIVE_FEED_VERSION 2
+
+struct LiveFeed {
+    LiveFeedRing *ring;
+    void *handle;               // Mapping HANDLE on Windows, unused elsewhere
+    uint32_t pid;               // What this writer stored in ring->writer
+};
+
+static uint32_t current_pid(void) {
+#ifdef _WIN32
+    return (uint32_t)GetCurrentProcessId();
+#else
+    return (uint32_t)getpid();
+#endif
+}
+
+static bool process_alive(uint32_t pid) {
+#ifdef _WIN32
+    HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, (DWORD)pid);
+    if (process == NULL) return GetLastError() == ERROR_ACCESS_DENIED;
+    bool alive = WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+    CloseHandle(process);
+    return alive;
+#else
+    return kill((pid_t)pid, 0) == 0 || errno == EPERM;
+#endif
+}
+
+// Takes the ring's writer slot, from nobody or from a writer that exited without closing.
+// False if a live process, this one included, already holds it.
+static bool claim_writer(LiveFeedRing *ring, uint32_t pid) {
+    uint32_t owner = __atomic_load_n(&ring->writer, __ATOMIC_ACQUIRE);
+    for (;;) {
+        if (owner == pid || (owner != 0 && process_alive(owner))) return false;
+        if (__atomic_compare_exchange_n(&ring->writer, &owner, pid, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) return true;
+    }
+}
+
+// Maps the segment, creating it when `create` is set. Returns NULL if it is not there.
+static void* map_segment(bool create, void **handle) {
+    *handle = NULL;
+#ifdef _WIN32
+    const char *name = "Local\\" LIVE_FEED_NAME;
+    HANDLE mapping = create ? CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, sizeof(LiveFeedRing), name)
+                            : OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if (mapping == NULL) return NULL;
+    void *view = MapViewOfFile(mapping, create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, sizeof(LiveFeedRing));
+    if (view == NULL) {
+        CloseHandle(mapping);
+        return NULL;
+    }
+    *handle = mapping;
+    return view;
+#else
+    int fd = shm_open("/" LIVE_FEED_NAME, create ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (st.st_size < (off_t)sizeof(LiveFeedRing) && (!create || ftruncate(fd, sizeof(LiveFeedRing)) != 0))) {
+        close(fd);
+        return NULL;
+    }
+    void *view = mmap(NULL, sizeof(LiveFeedRing), create ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // The mapping stays valid without the descriptor
+    return (view == MAP_FAILED) ? NULL : view;
+#endif
+}
+
+static void unmap_segment(const void *view, void *handle) {
+#ifdef _WIN32
+    UnmapViewOfFile(view);
+    CloseHandle((HANDLE)handle);
+#else
+    (void)handle;
+    munmap((void*)view, sizeof(LiveFeedRing));
+#endif
+}
+
+LiveFeed* live_feed_open(void) {
+    LiveFeed *feed = calloc(1, sizeof(LiveFeed));
+    if (!feed) return NULL;
+    feed->ring = map_segment(true, &feed->handle);
+    if (!feed->ring) {
+        free(feed);
+        return NULL;
+    }
+
+    LiveFeedRing *ring = feed->ring;
+    feed->pid = current_pid();
+    if (!claim_writer(ring, feed->pid)) {
+        unmap_segment(ring, feed->handle); // Not live_feed_close, the claim belongs to someone else
+        free(feed);
+        return NULL;
+    }
+
+    if (ring->magic != LIVE_FEED_MAGIC || ring->version != LIVE_FEED_VERSION ||
+        ring->capacity != LIVE_FEED_CAPACITY || ring->slot_size != sizeof(LiveFeedSlot)) {
+        // New, or left by an incompatible build: start over. A joined ring keeps its numbering
+        // so readers following it never see the sequence go backwards. The writer field is left
+        // alone so the claim holds while the rest is cleared.
+        ring->magic = 0;
+        ring->head = 0;
+        ring->reserved = 0;
+        memset(ring->slots, 0, sizeof(ring->slots));
+        ring->version = LIVE_FEED_VERSION;
+        ring->capacity = LIVE_FEED_CAPACITY;
+        ring->slot_size = sizeof(LiveFeedSlot);
+        __atomic_store_n(&ring->magic, LIVE_FEED_MAGIC, __ATOMIC_RELEASE);
+    }
+    return feed;
+}
+
+void live_feed_publish(LiveFeed *feed, const LiveBall *ball) {
+    if (!feed) return;
+    LiveFeedRing *ring = feed->ring;
+    uint64_t n = ring->head; // Only the claimed writer stores to the ring
+    LiveFeedSlot *slot = &ring->slots[n % LIVE_FEED_CAPACITY];
+
+    // Per-slot seqlock: odd while the ball is being copied in, then 2n + 2 once it is whole
+    __atomic_store_n(&slot->seq, 2 * n + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&slot->ball, ball, sizeof(LiveBall));
+    __atomic_store_n(&slot->seq, 2 * n + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->head, n + 1, __ATOMIC_RELEASE);
+}
+
+void live_feed_close(LiveFeed *feed) {
+    if (!feed) return;
+    uint32_t pid = feed->pid;
+    __atomic_compare_exchange_n(&feed->ring->writer, &pid, 0, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    unmap_segment(feed->ring, feed->handle);
+    free(feed);
+}
+
+bool live_feed_reader_open(LiveFeedReader *reader, bool from_start) {
+    memset(reader, 0, sizeof(LiveFeedReader));
+    const LiveFeedRing *ring = map_segment(false, &reader->handle);
+    if (!ring) return false;
+    if (__atomic_load_n(&ring->magic, __ATOMIC_ACQUIRE) != LIVE_FEED_MAGIC || ring->version != LIVE_FEED_VERSION ||
+        ring->capacity != LIVE_FEED_CAPACITY || ring->slot_size != sizeof(LiveFeedSlot)) {
+        unmap_segment(ring, reader->handle);
+        return false;
+    }
+    reader->ring = ring;
+
+    uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    reader->next = (!from_start) ? head : (head > LIVE_FEED_CAPACITY ? head - LIVE_FEED_CAPACITY : 0);
+    return true;
+}
+
+void live_feed_reader_close(LiveFeedReader *reader) {
+    if (reader->ring) unmap_segment(reader->ring, reader->handle);
+    memset(reader, 0, sizeof(LiveFeedReader));
+}
+
+// Jumps past the balls the writer has already reused, keeping a little slack so the reader
+// is not immediately lapped again
+static void skip_lapped(LiveFeedReader *reader) {
+    uint64_t head = __atomic_load_n(&reader->ring->head, __ATOMIC_ACQUIRE);
+    uint64_t oldest = (head > LIVE_FEED_CAPACITY / 2) ? head - LIVE_FEED_CAPACITY / 2 : 0;
+    if (oldest > reader->next) {
+        reader->dropped += oldest - reader->next;
+        reader->next = oldest;
+    }
+}
+
+const LiveBall* live_feed_peek(LiveFeedReader *reader) {
+    if (!reader->ring) return NULL;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        const LiveFeedSlot *slot = &reader->ring->slots[reader->next % LIVE_FEED_CAPACITY];
+        uint64_t want = 2 * reader->next + 2;
+        uint64_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        if (seq == want) {
+            reader->peeked_seq = seq;
+            return &slot->ball;
+        }
+        if (seq < want) return NULL; // Not bowled yet, or still being written
+        skip_lapped(reader);
+    }
+    return NULL;
+}
+
+bool live_feed_done(LiveFeedReader *reader) {
+    const LiveFeedSlot *slot = &reader->ring->slots[reader->next % LIVE_FEED_CAPACITY];
+    __atomic_thread_fence(__ATOMIC_ACQUIRE); // The caller's reads of the ball come before this check
+    if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != reader->peeked_seq) {
+        skip_lapped(reader);
+        return false;
+    }
+    reader->next++;
+    return true;
+}
+
+bool live_feed_next(LiveFeedReader *reader, LiveBall *out) {
+    for (;;) {
+        const LiveBall *ball = live_feed_peek(reader);
+        if (!ball) return false;
+        memcpy(out, ball, sizeof(LiveBall));
+        if (live_feed_done(reader)) return true;
+    }
+}
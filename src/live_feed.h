@@ -0,0 +1,101 @@
+#ifndef LIVE_FEED_H
+#define LIVE_FEED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Live ball-by-ball feed for scoreboards and overlays on the same machine. The match being
+// played publishes every delivery, with the score after it, into a ring in shared memory.
+// Publishing is a handful of stores and never waits: a reader that falls a whole ring behind
+// loses the oldest balls instead of holding the game up. Readers look at the events in place
+// and check afterwards that the slot was not reused while they read, so any number of them
+// can follow without locks or copies.
+//
+// Kept free of platform headers and of match.h so overlay tools can use it on its own.
+
+#define LIVE_FEED_NAME "cricket_live_feed"  // "/cricket_live_feed" for shm_open, "Local\cricket_live_feed" on Windows
+#define LIVE_FEED_CAPACITY 4096             // Balls kept, a power of two; about a full Test match
+#define LIVE_FEED_TEXT_LEN 32               // Names are cut to fit
+
+// One delivery and the score after it. Plain fixed-size fields so any process can map it.
+typedef struct {
+    char match_id[64];
+    char batting_team[LIVE_FEED_TEXT_LEN];
+    char bowling_team[LIVE_FEED_TEXT_LEN];
+
+    // The ball
+    int32_t inning_num;
+    int32_t over;               // Over the ball was bowled in, from 0
+    int32_t ball;               // 1-6 within that over
+    int32_t outcome;            // BallOutcomeType
+    int32_t runs;
+    char batsman[LIVE_FEED_TEXT_LEN];
+    char bowler[LIVE_FEED_TEXT_LEN];
+    char fielder[LIVE_FEED_TEXT_LEN];     // Empty unless caught
+    char dismissal[LIVE_FEED_TEXT_LEN];   // Empty unless out
+
+    // The score after it
+    int32_t total_runs;
+    int32_t wickets;
+    int32_t balls_bowled;       // In this innings
+    int32_t max_overs;          // Can shrink with rain
+    int32_t target;             // 0 in the first innings
+    int32_t batsman_runs;       // The batsman's and bowler's figures, this ball included
+    int32_t batsman_balls;
+    int32_t bowler_runs;
+    int32_t bowler_balls;
+    int32_t bowler_wickets;
+} LiveBall;
+
+typedef struct {
+    uint64_t seq;               // 2n + 2 once ball n is in the slot, odd while it is being written
+    LiveBall ball;
+} LiveFeedSlot;
+
+// The shared segment
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t capacity;
+    uint32_t slot_size;
+    uint32_t writer;            // Process id of the game publishing, 0 when none
+    uint32_t reserved;
+    uint64_t head;              // Balls published so far; ball n is in slots[n % capacity]
+    LiveFeedSlot slots[LIVE_FEED_CAPACITY];
+} LiveFeedRing;
+
+// --- Writer: the game ---
+
+typedef struct LiveFeed LiveFeed;
+
+// Creates the segment, or joins an existing one and carries on its numbering. There is one
+// writer at a time: NULL if another live game already publishes to it (a writer that died is
+// replaced) or shared memory is unavailable, in which case the game just plays without a feed.
+LiveFeed* live_feed_open(void);
+void live_feed_publish(LiveFeed *feed, const LiveBall *ball);
+void live_feed_close(LiveFeed *feed); // Gives up the writer's claim, leaves the segment for readers
+
+// --- Readers ---
+
+typedef struct {
+    const LiveFeedRing *ring;
+    void *handle;               // Mapping HANDLE on Windows, unused elsewhere
+    uint64_t next;              // Next ball to read
+    uint64_t dropped;           // Balls overwritten before this reader got to them
+    uint64_t peeked_seq;        // Slot sequence seen by the last live_feed_peek
+} LiveFeedReader;
+
+// False if no game has created the feed yet. from_start: begin with the oldest ball still kept,
+// otherwise with the next one bowled.
+bool live_feed_reader_open(LiveFeedReader *reader, bool from_start);
+void live_feed_reader_close(LiveFeedReader *reader);
+
+// The next ball, in shared memory, or NULL if it has not been bowled yet. Read what you need,
+// then call live_feed_done(): if it returns false the slot was reused under you and what you
+// read must be thrown away (the reader has already skipped ahead).
+const LiveBall* live_feed_peek(LiveFeedReader *reader);
+bool live_feed_done(LiveFeedReader *reader);
+// Copying convenience over peek/done; false if no new ball is available
+bool live_feed_next(LiveFeedReader *reader, LiveBall *out);
+
+#endif // LIVE_FEED_H
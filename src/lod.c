@@ -0,0 +1,93 @@
+#include "lod.h"
+
+#define LOD_EMA_ALPHA 0.1f
+#define LOD_OVER_BUDGET 1.2f        // Average above budget * this counts as overloaded
+#define LOD_HEADROOM 1.05f          // Average below budget * this counts as keeping up
+#define LOD_DEGRADE_AFTER 0.5f      // Seconds overloaded before dropping a level
+#define LOD_PROBE_MIN 3.0f          // Seconds with headroom before trying a higher level
+#define LOD_PROBE_MAX 60.0f
+#define LOD_PROBE_GRACE 2.0f        // A drop this soon after a probe counts as a failed probe
+
+static const LodSettings level_settings[LOD_LEVEL_COUNT] = {
+    [LOD_HIGH]    = { 1.00f, FIGURE_DETAIL_FULL,    30.0f, true },
+    [LOD_MEDIUM]  = { 0.60f, FIGURE_DETAIL_FULL,    15.0f, true },
+    [LOD_LOW]     = { 0.35f, FIGURE_DETAIL_REDUCED,  8.0f, false },
+    [LOD_MINIMAL] = { 0.15f, FIGURE_DETAIL_MINIMAL,  0.0f, false },
+};
+
+static const char *level_names[LOD_LEVEL_COUNT] = { "High", "Medium", "Low", "Minimal" };
+
+static LodLevel level = LOD_HIGH;
+static float budget = 1.0f / 60.0f;
+static float average = 1.0f / 60.0f;
+static float over_time = 0.0f;      // How long the average has been over budget
+static float good_time = 0.0f;      // How long the average has been keeping up
+static float since_probe = -1.0f;   // Time since the last step up, -1 if none pending
+static float probe_interval = LOD_PROBE_MIN;
+
+void lod_init(int target_fps) {
+    budget = 1.0f / (target_fps > 0 ? target_fps : 60);
+    average = budget;
+    level = LOD_HIGH;
+    over_time = good_time = 0.0f;
+    since_probe = -1.0f;
+    probe_interval = LOD_PROBE_MIN;
+}
+
+void lod_update(float frame_time) {
+    // Ignore hitches like window drags or loading screens, they say nothing about drawing cost
+    if (frame_time <= 0.0f || frame_time > 0.25f) return;
+
+    average += (frame_time - average) * LOD_EMA_ALPHA;
+
+    if (since_probe >= 0.0f) {
+        since_probe += frame_time;
+        if (since_probe > LOD_PROBE_GRACE) {
+            since_probe = -1.0f; // The probe held, earlier probes can come sooner again
+            probe_interval = LOD_PROBE_MIN;
+        }
+    }
+
+    if (average > budget * LOD_OVER_BUDGET) {
+        over_time += frame_time;
+        good_time = 0.0f;
+        if (over_time >= LOD_DEGRADE_AFTER && level < LOD_MINIMAL) {
+            level++;
+            over_time = 0.0f;
+            average = budget; // Judge the new level on its own frames
+            if (since_probe >= 0.0f) {
+                probe_interval *= 2.0f; // The higher level could not hold, back off
+                if (probe_interval > LOD_PROBE_MAX) probe_interval = LOD_PROBE_MAX;
+                since_probe = -1.0f;
+            }
+        }
+    } else if (average < budget * LOD_HEADROOM) {
+        good_time += frame_time;
+        over_time = 0.0f;
+        if (good_time >= probe_interval && level > LOD_HIGH) {
+            level--;
+            good_time = 0.0f;
+            since_probe = 0.0f;
+        }
+    } else {
+        // Between the two thresholds: hold the current level
+        over_time = 0.0f;
+        good_time = 0.0f;
+    }
+}
+
+LodLevel lod_level(void) {
+    return level;
+}
+
+const LodSettings* lod_settings(void) {
+    return &level_settings[level];
+}
+
+const char* lod_level_name(LodLevel lod) {
+    return (lod >= 0 && lod < LOD_LEVEL_COUNT) ? level_names[lod] : "?";
+}
+
+float lod_average_frame_ms(void) {
+    return average * 1000.0f;
+}
@@ -0,0 +1,34 @@
+#ifndef LOD_H
+#define LOD_H
+
+#include <stdbool.h>
+#include "figure_batch.h"
+
+// Level of detail, picked automatically from the measured frame time
+typedef enum {
+    LOD_HIGH,
+    LOD_MEDIUM,
+    LOD_LOW,
+    LOD_MINIMAL,
+    LOD_LEVEL_COUNT
+} LodLevel;
+
+typedef struct {
+    float crowd_fraction;       // Share of the audience drawn
+    FigureDetail figure_detail;
+    float flash_hz;             // How often the celebrating crowd changes colour (0 = never)
+    bool text_shadow;           // DrawTextBold draws its shadow copy
+} LodSettings;
+
+// Watches frame time against the budget of target_fps. Detail drops one level when frames
+// run over budget for a while, and is probed back up after a stretch of frames with
+// headroom. A probe that immediately overruns again waits longer before the next one.
+void lod_init(int target_fps);
+void lod_update(float frame_time); // Call once per frame with GetFrameTime()
+
+LodLevel lod_level(void);
+const LodSettings* lod_settings(void);
+const char* lod_level_name(LodLevel level);
+float lod_average_frame_ms(void);
+
+#endif // LOD_H
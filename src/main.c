@@ -1,3 +1,6 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // For live_feed.c below, which needs it before any system header
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -19,6 +22,15 @@
 #include "ui.c"
 #include "grounds.c"
 #include "umpires.c"
+#include "field_setups.c"
+#include "field_coverage.c"
+#include "sim_engine.c"
+#include "job_queue.c"
+#include "live_feed.c"
+#include "ratings.c"
+#include "points_table.c"
+#include "qualification.c"
+#include "tournament_format.c"
 
 void main_menu(const char *email, const char *name);
 
@@ -2,9 +2,16 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#if defined(_WIN32)
 #include <direct.h> // For _mkdir on Windows
+#else
+#include <sys/stat.h> // For mkdir elsewhere
+#endif
 #include <errno.h>  // For checking errno
 #include "match.h"
+#include "sim_engine.h"
+#include "live_feed.h"
+#include "ratings.h"
 #include "ui.h"
 #include "teams.h"
 
@@ -46,9 +53,67 @@ void start_match_log(GameState *state, const char *match_id) {
     }
 }
 
+// Copies at most LIVE_FEED_TEXT_LEN - 1 characters, so the feed's names are always terminated.
+// The precision states the cut is meant, which keeps -Wformat-truncation quiet.
+static void copy_feed_text(char *dest, const char *src) {
+    snprintf(dest, LIVE_FEED_TEXT_LEN, "%.*s", LIVE_FEED_TEXT_LEN - 1, src ? src : "");
+}
+
+static void publish_live_ball(GameState *state, int inning_num, int over, int ball_in_over,
+                              Player *striker, Player *bowler, int runs_scored, BallOutcomeType outcome_type,
+                              const char *dismissal_method, Player *fielder) {
+    LiveBall ball = { 0 };
+    snprintf(ball.match_id, sizeof(ball.match_id), "%.*s", (int)sizeof(ball.match_id) - 1, state->match_id);
+    copy_feed_text(ball.batting_team, state->batting_team->name);
+    copy_feed_text(ball.bowling_team, state->bowling_team->name);
+
+    ball.inning_num = inning_num;
+    ball.over = over;
+    ball.ball = ball_in_over;
+    ball.outcome = outcome_type;
+    ball.runs = runs_scored;
+    copy_feed_text(ball.batsman, striker->name);
+    copy_feed_text(ball.bowler, bowler->name);
+    if (fielder) copy_feed_text(ball.fielder, fielder->name);
+    copy_feed_text(ball.dismissal, dismissal_method);
+
+    ball.total_runs = state->total_runs;
+    ball.wickets = state->wickets;
+    ball.balls_bowled = state->overs_completed * 6 + state->balls_bowled_in_over;
+    ball.max_overs = state->max_overs;
+    ball.target = state->target;
+    ball.batsman_runs = striker->total_runs;
+    ball.batsman_balls = striker->balls_faced;
+    ball.bowler_runs = bowler->match_runs_conceded;
+    ball.bowler_balls = bowler->match_balls_bowled;
+    ball.bowler_wickets = bowler->match_wickets;
+    live_feed_publish(state->live_feed, &ball);
+}
+
+// The XIs' ids are looked up once per innings, whoever started it, so a delivery is only array reads
+static void rate_ball(GameState *state, const Player *striker, const Player *bowler, int runs, bool wicket) {
+    if (state->rated_sides[0] != state->batting_team || state->rated_sides[1] != state->bowling_team) {
+        ratings_xi_ids(state->ratings, state->batting_team, state->rating_ids[0]);
+        ratings_xi_ids(state->ratings, state->bowling_team, state->rating_ids[1]);
+        state->rated_sides[0] = state->batting_team;
+        state->rated_sides[1] = state->bowling_team;
+    }
+    long batsman = striker - state->batting_team->players, bowled_by = bowler - state->bowling_team->players;
+    if (batsman < 0 || batsman >= state->batting_team->num_players || bowled_by < 0 || bowled_by >= state->bowling_team->num_players) return;
+    int a = state->rating_ids[0][batsman], b = state->rating_ids[1][bowled_by];
+    if (state->ratings_log) ratings_log_ball(state->ratings_log, a, b, runs, wicket);
+    else ratings_record_ball(state->ratings, a, b, runs, wicket);
+}
+
 void log_ball_data(GameState *state, int inning_num, int over, int ball_in_over,
                    Player *striker, Player *bowler, int runs_scored, BallOutcomeType outcome_type,
                    const char *dismissal_method, Player *fielder) {
+    if (state->live_feed) {
+        publish_live_ball(state, inning_num, over, ball_in_over, striker, bowler, runs_scored, outcome_type, dismissal_method, fielder);
+    }
+    if (state->ratings && (outcome_type == OUTCOME_DOT || outcome_type == OUTCOME_RUNS || outcome_type == OUTCOME_WICKET)) {
+        rate_ball(state, striker, bowler, runs_scored, outcome_type == OUTCOME_WICKET);
+    }
     if (!state->log_file) return;
 
     fprintf(state->log_file, "%d,%d,%d,%s,%s,%d,", inning_num, over, ball_in_over,
@@ -85,126 +150,6 @@ void end_match_log(GameState *state) {
     }
 }
 
-BallOutcome simulate_one_ball(GameState *state, int inning_num) {
-    BallOutcome outcome = { .type = OUTCOME_DOT, .runs = 0 };
-
-    Player *striker = &state->batting_team->players[state->striker_idx];
-    Player *bowler = &state->bowling_team->players[state->bowler_idx];
-
-    int bat_skill = striker->batting_skill;
-    int bowl_skill = bowler->bowling_skill;
-
-    // --- Core Simulation Logic (from original autoplay) ---
-    int run_chance = 50 + (bat_skill - bowl_skill) / 2;
-    if (run_chance < 10) run_chance = 10;
-    if (run_chance > 90) run_chance = 90;
-
-    int r = rand() % 100;
-    if (r < run_chance) {
-        // It's a scoring shot
-        outcome.type = OUTCOME_RUNS;
-        // The actual number of runs is now decided by the player in the GUI.
-        // We can still simulate a "potential" run value to guide where the ball goes.
-        // For now, we just signal that runs are possible.
-        outcome.runs = 1; // Signifies a hit, not the actual run count.
-        
-    } else {
-        // It's a chance for a wicket
-        int out_chance = 50 + (bowl_skill - bat_skill) / 4;
-        if (out_chance < 10) out_chance = 10;
-        if (out_chance > 90) run_chance = 90;
-
-        if ((rand() % 100) < out_chance) {
-            outcome.type = OUTCOME_WICKET;
-            outcome.runs = 0;
-            state->wickets++;
-            bowler->total_wickets++;
-
-            // Defer selection of the new batsman to the UI
-            state->awaiting_batsman_selection = true;
-            // Reserve an index for the next batsman (next in line after current pair)
-            int candidate = (state->striker_idx > state->non_striker_idx) ? state->striker_idx + 1 : state->non_striker_idx + 1;
-            if (candidate < state->batting_team->num_players)
-                state->next_batsman_idx = candidate;
-            else
-                state->next_batsman_idx = candidate; // will be validated by UI
-
-            state->striker_idx = -1; // striker removed; UI will set the incoming batsman
-
-            // Determine dismissal method (50/50 for now)
-            if (rand() % 2 == 0) {
-                strcpy(outcome.dismissal_method, "Bowled");
-                outcome.fielder = NULL; // No fielder for bowled
-            } else {
-                strcpy(outcome.dismissal_method, "Caught (Simulated)");
-                // For simplicity, for caught, we won't assign a specific fielder in CLI mode for now, just mark it as caught
-                outcome.fielder = NULL;
-            }
-        } else {
-            // It's a dot ball
-            outcome.type = OUTCOME_DOT;
-            outcome.runs = 0;
-            strcpy(outcome.dismissal_method, ""); // No dismissal
-            outcome.fielder = NULL;
-        }
-    }
-
-    // --- Update Game State ---
-    state->balls_bowled_in_over++;
-
-    // Update per-player match stats for this delivery
-    if (state->bowler_idx >= 0) {
-        Player *cb = &state->bowling_team->players[state->bowler_idx];
-        cb->match_balls_bowled++;
-        if (outcome.runs > 0) cb->match_runs_conceded += outcome.runs;
-        if (outcome.type == OUTCOME_WICKET) cb->match_wickets++;
-    }
-    if (striker) {
-        striker->balls_faced++;
-    }
-
-    // Strike rotation will now be handled by the GUI after runs are taken.
-    // if (outcome.runs % 2 != 0) {
-    //     int temp = state->striker_idx;
-    //     state->striker_idx = state->non_striker_idx;
-    //     state->non_striker_idx = temp;
-    // }
-
-    // Check for end of over
-    if (state->balls_bowled_in_over >= 6) {
-        state->overs_completed++;
-        state->balls_bowled_in_over = 0;
-        // Rotate strike at end of over
-        int temp = state->striker_idx;
-        state->striker_idx = state->non_striker_idx;
-        state->non_striker_idx = temp;
-
-        // --- DYNAMIC RAIN INTERRUPTION LOGIC ---
-        // Check for rain at the end of each over.
-        if (state->rain_percentage > 0 && (rand() % 100) < (state->rain_percentage * 100)) {
-            int overs_lost = 1 + (rand() % 5); // Lose 1 to 5 overs
-            if (state->max_overs - overs_lost > state->overs_completed) {
-                state->max_overs -= overs_lost;
-                printf("\n*** RAIN INTERRUPTION! Match reduced to %d overs. ***\n", state->max_overs);
-            }
-        }
-        // --- END RAIN LOGIC ---
-
-        // End of over: record last bowler and defer bowler selection to UI instead of auto-selecting
-        state->last_bowler_idx = state->bowler_idx;
-        state->awaiting_bowler_selection = true;
-        state->selected_bowler_idx = -1; // reset any temporary selection
-        state->bowler_idx = -1; // require user to pick next bowler
-
-    }
-    // Log ball data here, after all state updates for the ball
-    log_ball_data(state, inning_num, state->overs_completed, state->balls_bowled_in_over,
-                  striker, bowler, outcome.runs, outcome.type,
-                  outcome.dismissal_method, outcome.fielder);
-
-    return outcome;
-}
-
 // Helper function to create the Data/saves directory if it doesn't exist
 void create_saves_directory() {
     #if defined(_WIN32)
@@ -214,13 +159,55 @@ void create_saves_directory() {
     #endif
 }
 
-static int simulate_innings(GameState *state_ptr, Team *batting_team_param, Team *bowling_team_param, int max_overs_param, int autoplay_param, int *out_runs_param, int target_param, int inning_num)
+// Asks on stdin for whatever the engine is waiting for. Only called between steps, so the
+// engine itself never blocks and a bad answer just means being asked again.
+static void prompt_decision(SimEngine *engine, SimStatus status)
+{
+    GameState *state = engine->state;
+    SimDecision decision = { SIM_DECISION_RUNS, 0 };
+
+    if (status == SIM_STATUS_NEED_BOWLER) {
+        Team *team = state->bowling_team;
+        printf("\nChoose the bowler for over %d (max %d overs each):\n", state->overs_completed + 1, sim_bowling_quota(state));
+        for (int i = 0; i < team->num_players; i++) {
+            Player *p = &team->players[i];
+            if (p->bowling_skill <= 0) continue;
+            printf("%2d) %-24s %d-%d-%d%s\n", i + 1, p->name, p->match_balls_bowled / 6, p->match_runs_conceded,
+                   p->match_wickets, (i == state->last_bowler_idx) ? "  (bowled the last over)" : "");
+        }
+        decision.type = SIM_DECISION_BOWLER;
+    } else if (status == SIM_STATUS_NEED_BATSMAN) {
+        Team *team = state->batting_team;
+        printf("\nChoose the next batsman:\n");
+        for (int i = 0; i < team->num_players; i++) {
+            Player *p = &team->players[i];
+            if (p->is_out || i == state->striker_idx || i == state->non_striker_idx) continue;
+            printf("%2d) %s\n", i + 1, p->name);
+        }
+        decision.type = SIM_DECISION_BATSMAN;
+    } else if (status == SIM_STATUS_NEED_RUNS) {
+        Team *fielding = state->bowling_team;
+        printf("Ball in the field, %s is going for it. Runs to take (about %d are safe): ",
+               fielding->players[engine->last.fielder_index % fielding->num_players].name, engine->suggested_runs);
+    } else {
+        return;
+    }
+
+    if (status != SIM_STATUS_NEED_RUNS) printf("Choice: ");
+    int choice;
+    if (scanf("%d", &choice) != 1) choice = 0;
+    clean_stdin();
+    decision.value = (status == SIM_STATUS_NEED_RUNS) ? choice : choice - 1;
+    if (!sim_engine_decide(engine, decision)) printf("That choice is not available.\n");
+}
+
+// Plays the innings already set up on the engine's GameState to the end, asking for the
+// decisions the engine does not make itself. Returns the wickets lost.
+static int simulate_innings(SimEngine *engine, int *out_runs_param)
 {
-    // Use the passed state_ptr
-    GameState *state = state_ptr; // Alias for convenience
+    GameState *state = engine->state;
 
     // Re-link teams from tags if this is a loaded game state
-    // This is crucial if simulate_innings is called as part of a loaded game
     if (state->batting_team == NULL && strlen(state->batting_team_tag) > 0) {
         state->batting_team = get_team_by_tag(state->batting_team_tag);
     }
@@ -232,147 +219,42 @@ static int simulate_innings(GameState *state_ptr, Team *batting_team_param, Team
         return -1; // Indicate error
     }
 
-    // Initialize these only if it's a fresh start for innings, not a loaded one.
-    // This assumes the initial call to simulate_innings for a new match will have these values as 0.
-    // If a game is loaded, these will have non-zero values.
-    if (state->total_runs == 0 && state->wickets == 0 && state->overs_completed == 0 && state->balls_bowled_in_over == 0) {
-        state->batting_team = batting_team_param; // Reassign for fresh innings
-        state->bowling_team = bowling_team_param; // Reassign for fresh innings
-        state->total_runs = 0;
-        state->wickets = 0;
-        state->overs_completed = 0;
-        state->balls_bowled_in_over = 0;
-        // Defer batsman selection to the user at innings start
-        state->striker_idx = -1;
-        state->non_striker_idx = -1;
-        state->awaiting_batsman_selection = true;
-        state->next_batsman_idx = 2; // default next available index if needed
-
-        // Defer bowler selection to the user at innings/over start
-        state->bowler_idx = -1; // No bowler until user selects
-        state->last_bowler_idx = -1;
-        state->awaiting_bowler_selection = true;
-        state->selected_bowler_idx = -1;
-
-        // Reset per-player match stats for both teams
-        for (int i = 0; i < state->batting_team->num_players; ++i) {
-            Player *p = &state->batting_team->players[i];
-            p->total_runs = 0; p->balls_faced = 0; p->is_out = false; p->dismissal_info[0] = '\0';
-            p->match_runs_conceded = 0; p->match_balls_bowled = 0; p->match_wickets = 0;
-        }
-        for (int i = 0; i < state->bowling_team->num_players; ++i) {
-            Player *p = &state->bowling_team->players[i];
-            p->total_runs = 0; p->balls_faced = 0; p->is_out = false; p->dismissal_info[0] = '\0';
-            p->match_runs_conceded = 0; p->match_balls_bowled = 0; p->match_wickets = 0;
-        }
-    }
-    
-    state->max_overs = max_overs_param;
-    state->target = target_param;
-    // state->rain_percentage already set in simulate_match
-
-    // If there's no bowler set, ensure UI prompts for selection
-    if (state->bowler_idx == -1) {
-        state->awaiting_bowler_selection = true;
-        state->selected_bowler_idx = -1;
-    }
-
-    // --- Main Innings Loop ---
-    while (state->overs_completed < state->max_overs && state->wickets < 10) {
-        // Powerplay logic is now handled in GUI if applicable, not in CLI simulation
-        // if (state->overs_completed < 10) {
-        //     state->current_powerplay = POWERPLAY_1;
-        // } else if (state->overs_completed < 40) {
-        //     state->current_powerplay = POWERPLAY_2;
-        // } else {
-        //     state->current_powerplay = POWERPLAY_3;
-        // }
-
-        if (state->target > 0 && state->total_runs > state->target) {
-             break; // Target chased
+    for (;;) {
+        int max_overs_before = state->max_overs;
+        SimStatus status = sim_engine_step(engine);
+        if (status == SIM_STATUS_INNINGS_OVER || status == SIM_STATUS_MATCH_OVER) break;
+        if (status != SIM_STATUS_BALL_DONE) {
+            prompt_decision(engine, status);
+            continue;
         }
-        
-        Player *striker = &state->batting_team->players[state->striker_idx];
-        Player *bowler = &state->bowling_team->players[state->bowler_idx];
 
-        if (state->balls_bowled_in_over == 0) {
-            printf("\nOver %d, %s to bowl. Score: %d/%d\n", state->overs_completed + 1, bowler->name, state->total_runs, state->wickets);
-        }
-
-        BallOutcome outcome;
-        if(autoplay_param) {
-            outcome = simulate_one_ball(state, inning_num); // Pass state pointer and inning_num
-            // Log ball data immediately after simulation
-            log_ball_data(state, inning_num, state->overs_completed, state->balls_bowled_in_over,
-                          striker, bowler, outcome.runs, outcome.type,
-                          (outcome.type == OUTCOME_WICKET) ? "Simulated Wicket" : NULL, // Simplified dismissal for now
-                          NULL);
-        } else {
-             // Manual mode preserved for now
-            printf("Ball %d.%d: 1) Dot, 2) 1, 3) 2, 4) 4, 5) 6, 6) Wkt: ", state->overs_completed, state->balls_bowled_in_over+1);
-            int choice;
-            if (scanf("%d", &choice) != 1) choice = 1;
-            clean_stdin();
-            
-            outcome.runs = 0;
-            switch(choice) {
-                case 1: outcome.type = OUTCOME_DOT; break;
-                case 2: outcome.type = OUTCOME_RUNS; outcome.runs = 1; break;
-                case 3: outcome.type = OUTCOME_RUNS; outcome.runs = 2; break;
-                case 4: outcome.type = OUTCOME_RUNS; outcome.runs = 4; break;
-                case 5: outcome.type = OUTCOME_RUNS; outcome.runs = 6; break;
-                case 6: outcome.type = OUTCOME_WICKET; break;
-                default: outcome.type = OUTCOME_DOT; break;
-            }
-
-            // Manually update state based on choice
-            state->balls_bowled_in_over++;
-            if (outcome.type == OUTCOME_RUNS) {
-                state->total_runs += outcome.runs;
-                striker->total_runs += outcome.runs;
-                if(outcome.runs % 2 != 0) { int temp = state->striker_idx; state->striker_idx = state->non_striker_idx; state->non_striker_idx = temp; }
-            } else if (outcome.type == OUTCOME_WICKET) {
-                state->wickets++;
-                bowler->total_wickets++;
-                // Defer replacing batsman to UI
-                state->awaiting_batsman_selection = true;
-                int candidate = (state->striker_idx > state->non_striker_idx) ? state->striker_idx + 1 : state->non_striker_idx + 1;
-                if (candidate < state->batting_team->num_players) state->next_batsman_idx = candidate;
-                state->striker_idx = -1; // out; UI must set new striker
-            }
-            if (state->balls_bowled_in_over >= 6) {
-                state->overs_completed++;
-                state->balls_bowled_in_over = 0;
-                int temp = state->striker_idx; state->striker_idx = state->non_striker_idx; state->non_striker_idx = temp;
-
-                // Defer bowler selection to UI at end of over
-                state->awaiting_bowler_selection = true;
-                state->selected_bowler_idx = -1;
-                state->bowler_idx = -1;
-            }
-            // Log ball data for manual mode
-            log_ball_data(state, inning_num, state->overs_completed, state->balls_bowled_in_over,
-                          striker, bowler, outcome.runs, outcome.type,
-                          (outcome.type == OUTCOME_WICKET) ? "Manual Wicket" : NULL,
-                          NULL);
-        }
-        
-        // --- Print Outcome (replaces old summary logic) ---
-        printf(" -> %s on strike. ", striker->name);
-        switch(outcome.type) {
+        // --- Print Outcome ---
+        const BallOutcome *outcome = &engine->last;
+        Player *striker = &state->batting_team->players[engine->last_striker];
+        Player *bowler = &state->bowling_team->players[engine->last_bowler];
+        bool over_done = (state->balls_bowled_in_over == 0);
+        printf("%d.%d %s to %s: ", over_done ? state->overs_completed - 1 : state->overs_completed,
+               over_done ? 6 : state->balls_bowled_in_over, bowler->name, striker->name);
+        switch(outcome->type) {
             case OUTCOME_DOT: printf("Dot ball.\n"); break;
-            case OUTCOME_RUNS: printf("%d runs.\n", outcome.runs); break;
-            case OUTCOME_WICKET: printf("WICKET! %s is out!\n", striker->name); break;
+            case OUTCOME_RUNS: printf("%d run%s.\n", outcome->runs, outcome->runs > 1 ? "s" : ""); break;
+            case OUTCOME_WICKET: printf("WICKET! %s is out, %s.\n", striker->name, striker->dismissal_info); break;
             default: printf("...\n"); break;
         }
 
-        if (!autoplay_param && state->balls_bowled_in_over == 0) {
-             printf("End of over. Switch to autoplay? (1 for yes, 0 for no): ");
-            int ap_choice;
-            if(scanf("%d", &ap_choice) == 1 && ap_choice == 1) {
-                autoplay_param = 1;
+        if (state->max_overs < max_overs_before) {
+            printf("\n*** RAIN INTERRUPTION! Match reduced to %d overs. ***\n", state->max_overs);
+        }
+        if (over_done) {
+            printf("End of over %d. Score: %d/%d\n", state->overs_completed, state->total_runs, state->wickets);
+            if (engine->auto_decisions != SIM_AUTO_ALL && !sim_innings_over(state)) {
+                printf("Switch to autoplay? (1 for yes, 0 for no): ");
+                int ap_choice;
+                if (scanf("%d", &ap_choice) == 1 && ap_choice == 1) {
+                    engine->auto_decisions = SIM_AUTO_ALL;
+                }
+                clean_stdin();
             }
-            clean_stdin();
         }
     }
     *out_runs_param = state->total_runs;
@@ -489,7 +371,7 @@ bool load_game_state(GameState *state, const char *filename) {
     return true;
 }
 
-int simulate_match(Team *teamA, Team *teamB, MatchFormat format, int autoplay, int rain_possible, const char *umpires, const char* ground, char *out_summary, size_t summary_sz)
+int simulate_match(Team *teamA, Team *teamB, MatchFormat format, int autoplay, int rain_possible, const char *umpires, const char* ground, char *out_summary, size_t summary_sz, Match *result)
 {
     create_saves_directory(); // Ensure the saves directory exists
     // Generate a unique match ID
@@ -510,12 +392,18 @@ int simulate_match(Team *teamA, Team *teamB, MatchFormat format, int autoplay, i
     match_state.target = 0;
     match_state.rain_percentage = rain_possible ? 0.1f : 0.0f; // Simplified rain for now
     match_state.log_file = NULL; // Ensure it's NULL initially
-    strncpy(match_state.match_id, match_id, sizeof(match_state.match_id) - 1);
-    match_state.match_id[sizeof(match_state.match_id) - 1] = '\0';
+    snprintf(match_state.match_id, sizeof(match_state.match_id), "%.*s", (int)sizeof(match_state.match_id) - 1, match_id);
     match_state.format = format;
     match_state.inning_num = 0; // Will be set before each innings
 
     start_match_log(&match_state, match_id); // Start logging for the match
+    match_state.live_feed = live_feed_open(); // Scoreboards follow along; NULL just means no feed
+    Ratings ratings;
+    ratings_init(&ratings);
+    ratings_load(&ratings, RATINGS_FILE); // A first match starts everyone at RATINGS_INITIAL
+    ratings_add_team(&ratings, teamA);
+    ratings_add_team(&ratings, teamB);
+    match_state.ratings = &ratings;
 
     printf("\n--- Let's Play! ---\n");
     printf("%s vs %s\n", teamA->name, teamB->name);
@@ -565,16 +453,31 @@ int simulate_match(Team *teamA, Team *teamB, MatchFormat format, int autoplay, i
     int runsA = 0, runsB = 0;
     int wkA = 0, wkB = 0;
 
+    // The user makes every decision in manual mode, or none with autoplay
+    SimEngine engine;
+    sim_engine_init(&engine, &match_state, (uint32_t)rand(), autoplay ? SIM_AUTO_ALL : 0);
+
     printf("\n--- First Innings: %s batting ---\n", batting_first->name);
-    // Passing match_state (GameState pointer) and inning number (1)
     match_state.inning_num = 1;
-    wkA = simulate_innings(&match_state, batting_first, fielding_first, overs_per_innings, autoplay, &runsA, 0, 1);
-    
+    sim_start_innings(&match_state, batting_first, fielding_first, overs_per_innings, 0);
+    wkA = simulate_innings(&engine, &runsA);
+    int first_quota = match_state.max_overs * 6; // Rain may have taken overs off it
+
     printf("\n--- Second Innings: %s batting ---\n", fielding_first->name);
-    match_state.target = runsA + 1; // Set target for second innings
-    // Passing match_state (GameState pointer) and inning number (2)
-    match_state.inning_num = 2;
-    wkB = simulate_innings(&match_state, fielding_first, batting_first, overs_per_innings, autoplay, &runsB, match_state.target, 2);
+    sim_start_second_innings(&match_state); // Target is runsA + 1
+    wkB = simulate_innings(&engine, &runsB);
+
+    if (result) {
+        // Only a side that chased the target down is charged less than its overs
+        int chase_balls = runsB > runsA ? match_state.overs_completed * 6 + match_state.balls_bowled_in_over : match_state.max_overs * 6;
+        bool a_first = (batting_first == teamA);
+        result->runsA = a_first ? runsA : runsB;
+        result->wicketsA = a_first ? wkA : wkB;
+        result->ballsA = a_first ? first_quota : chase_balls;
+        result->runsB = a_first ? runsB : runsA;
+        result->wicketsB = a_first ? wkB : wkA;
+        result->ballsB = a_first ? chase_balls : first_quota;
+    }
 
     // Note: DLS calculation is complex. For now, we'll just compare raw scores.
     // A proper DLS implementation would adjust the target after the rain interruption in the first innings.
@@ -582,7 +485,13 @@ int simulate_match(Team *teamA, Team *teamB, MatchFormat format, int autoplay, i
     else if (runsA > runsB) snprintf(out_summary, summary_sz, "%s beat %s. Score %d/%d vs %d/%d. Ground: %s, Umpires: %s", batting_first->name, fielding_first->name, runsA, wkA, runsB, wkB, ground, umpires);
     else snprintf(out_summary, summary_sz, "%s beat %s. Score %d/%d vs %d/%d. Ground: %s, Umpires: %s", fielding_first->name, batting_first->name, runsB, wkB, runsA, wkA, ground, umpires);
 
+    ratings_record_result(&ratings, ratings_find(&ratings, batting_first->name, NULL), ratings_find(&ratings, fielding_first->name, NULL),
+                          runsA > runsB ? 0 : (runsB > runsA ? 1 : -1));
+    ratings_save(&ratings, RATINGS_FILE);
+    ratings_free(&ratings);
+
     end_match_log(&match_state); // End logging for the match
+    live_feed_close(match_state.live_feed);
     return 1;
 }
 
@@ -98,6 +98,13 @@ typedef struct {
 
         FILE *log_file;               // File pointer for ball-by-ball logging
 
+        struct LiveFeed *live_feed;   // Where every ball is published for scoreboards, NULL for background matches
+
+        struct Ratings *ratings;      // Every delivery is rated into it when set, NULL otherwise
+        struct RatingsLog *ratings_log; // With ratings set: deliveries are logged here instead, ids from ratings
+        const Team *rated_sides[2];   // The batting and bowling side rating_ids were looked up for
+        int rating_ids[2][MAX_PLAYERS]; // Their registry ids by player, looked up again only when the sides change
+
         // Fields to uniquely identify the match for saving/loading GameState
         char match_id[64];
         MatchFormat format;
@@ -106,9 +113,6 @@ typedef struct {
         GameplayPhase phase; // Current phase of the gameplay
     } GameState;
 
-// The new function to simulate a single ball
-BallOutcome simulate_one_ball(GameState *state, int inning_num);
-
 // Structure to represent a match
 typedef struct {
     Team *teamA;
@@ -119,10 +123,12 @@ typedef struct {
     int wicketsA;
     int runsB;
     int wicketsB;
-    char summary[512];
+    int ballsA;             // Charged for the net run rate: the full quota unless a chase was won
+    int ballsB;
 } Match;
 
-int simulate_match(Team *teamA, Team *teamB, MatchFormat format, int autoplay, int rain_possible, const char *umpires, const char* ground, char *out_summary, size_t summary_sz);
+// Fills the scores of `result` (teamA's and teamB's) when it is not NULL
+int simulate_match(Team *teamA, Team *teamB, MatchFormat format, int autoplay, int rain_possible, const char *umpires, const char* ground, char *out_summary, size_t summary_sz, Match *result);
 
 // Helper to get the next bowler (now accessible globally)
 Player* get_bowler(Team *team, int current_bowler_idx);
@@ -0,0 +1,239 @@
+#include "match_scheduler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+typedef struct {
+    MatchScheduler *owner;
+    int id;
+
+    // The coroutine's own state, only touched by the worker running it
+    SimMatch match;
+    SimRng toss;
+    int toss_winner;
+    int batting_first;
+    MatchWait answering;        // Input for the next run, written before it is queued
+    int value;
+
+    // Guarded by the scheduler's lock
+    MatchView view;             // Published at every suspension
+    bool queued;                // Queued or running
+    bool closing;               // Closed while queued, freed by the worker when it suspends
+} MatchSession;
+
+struct MatchScheduler {
+    JobQueue *pool;
+    MatchNotify notify;
+    void *notify_user;
+
+    pthread_mutex_t lock;
+    pthread_cond_t idle;
+    MatchSession **sessions;    // Indexed by id, NULL once closed; ids are never reused
+    int num_ids;
+    int capacity;
+    int open;
+    int running;                // Sessions queued or running
+};
+
+MatchScheduler* match_scheduler_create(JobQueue *pool, MatchNotify notify, void *user) {
+    MatchScheduler *sched = calloc(1, sizeof(MatchScheduler));
+    if (!sched) return NULL;
+    sched->pool = pool;
+    sched->notify = notify;
+    sched->notify_user = user;
+    pthread_mutex_init(&sched->lock, NULL);
+    pthread_cond_init(&sched->idle, NULL);
+    return sched;
+}
+
+void match_scheduler_destroy(MatchScheduler *sched) {
+    if (!sched) return;
+    pthread_mutex_lock(&sched->lock);
+    while (sched->running > 0) pthread_cond_wait(&sched->idle, &sched->lock);
+    pthread_mutex_unlock(&sched->lock);
+
+    for (int i = 0; i < sched->num_ids; i++) free(sched->sessions[i]);
+    free(sched->sessions);
+    pthread_mutex_destroy(&sched->lock);
+    pthread_cond_destroy(&sched->idle);
+    free(sched);
+}
+
+static MatchView make_view(const MatchSession *s, MatchWait wait) {
+    const SimMatch *m = &s->match;
+    MatchView v = {
+        .wait = wait,
+        .toss_winner = s->toss_winner,
+        .batting_first = s->batting_first,
+        .innings = m->innings,
+        .suggested_runs = m->engine.ball_in_field ? m->engine.suggested_runs : 0,
+        .winner = -1,
+        .version = s->view.version + 1,
+    };
+    for (int i = 0; i < 2; i++) {
+        v.runs[i] = m->runs[i];
+        v.wickets[i] = m->wickets[i];
+        v.balls[i] = m->balls[i];
+    }
+    if (wait != MATCH_WAIT_TOSS_CALL && wait != MATCH_WAIT_TOSS_CHOICE && m->innings < 2) {
+        v.runs[m->innings] = m->state.total_runs;
+        v.wickets[m->innings] = m->state.wickets;
+        v.balls[m->innings] = m->state.overs_completed * 6 + m->state.balls_bowled_in_over;
+    }
+    // Map the engine's "side batting first" back to team A/team B
+    if (m->innings >= 2 && m->winner >= 0) v.winner = (m->winner == 0) ? s->batting_first : 1 - s->batting_first;
+    return v;
+}
+
+// The coroutine body: takes the answer it suspended for, then plays on until the next question
+static MatchView run_session(MatchSession *s) {
+    SimMatch *m = &s->match;
+
+    switch (s->answering) {
+        case MATCH_WAIT_TOSS_CALL:
+            s->toss_winner = (sim_rng_range(&s->toss, 0, 1) == s->value) ? 0 : 1;
+            return make_view(s, MATCH_WAIT_TOSS_CHOICE);
+        case MATCH_WAIT_TOSS_CHOICE:
+            s->batting_first = (s->value == 0) ? s->toss_winner : 1 - s->toss_winner;
+            if (s->batting_first == 1) { // The XIs were set up with team A batting
+                Team temp = m->teams[0];
+                m->teams[0] = m->teams[1];
+                m->teams[1] = temp;
+                sim_start_innings(&m->state, &m->teams[0], &m->teams[1], m->state.max_overs, 0);
+            }
+            break;
+        case MATCH_WAIT_BOWLER:
+            sim_engine_decide(&m->engine, (SimDecision){ SIM_DECISION_BOWLER, s->value });
+            break;
+        case MATCH_WAIT_BATSMAN:
+            sim_engine_decide(&m->engine, (SimDecision){ SIM_DECISION_BATSMAN, s->value });
+            break;
+        case MATCH_WAIT_RUNS:
+            sim_engine_decide(&m->engine, (SimDecision){ SIM_DECISION_RUNS, s->value });
+            break;
+        default:
+            break;
+    }
+
+    for (;;) {
+        switch (sim_match_step(m)) {
+            case SIM_STATUS_NEED_BOWLER: return make_view(s, MATCH_WAIT_BOWLER);
+            case SIM_STATUS_NEED_BATSMAN: return make_view(s, MATCH_WAIT_BATSMAN);
+            case SIM_STATUS_NEED_RUNS: return make_view(s, MATCH_WAIT_RUNS);
+            case SIM_STATUS_MATCH_OVER: return make_view(s, MATCH_WAIT_FINISHED);
+            default: break; // A ball was bowled or the chase began
+        }
+    }
+}
+
+static void resume_job(void *arg) {
+    MatchSession *s = (MatchSession*)arg;
+    MatchScheduler *sched = s->owner;
+    MatchView view = run_session(s);
+
+    pthread_mutex_lock(&sched->lock);
+    s->view = view;
+    s->queued = false;
+    int id = s->id;
+    bool closing = s->closing;
+    pthread_mutex_unlock(&sched->lock);
+
+    if (closing) free(s);
+    else if (sched->notify) sched->notify(id, &view, sched->notify_user);
+
+    pthread_mutex_lock(&sched->lock);
+    if (--sched->running == 0) pthread_cond_broadcast(&sched->idle);
+    pthread_mutex_unlock(&sched->lock);
+}
+
+int match_scheduler_open(MatchScheduler *sched, const Team *team_a, const Team *team_b, int overs,
+                         uint32_t seed, unsigned auto_decisions) {
+    MatchSession *s = malloc(sizeof(MatchSession));
+    if (!s) return -1;
+    memset(s, 0, sizeof(*s));
+    s->owner = sched;
+    sim_match_init(&s->match, team_a, team_b, overs, seed);
+    s->match.engine.auto_decisions = auto_decisions;
+    sim_rng_seed(&s->toss, seed ^ 0xA5A5A5A5u);
+    s->toss_winner = -1;
+    s->batting_first = -1;
+    s->view = make_view(s, MATCH_WAIT_TOSS_CALL);
+
+    pthread_mutex_lock(&sched->lock);
+    if (sched->num_ids == sched->capacity) {
+        int capacity = sched->capacity ? sched->capacity * 2 : 256;
+        MatchSession **grown = realloc(sched->sessions, capacity * sizeof(MatchSession*));
+        if (!grown) {
+            pthread_mutex_unlock(&sched->lock);
+            free(s);
+            return -1;
+        }
+        sched->sessions = grown;
+        sched->capacity = capacity;
+    }
+    s->id = sched->num_ids++;
+    sched->sessions[s->id] = s;
+    sched->open++;
+    pthread_mutex_unlock(&sched->lock);
+    return s->id;
+}
+
+static MatchSession* find_session(MatchScheduler *sched, int id) {
+    return (id >= 0 && id < sched->num_ids) ? sched->sessions[id] : NULL;
+}
+
+bool match_scheduler_submit(MatchScheduler *sched, int id, MatchWait answering, int value) {
+    if ((answering == MATCH_WAIT_TOSS_CALL || answering == MATCH_WAIT_TOSS_CHOICE) && (value < 0 || value > 1)) return false;
+
+    pthread_mutex_lock(&sched->lock);
+    MatchSession *s = find_session(sched, id);
+    if (!s || s->queued || s->view.wait != answering || answering == MATCH_WAIT_FINISHED) {
+        pthread_mutex_unlock(&sched->lock);
+        return false;
+    }
+    s->answering = answering;
+    s->value = value;
+    s->queued = true;
+    s->view.wait = MATCH_WAIT_NONE;
+    sched->running++;
+    pthread_mutex_unlock(&sched->lock);
+
+    job_queue_push(sched->pool, resume_job, s);
+    return true;
+}
+
+bool match_scheduler_view(MatchScheduler *sched, int id, MatchView *view) {
+    pthread_mutex_lock(&sched->lock);
+    MatchSession *s = find_session(sched, id);
+    if (s && view) *view = s->view;
+    pthread_mutex_unlock(&sched->lock);
+    return s != NULL;
+}
+
+bool match_scheduler_inspect(MatchScheduler *sched, int id, void (*reader)(const SimMatch *match, void *user), void *user) {
+    pthread_mutex_lock(&sched->lock);
+    MatchSession *s = find_session(sched, id);
+    bool suspended = s && !s->queued;
+    if (suspended) reader(&s->match, user);
+    pthread_mutex_unlock(&sched->lock);
+    return suspended;
+}
+
+void match_scheduler_close(MatchScheduler *sched, int id) {
+    pthread_mutex_lock(&sched->lock);
+    MatchSession *s = find_session(sched, id);
+    if (s) {
+        sched->sessions[id] = NULL;
+        sched->open--;
+        if (s->queued) s->closing = true;
+        else free(s);
+    }
+    pthread_mutex_unlock(&sched->lock);
+}
+
+int match_scheduler_count(MatchScheduler *sched) {
+    pthread_mutex_lock(&sched->lock);
+    int open = sched->open;
+    pthread_mutex_unlock(&sched->lock);
+    return open;
+}
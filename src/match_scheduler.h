@@ -0,0 +1,62 @@
+#ifndef MATCH_SCHEDULER_H
+#define MATCH_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sim_engine.h"
+#include "job_queue.h"
+
+// Hosts any number of interactive matches on a small worker pool. Each match is a stackless
+// coroutine: everything it needs to carry on lives in one record, and it runs on whichever
+// worker picks it up until it needs a human decision, then suspends by simply returning.
+// Submitting the decision queues it to resume. No thread ever waits on a person, so a suspended
+// match costs its record (about 12 KB, mostly the two XIs) and nothing else.
+
+typedef enum {
+    MATCH_WAIT_NONE,            // Queued or running, input is refused until it suspends again
+    MATCH_WAIT_TOSS_CALL,       // value: 0 heads, 1 tails, called for team A
+    MATCH_WAIT_TOSS_CHOICE,     // value: 0 bat, 1 bowl, for the toss winner
+    MATCH_WAIT_BOWLER,          // value: index into the bowling XI
+    MATCH_WAIT_BATSMAN,         // value: index into the batting XI
+    MATCH_WAIT_RUNS,            // value: runs completed with the ball in the field
+    MATCH_WAIT_FINISHED
+} MatchWait;
+
+// What a match is waiting for and the score, as of its last suspension
+typedef struct {
+    MatchWait wait;
+    int toss_winner;            // 0 = team A, 1 = team B, -1 before the toss
+    int batting_first;          // Same numbering, -1 until the toss winner has chosen
+    int innings;                // Innings in progress, 2 once finished
+    int runs[2];                // Per innings, so runs[0] belongs to the side batting first
+    int wickets[2];
+    int balls[2];
+    int suggested_runs;         // While waiting for runs: what the batsmen would take themselves
+    int winner;                 // 0 = team A, 1 = team B, -1 = tie; once finished
+    uint32_t version;           // Goes up at every suspension
+} MatchView;
+
+typedef struct MatchScheduler MatchScheduler;
+
+// Called on a worker thread each time a match suspends; may submit to the scheduler
+typedef void (*MatchNotify)(int id, const MatchView *view, void *user);
+
+MatchScheduler* match_scheduler_create(JobQueue *pool, MatchNotify notify, void *user);
+void match_scheduler_destroy(MatchScheduler *sched); // Waits for running matches, then frees all of them
+
+// Starts a match between the XIs of two squads; it first waits for the toss call.
+// auto_decisions (SIM_AUTO_*) are made without suspending. Returns the match id, or -1.
+int match_scheduler_open(MatchScheduler *sched, const Team *team_a, const Team *team_b, int overs,
+                         uint32_t seed, unsigned auto_decisions);
+// Queues the match to resume with `value` as the answer to `answering`. False, changing nothing,
+// if the match is not suspended on that question. A decision the rules do not allow (a bowler
+// who bowled the last over, say) is asked for again.
+bool match_scheduler_submit(MatchScheduler *sched, int id, MatchWait answering, int value);
+bool match_scheduler_view(MatchScheduler *sched, int id, MatchView *view);
+// Calls `reader` with the match while it is suspended, under the scheduler's lock, so keep it short.
+// False if the match is running, queued or unknown.
+bool match_scheduler_inspect(MatchScheduler *sched, int id, void (*reader)(const SimMatch *match, void *user), void *user);
+void match_scheduler_close(MatchScheduler *sched, int id); // A running match is freed when it suspends
+int match_scheduler_count(MatchScheduler *sched);          // Open matches
+
+#endif // MATCH_SCHEDULER_H
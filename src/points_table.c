@@ -0,0 +1,232 @@
+#include "points_table.h"
+#include <stdbool.h>
+#include <string.h>
+
+// Net run rate as a fraction num/den with den > 0: runs_for/balls_faced - runs_against/balls_bowled,
+// a side that has not batted or bowled yet counting as 0 for that half
+static void nrr_fraction(const PointsTableEntry *e, int64_t *num, int64_t *den) {
+    int64_t bf = e->balls_faced, bb = e->balls_bowled;
+    if (bf > 0 && bb > 0) { *num = (int64_t)e->runs_for * bb - (int64_t)e->runs_against * bf; *den = bf * bb; }
+    else if (bf > 0) { *num = e->runs_for; *den = bf; }
+    else if (bb > 0) { *num = -(int64_t)e->runs_against; *den = bb; }
+    else { *num = 0; *den = 1; }
+}
+
+int points_table_compare_nrr(const PointsTableEntry *a, const PointsTableEntry *b) {
+    int64_t an, ad, bn, bd;
+    nrr_fraction(a, &an, &ad);
+    nrr_fraction(b, &bn, &bd);
+    // Each product is about runs * balls^3, which fits in 64 bits up to some 50,000 balls a team
+    int64_t lhs = an * bd, rhs = bn * ad;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+double points_table_nrr(const PointsTableEntry *entry) {
+    int64_t num, den;
+    nrr_fraction(entry, &num, &den);
+    return 6.0 * (double)num / (double)den;
+}
+
+// Level on everything the treap orders by except the team itself
+static bool tied(const PointsTable *table, int x, int y) {
+    const PointsTableEntry *a = &table->entries[x], *b = &table->entries[y];
+    return a->points == b->points && a->wins == b->wins && points_table_compare_nrr(a, b) == 0;
+}
+
+// Negative when team x ranks above team y
+static int compare(const PointsTable *table, int x, int y) {
+    const PointsTableEntry *a = &table->entries[x], *b = &table->entries[y];
+    if (a->points != b->points) return b->points - a->points;
+    if (a->wins != b->wins) return b->wins - a->wins;
+    int nrr = points_table_compare_nrr(b, a);
+    return nrr ? nrr : x - y;
+}
+
+// --- Treap ---
+
+static int node_size(const PointsTable *table, int node) {
+    return node < 0 ? 0 : table->size[node];
+}
+
+static void update(PointsTable *table, int node) {
+    table->size[node] = (uint8_t)(1 + node_size(table, table->left[node]) + node_size(table, table->right[node]));
+}
+
+static int insert(PointsTable *table, int node, int team) {
+    if (node < 0) {
+        table->left[team] = table->right[team] = -1;
+        table->size[team] = 1;
+        return team;
+    }
+    if (compare(table, team, node) < 0) {
+        table->left[node] = (int8_t)insert(table, table->left[node], team);
+        if (table->priority[table->left[node]] > table->priority[node]) { // Rotate right
+            int top = table->left[node];
+            table->left[node] = table->right[top];
+            table->right[top] = (int8_t)node;
+            update(table, node);
+            update(table, top);
+            return top;
+        }
+    } else {
+        table->right[node] = (int8_t)insert(table, table->right[node], team);
+        if (table->priority[table->right[node]] > table->priority[node]) { // Rotate left
+            int top = table->right[node];
+            table->right[node] = table->left[top];
+            table->left[top] = (int8_t)node;
+            update(table, node);
+            update(table, top);
+            return top;
+        }
+    }
+    update(table, node);
+    return node;
+}
+
+static int merge(PointsTable *table, int a, int b) {
+    if (a < 0) return b;
+    if (b < 0) return a;
+    if (table->priority[a] > table->priority[b]) {
+        table->right[a] = (int8_t)merge(table, table->right[a], b);
+        update(table, a);
+        return a;
+    }
+    table->left[b] = (int8_t)merge(table, a, table->left[b]);
+    update(table, b);
+    return b;
+}
+
+// Must be called before the team's entry changes, while the tree still orders it where it is
+static int erase(PointsTable *table, int node, int team) {
+    if (node < 0) return node;
+    if (node == team) return merge(table, table->left[node], table->right[node]);
+    if (compare(table, team, node) < 0) table->left[node] = (int8_t)erase(table, table->left[node], team);
+    else table->right[node] = (int8_t)erase(table, table->right[node], team);
+    update(table, node);
+    return node;
+}
+
+static int select_at(const PointsTable *table, int position) {
+    int node = table->root;
+    while (node >= 0) {
+        int left = node_size(table, table->left[node]);
+        if (position < left) node = table->left[node];
+        else if (position == left) return node;
+        else { position -= left + 1; node = table->right[node]; }
+    }
+    return -1;
+}
+
+static int tree_rank(const PointsTable *table, int team) {
+    int node = table->root, rank = 0;
+    while (node >= 0 && node != team) {
+        if (compare(table, team, node) < 0) node = table->left[node];
+        else { rank += node_size(table, table->left[node]) + 1; node = table->right[node]; }
+    }
+    return node < 0 ? -1 : rank + node_size(table, table->left[node]);
+}
+
+// --- Head to head ---
+
+// Orders teams level on points, wins and net run rate by the points they took off each other.
+// Done when asked for rather than in the tree: between three or more teams it need not be transitive.
+static void resolve_group(const PointsTable *table, int *group, int count) {
+    int mini[POINTS_TABLE_MAX_TEAMS];
+    for (int i = 0; i < count; i++) {
+        mini[i] = 0;
+        for (int j = 0; j < count; j++) mini[i] += table->head_to_head[group[i]][group[j]];
+    }
+    for (int i = 1; i < count; i++) { // Insertion sort, the group arrives in team order
+        int team = group[i], points = mini[i], j = i - 1;
+        for (; j >= 0 && mini[j] < points; j--) { group[j + 1] = group[j]; mini[j + 1] = mini[j]; }
+        group[j + 1] = team;
+        mini[j + 1] = points;
+    }
+}
+
+// The run of tree positions level with `position`, resolved; returns its first position
+static int level_group(const PointsTable *table, int position, int *group, int *count) {
+    int team = select_at(table, position);
+    int first = position, last = position;
+    while (first > 0 && tied(table, select_at(table, first - 1), team)) first--;
+    while (last + 1 < table->num_teams && tied(table, select_at(table, last + 1), team)) last++;
+    *count = last - first + 1;
+    for (int i = 0; i < *count; i++) group[i] = select_at(table, first + i);
+    if (*count > 1) resolve_group(table, group, *count);
+    return first;
+}
+
+// --- Table ---
+
+void points_table_init(PointsTable *table, Team *teams, int num_teams) {
+    if (num_teams > POINTS_TABLE_MAX_TEAMS) num_teams = POINTS_TABLE_MAX_TEAMS;
+    if (num_teams < 0) num_teams = 0;
+    memset(table, 0, sizeof(*table));
+    table->num_teams = num_teams;
+    table->root = -1;
+    for (int t = 0; t < num_teams; t++) {
+        table->entries[t].team = teams ? &teams[t] : NULL;
+        // Fixed priorities, so the same results always build the same tree
+        uint32_t h = (uint32_t)(t + 1) * 0x9E3779B1u;
+        table->priority[t] = h ^ (h >> 15);
+        table->root = (int8_t)insert(table, table->root, t);
+    }
+}
+
+void points_table_record(PointsTable *table, int team_a, int team_b, int winner, const int runs[2], const int balls[2]) {
+    int sides[2] = { team_a, team_b };
+    if (team_a < 0 || team_b < 0 || team_a >= table->num_teams || team_b >= table->num_teams || team_a == team_b) return;
+
+    for (int k = 0; k < 2; k++) table->root = (int8_t)erase(table, table->root, sides[k]);
+    for (int k = 0; k < 2; k++) {
+        PointsTableEntry *e = &table->entries[sides[k]];
+        int gained = (winner == -1) ? 1 : (winner == k ? 2 : 0);
+        e->played++;
+        e->points += gained;
+        if (winner == -1) e->draws++;
+        else if (winner == k) e->wins++;
+        else e->losses++;
+        table->head_to_head[sides[k]][sides[1 - k]] += (uint8_t)gained;
+        if (runs && balls) {
+            e->runs_for += runs[k];
+            e->balls_faced += balls[k];
+            e->runs_against += runs[1 - k];
+            e->balls_bowled += balls[1 - k];
+        }
+    }
+    for (int k = 0; k < 2; k++) table->root = (int8_t)insert(table, table->root, sides[k]);
+}
+
+int points_table_team_at(const PointsTable *table, int position) {
+    if (position < 0 || position >= table->num_teams) return -1;
+    int group[POINTS_TABLE_MAX_TEAMS], count;
+    int first = level_group(table, position, group, &count);
+    return group[position - first];
+}
+
+int points_table_position(const PointsTable *table, int team) {
+    int rank = (team >= 0 && team < table->num_teams) ? tree_rank(table, team) : -1;
+    if (rank < 0) return -1;
+    int group[POINTS_TABLE_MAX_TEAMS], count;
+    int first = level_group(table, rank, group, &count);
+    for (int i = 0; i < count; i++) if (group[i] == team) return first + i;
+    return rank;
+}
+
+int points_table_standings(const PointsTable *table, int *order) {
+    // In-order walk, then the head to head inside each level run
+    int stack[POINTS_TABLE_MAX_TEAMS], depth = 0, n = 0, node = table->root;
+    while (node >= 0 || depth > 0) {
+        while (node >= 0) { stack[depth++] = node; node = table->left[node]; }
+        node = stack[--depth];
+        order[n++] = node;
+        node = table->right[node];
+    }
+    for (int first = 0; first < n; ) {
+        int last = first;
+        while (last + 1 < n && tied(table, order[last + 1], order[first])) last++;
+        if (last > first) resolve_group(table, order + first, last - first + 1);
+        first = last + 1;
+    }
+    return n;
+}
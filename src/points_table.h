@@ -0,0 +1,51 @@
+#ifndef POINTS_TABLE_H
+#define POINTS_TABLE_H
+
+#include <stdint.h>
+#include "teams.h"
+
+#define POINTS_TABLE_MAX_TEAMS 32
+
+// Entry for the points table
+typedef struct {
+    Team *team;
+    int played;
+    int wins;
+    int losses;
+    int draws;
+    int points;
+    int runs_for;           // Net run rate is kept as these four totals, never rounded
+    int balls_faced;        // Charged balls: the full quota for a side bowled out
+    int runs_against;
+    int balls_bowled;
+} PointsTableEntry;
+
+// Standings kept in order as results come in: each result moves the two teams in an
+// order-statistics treap, so the table is never re-sorted and position k is O(log n) away.
+// Ranked on points, then wins, then net run rate, then the points taken off each other by the
+// teams still level (head to head), then the order the teams were given in. Everything is
+// inside the struct, so any number of tables can be kept at once, one per thread.
+typedef struct {
+    PointsTableEntry entries[POINTS_TABLE_MAX_TEAMS]; // By team, in the order given to init
+    int num_teams;
+    uint8_t head_to_head[POINTS_TABLE_MAX_TEAMS][POINTS_TABLE_MAX_TEAMS]; // Points team i has taken off team j
+    int8_t root;
+    int8_t left[POINTS_TABLE_MAX_TEAMS];
+    int8_t right[POINTS_TABLE_MAX_TEAMS];
+    uint8_t size[POINTS_TABLE_MAX_TEAMS];
+    uint32_t priority[POINTS_TABLE_MAX_TEAMS];
+} PointsTable;
+
+void points_table_init(PointsTable *table, Team *teams, int num_teams); // teams may be NULL, leaving entries[].team NULL
+// winner: 0 = team_a, 1 = team_b, -1 = tie. runs and balls are team_a's and team_b's,
+// balls charged as for the net run rate; both may be NULL when the scores are not known.
+void points_table_record(PointsTable *table, int team_a, int team_b, int winner, const int runs[2], const int balls[2]);
+int points_table_team_at(const PointsTable *table, int position); // 0 = top
+int points_table_position(const PointsTable *table, int team);
+int points_table_standings(const PointsTable *table, int *order); // Every team, top first; returns how many
+
+// Exact comparison: negative if a's net run rate is lower than b's, like strcmp
+int points_table_compare_nrr(const PointsTableEntry *a, const PointsTableEntry *b);
+double points_table_nrr(const PointsTableEntry *entry); // Runs per over, for display
+
+#endif // POINTS_TABLE_H
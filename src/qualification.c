@@ -0,0 +1,344 @@
+#include "qualification.h"
+#include "sim_engine.h"
+#include "points_table.h"
+#include "tournament.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define REPLICATES 25               // Jobs the runs are split into, each with its own resample of the results
+#define Z_95 1.959964
+
+// One engine result for a pairing, seen from the team with the lower index (side 0)
+typedef struct {
+    int16_t runs[2];
+    int16_t balls[2];               // Charged balls: the full quota for a side bowled out
+    int8_t winner;                  // 0, 1 or -1 for a tie
+} PairSample;
+
+typedef struct {
+    int team_a, team_b;
+} PairJob;
+
+typedef struct {
+    int qualify, semi_final, title;
+    long long position_sum;
+} Tally;
+
+typedef struct {
+    int runs;
+    uint32_t seed;
+    Tally tally[MAX_TEAMS_IN_TOURNAMENT]; // This replicate's own counts, written under the lock when it finishes
+    int runs_done;
+} RunsJob;
+
+// Set up by qualification_start before any job is queued, read-only afterwards
+static Team *teams = NULL;
+static int num_teams = 0;
+static int overs = SIM_MAX_OVERS;
+static int qualify_places = 4;
+static uint32_t sample_seed = 0;
+static PointsTable base;            // The results already in; each run plays on from a copy
+static QualFixture *pending = NULL; // Fixtures still to be played
+static int num_pending = 0;
+static PairSample *samples = NULL;  // QUAL_SAMPLES_PER_PAIR for every pairing, complete once the pair jobs are done
+static PairJob *pair_jobs = NULL;
+static RunsJob *runs_jobs = NULL;
+static int num_pair_jobs = 0, num_runs_jobs = 0;
+static JobQueue *queue = NULL;
+
+// Under the lock
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t all_done = PTHREAD_COND_INITIALIZER;
+static int jobs_pending = 0;
+static int pair_jobs_left = 0;
+static bool cancelled = false;
+static Tally tally[MAX_TEAMS_IN_TOURNAMENT];
+static int runs_done = 0;
+static bool ready = false;
+
+static void queue_runs_jobs(void);
+
+static int pair_index(int a, int b) {
+    if (a > b) { int t = a; a = b; b = t; }
+    return a * num_teams - a * (a + 1) / 2 + (b - a - 1);
+}
+
+// One of the pairing's results, with side 0 being team a. `resample` holds the sample numbers
+// this replicate draws from for every pairing.
+static PairSample draw_result(SimRng *rng, const uint16_t *resample, int a, int b) {
+    int pair = pair_index(a, b);
+    PairSample s = samples[pair * QUAL_SAMPLES_PER_PAIR + resample[pair * QUAL_SAMPLES_PER_PAIR + sim_rng_next(rng) % QUAL_SAMPLES_PER_PAIR]];
+    if (a > b) {
+        int16_t t;
+        t = s.runs[0]; s.runs[0] = s.runs[1]; s.runs[1] = t;
+        t = s.balls[0]; s.balls[0] = s.balls[1]; s.balls[1] = t;
+        if (s.winner >= 0) s.winner = (int8_t)(1 - s.winner);
+    }
+    return s;
+}
+
+// --- Pairing samples ---
+
+static void play_pair_job(void *arg) {
+    PairJob *job = (PairJob*)arg;
+    PairSample *out = &samples[pair_index(job->team_a, job->team_b) * QUAL_SAMPLES_PER_PAIR];
+    const Team *a = &teams[job->team_a], *b = &teams[job->team_b];
+    SimMatch *match = malloc(sizeof(SimMatch));
+
+    pthread_mutex_lock(&lock);
+    bool skip = cancelled;
+    pthread_mutex_unlock(&lock);
+
+    for (int k = 0; k < QUAL_SAMPLES_PER_PAIR && !skip; k++) {
+        SimRng toss;
+        sim_rng_seed(&toss, sample_seed + (uint32_t)(pair_index(job->team_a, job->team_b) * QUAL_SAMPLES_PER_PAIR + k) * 0x9E3779B9u);
+        int batting_first = sim_rng_range(&toss, 0, 1);
+        if (!match || a->num_players < 2 || b->num_players < 2) { // No squad to play with: a coin toss
+            out[k] = (PairSample){ .winner = (int8_t)batting_first };
+            continue;
+        }
+        sim_match_init(match, batting_first ? b : a, batting_first ? a : b, overs, sim_rng_next(&toss));
+        sim_match_play(match);
+
+        int side_first = batting_first, side_second = 1 - batting_first; // Innings 0 was played by side_first
+        PairSample *s = &out[k];
+        for (int i = 0; i < 2; i++) {
+            int side = i == 0 ? side_first : side_second;
+            s->runs[side] = (int16_t)match->runs[i];
+            s->balls[side] = (int16_t)(match->wickets[i] >= 10 ? match->state.max_overs * 6 : match->balls[i]);
+        }
+        s->winner = (int8_t)(match->winner < 0 ? -1 : (match->winner == 0 ? side_first : side_second));
+    }
+    free(match);
+
+    pthread_mutex_lock(&lock);
+    bool last = (--pair_jobs_left == 0);
+    if (last) jobs_pending += num_runs_jobs; // Before this job's own count goes, so the total never touches zero early
+    if (--jobs_pending == 0) pthread_cond_broadcast(&all_done);
+    pthread_mutex_unlock(&lock);
+
+    if (last) queue_runs_jobs(); // Every pairing has its samples, the tournament can be played
+}
+
+// --- Tournament runs ---
+
+// A knockout game; a tie goes to the super over, a coin toss here
+static int knockout(SimRng *rng, const uint16_t *resample, int a, int b) {
+    PairSample s = draw_result(rng, resample, a, b);
+    int winner = s.winner >= 0 ? s.winner : (int)(sim_rng_next(rng) & 1);
+    return winner ? b : a;
+}
+
+static void play_runs_job(void *arg) {
+    RunsJob *job = (RunsJob*)arg;
+    Tally local[MAX_TEAMS_IN_TOURNAMENT];
+    memset(local, 0, sizeof(local));
+    SimRng rng;
+    sim_rng_seed(&rng, job->seed);
+
+    pthread_mutex_lock(&lock);
+    int runs = cancelled ? 0 : job->runs;
+    pthread_mutex_unlock(&lock);
+
+    // A bootstrap replicate: every pairing's samples drawn again with replacement. How far the
+    // replicates disagree is how much the odds owe to having only QUAL_SAMPLES_PER_PAIR results.
+    int num_pairs = num_teams * (num_teams - 1) / 2;
+    uint16_t *resample = malloc(num_pairs * QUAL_SAMPLES_PER_PAIR * sizeof(uint16_t));
+    if (!resample) runs = 0;
+    for (int i = 0; i < num_pairs * QUAL_SAMPLES_PER_PAIR && resample; i++) resample[i] = (uint16_t)(sim_rng_next(&rng) % QUAL_SAMPLES_PER_PAIR);
+
+    for (int r = 0; r < runs; r++) {
+        // Ranked by the same table the tournament shows: exact net run rate, then head to head
+        PointsTable table = base;
+        for (int f = 0; f < num_pending; f++) {
+            const QualFixture *fx = &pending[f];
+            PairSample s = draw_result(&rng, resample, fx->team_a, fx->team_b);
+            int runs_ab[2] = { s.runs[0], s.runs[1] }, balls_ab[2] = { s.balls[0], s.balls[1] };
+            points_table_record(&table, fx->team_a, fx->team_b, s.winner, runs_ab, balls_ab);
+        }
+        int order[MAX_TEAMS_IN_TOURNAMENT];
+        points_table_standings(&table, order);
+
+        for (int pos = 0; pos < num_teams; pos++) {
+            Tally *t = &local[order[pos]];
+            t->position_sum += pos + 1;
+            if (pos < qualify_places) t->qualify++;
+            if (pos < 4) t->semi_final++;
+        }
+        int champion = order[0];
+        if (num_teams >= 4) {
+            champion = knockout(&rng, resample, knockout(&rng, resample, order[0], order[3]), knockout(&rng, resample, order[1], order[2]));
+        } else if (num_teams >= 2) {
+            champion = knockout(&rng, resample, order[0], order[1]);
+        }
+        local[champion].title++;
+    }
+    free(resample);
+
+    pthread_mutex_lock(&lock);
+    memcpy(job->tally, local, sizeof(local));
+    job->runs_done = runs;
+    for (int t = 0; t < num_teams; t++) {
+        tally[t].qualify += local[t].qualify;
+        tally[t].semi_final += local[t].semi_final;
+        tally[t].title += local[t].title;
+        tally[t].position_sum += local[t].position_sum;
+    }
+    runs_done += runs;
+    if (--jobs_pending == 0) {
+        pthread_cond_broadcast(&all_done);
+        ready = !cancelled;
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+static void queue_runs_jobs(void) {
+    for (int i = 0; i < num_runs_jobs; i++) job_queue_push(queue, play_runs_job, &runs_jobs[i]);
+}
+
+// --- Public ---
+
+static QualEstimate wilson(int successes, int trials) {
+    if (trials <= 0) return (QualEstimate){ 0, 0, 1 };
+    double n = trials, p = successes / n, z2 = Z_95 * Z_95;
+    double denom = 1.0 + z2 / n;
+    double centre = (p + z2 / (2 * n)) / denom;
+    double half = Z_95 * sqrt(p * (1 - p) / n + z2 / (4 * n * n)) / denom;
+    return (QualEstimate){ p, fmax(0.0, centre - half), fmin(1.0, centre + half) };
+}
+
+enum { ODDS_QUALIFY, ODDS_SEMI_FINAL, ODDS_TITLE };
+
+static int tally_count(const Tally *t, int which) {
+    return which == ODDS_QUALIFY ? t->qualify : (which == ODDS_SEMI_FINAL ? t->semi_final : t->title);
+}
+
+// The Wilson interval covers the runs only. The replicates' spread beyond what their own runs
+// explain comes from the pairings' samples, does not shrink with more runs, and is added on
+// both sides. Under the lock.
+static QualEstimate estimate(int team, int which) {
+    QualEstimate e = wilson(tally_count(&tally[team], which), runs_done);
+    double spread = 0.0;
+    int used = 0;
+    for (int i = 0; i < num_runs_jobs; i++) {
+        const RunsJob *job = &runs_jobs[i];
+        if (job->runs_done <= 0) continue;
+        double p = (double)tally_count(&job->tally[team], which) / job->runs_done;
+        spread += (p - e.p) * (p - e.p);
+        used++;
+    }
+    if (used < 2) return e;
+    double per_replicate = (double)runs_done / used;
+    double from_samples = spread / (used - 1) - e.p * (1 - e.p) / per_replicate;
+    if (from_samples <= 0) return e;
+    double t = Z_95 + (Z_95 * Z_95 * Z_95 + Z_95) / (4.0 * (used - 1)); // Student's t for the replicates' own spread
+    double widen = t * t * from_samples;
+    e.low = fmax(0.0, e.p - sqrt((e.p - e.low) * (e.p - e.low) + widen));
+    e.high = fmin(1.0, e.p + sqrt((e.high - e.p) * (e.high - e.p) + widen));
+    return e;
+}
+
+void qualification_start(JobQueue *pool, const Team *team_list, int count, const QualFixture *fixtures, int num_fixtures,
+                         int max_overs, int places, int runs, uint32_t seed) {
+    qualification_stop();
+    if (count < 2) return;
+    if (count > MAX_TEAMS_IN_TOURNAMENT) count = MAX_TEAMS_IN_TOURNAMENT;
+    if (runs <= 0) runs = QUAL_DEFAULT_RUNS;
+
+    num_teams = count;
+    overs = (max_overs > 0 && max_overs <= SIM_MAX_OVERS) ? max_overs : SIM_MAX_OVERS;
+    qualify_places = places > 0 ? places : 1;
+    sample_seed = seed ^ 0x5A17E5u;
+    num_pair_jobs = count * (count - 1) / 2;
+    num_runs_jobs = runs < REPLICATES ? runs : REPLICATES;
+    teams = malloc(count * sizeof(Team));
+    pending = malloc((num_fixtures > 0 ? num_fixtures : 1) * sizeof(QualFixture));
+    samples = malloc(num_pair_jobs * QUAL_SAMPLES_PER_PAIR * sizeof(PairSample));
+    pair_jobs = malloc(num_pair_jobs * sizeof(PairJob));
+    runs_jobs = calloc(num_runs_jobs, sizeof(RunsJob));
+    if (!teams || !pending || !samples || !pair_jobs || !runs_jobs) {
+        qualification_stop();
+        return;
+    }
+    memcpy(teams, team_list, count * sizeof(Team));
+
+    // The table so far, and what is left to play
+    points_table_init(&base, NULL, count);
+    num_pending = 0;
+    for (int f = 0; f < num_fixtures; f++) {
+        const QualFixture *fx = &fixtures[f];
+        if (fx->team_a < 0 || fx->team_a >= count || fx->team_b < 0 || fx->team_b >= count || fx->team_a == fx->team_b) continue;
+        if (fx->winner == QUAL_PENDING) pending[num_pending++] = *fx;
+        else points_table_record(&base, fx->team_a, fx->team_b, fx->winner, fx->runs, fx->balls);
+    }
+
+    for (int a = 0, i = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++, i++) pair_jobs[i] = (PairJob){ a, b };
+    }
+    for (int i = 0; i < num_runs_jobs; i++) {
+        runs_jobs[i].runs = runs / num_runs_jobs + (i < runs % num_runs_jobs ? 1 : 0);
+        runs_jobs[i].seed = seed + (uint32_t)i * 0x9E3779B9u;
+    }
+
+    pthread_mutex_lock(&lock);
+    memset(tally, 0, sizeof(tally));
+    runs_done = 0;
+    ready = false;
+    cancelled = false;
+    pair_jobs_left = num_pair_jobs;
+    jobs_pending = num_pair_jobs;
+    pthread_mutex_unlock(&lock);
+
+    queue = pool;
+    for (int i = 0; i < num_pair_jobs; i++) job_queue_push(pool, play_pair_job, &pair_jobs[i]);
+}
+
+bool qualification_ready(void) {
+    pthread_mutex_lock(&lock);
+    bool r = ready;
+    pthread_mutex_unlock(&lock);
+    return r;
+}
+
+bool qualification_odds(int team, QualOdds *out) {
+    pthread_mutex_lock(&lock);
+    bool ok = ready && team >= 0 && team < num_teams;
+    if (ok) {
+        const Tally *t = &tally[team];
+        out->qualify = estimate(team, ODDS_QUALIFY);
+        out->semi_final = estimate(team, ODDS_SEMI_FINAL);
+        out->title = estimate(team, ODDS_TITLE);
+        out->mean_position = runs_done ? (double)t->position_sum / runs_done : 0.0;
+    }
+    pthread_mutex_unlock(&lock);
+    return ok;
+}
+
+int qualification_runs(void) {
+    pthread_mutex_lock(&lock);
+    int r = ready ? runs_done : 0;
+    pthread_mutex_unlock(&lock);
+    return r;
+}
+
+void qualification_stop(void) {
+    pthread_mutex_lock(&lock);
+    cancelled = true; // Jobs not started yet return straight away
+    while (jobs_pending > 0) pthread_cond_wait(&all_done, &lock);
+    ready = false;
+    pthread_mutex_unlock(&lock);
+
+    free(teams);
+    free(pending);
+    free(samples);
+    free(pair_jobs);
+    free(runs_jobs);
+    teams = NULL;
+    pending = NULL;
+    samples = NULL;
+    pair_jobs = NULL;
+    runs_jobs = NULL;
+    num_teams = num_pending = num_pair_jobs = num_runs_jobs = 0;
+}
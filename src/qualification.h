@@ -0,0 +1,51 @@
+#ifndef QUALIFICATION_H
+#define QUALIFICATION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "teams.h"
+#include "job_queue.h"
+
+// Odds of every team finishing in the top places of a round-robin, by playing the rest of
+// the tournament many times over. Every pairing is first played QUAL_SAMPLES_PER_PAIR times
+// with the real engine; each run of the tournament then draws one of those results per
+// remaining fixture, so a run costs a few hundred nanoseconds and 100k runs take well under
+// a second. The knockout (1st v 4th, 2nd v 3rd, then the final) is drawn the same way.
+// The runs are split between bootstrap replicates that each resample those results, so the
+// intervals also carry the uncertainty of having only that many per pairing.
+//
+// Like sim_service, one computation at a time runs on the worker pool in the background.
+
+#define QUAL_SAMPLES_PER_PAIR 128
+#define QUAL_DEFAULT_RUNS 100000
+#define QUAL_PENDING -2             // QualFixture.winner of a fixture still to be played
+
+typedef struct {
+    int team_a, team_b;             // Indices into the teams given to qualification_start
+    int winner;                     // QUAL_PENDING, 0 = team_a, 1 = team_b, -1 = tie
+    int runs[2];                    // team_a's and team_b's totals, for the net run rate; 0 if unknown
+    int balls[2];                   // Balls each side faced, the full quota if it was bowled out
+} QualFixture;
+
+typedef struct {
+    double p;                       // Share of runs
+    double low, high;               // 95% interval: Wilson for the runs, widened by the replicates' spread
+} QualEstimate;
+
+typedef struct {
+    QualEstimate qualify;           // Top `qualify_places` of the table
+    QualEstimate semi_final;        // Top four
+    QualEstimate title;
+    double mean_position;           // 1 = top of the table
+} QualOdds;
+
+// Copies everything it needs and starts working on `pool` (NULL runs it all right here).
+// The table is ranked like the tournament's own (points_table.h), head to head included.
+void qualification_start(JobQueue *pool, const Team *teams, int num_teams, const QualFixture *fixtures, int num_fixtures,
+                         int overs, int qualify_places, int runs, uint32_t seed);
+bool qualification_ready(void);     // Never blocks
+bool qualification_odds(int team, QualOdds *odds); // false until ready
+int qualification_runs(void);       // Runs behind the odds, 0 until ready
+void qualification_stop(void);     // Waits for the jobs still running, then frees everything
+
+#endif // QUALIFICATION_H
@@ -0,0 +1,409 @@
+#include "ratings.h"
+#include <dirent.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEAM_K 24.0f                // Most a team's rating moves on one result
+#define BALL_K 2.0f                 // And a player's on one delivery
+#define MAX_DIFFERENCE 1200         // Beyond this the expected score hardly moves (0.999)
+
+enum { EVENT_BALL, EVENT_WICKET, EVENT_RESULT };
+
+// Expected score of the side rated d points above the other, for d in [-1200, 1200]
+static float expected_table[2 * MAX_DIFFERENCE + 1];
+static bool expected_built = false;
+
+// What a delivery is worth to the batsman, by runs off the bat. A wicket is 0; an average ball
+// comes out close to 0.5, so a batsman and a bowler of equal rating are expected to draw.
+static const float ball_score[] = { 0.35f, 0.5f, 0.6f, 0.7f, 0.85f, 0.9f, 1.0f };
+
+static float expected(float rating, float opponent) {
+    int d = (int)lrintf(rating - opponent);
+    if (d > MAX_DIFFERENCE) d = MAX_DIFFERENCE;
+    if (d < -MAX_DIFFERENCE) d = -MAX_DIFFERENCE;
+    return expected_table[d + MAX_DIFFERENCE];
+}
+
+// --- Registry ---
+
+// A team is keyed by its name alone, a player by squad and name
+static uint32_t hash_key(const char *team, const char *player) {
+    uint32_t h = 2166136261u; // FNV-1a
+    for (const unsigned char *p = (const unsigned char*)team; *p; p++) h = (h ^ *p) * 16777619u;
+    if (!player) return h;
+    h = (h ^ ',') * 16777619u; // players.dat's separator, which no team name holds
+    for (const unsigned char *p = (const unsigned char*)player; *p; p++) h = (h ^ *p) * 16777619u;
+    return h;
+}
+
+static int find_slot(const Ratings *ratings, const char *team, const char *player) {
+    uint32_t mask = (uint32_t)ratings->num_slots - 1;
+    RatingKind kind = player ? RATING_PLAYER : RATING_TEAM;
+    for (uint32_t i = hash_key(team, player) & mask; ; i = (i + 1) & mask) {
+        int id = ratings->slots[i];
+        if (id < 0) return (int)i;
+        if (ratings->kind[id] == kind && strcmp(ratings->team[id], team) == 0 && (!player || strcmp(ratings->name[id], player) == 0)) return (int)i;
+    }
+}
+
+static const char* player_of(const Ratings *ratings, int id) {
+    return ratings->kind[id] == RATING_PLAYER ? ratings->name[id] : NULL;
+}
+
+static void fill_slots(Ratings *ratings) {
+    for (int i = 0; i < ratings->num_slots; i++) ratings->slots[i] = -1;
+    for (int id = 0; id < ratings->count; id++) {
+        ratings->slots[find_slot(ratings, ratings->team[id], player_of(ratings, id))] = id;
+    }
+}
+
+static bool grow_slots(Ratings *ratings) {
+    int num_slots = ratings->num_slots ? ratings->num_slots * 2 : 256;
+    int32_t *slots = malloc(num_slots * sizeof(int32_t));
+    if (!slots) return false;
+    free(ratings->slots);
+    ratings->slots = slots;
+    ratings->num_slots = num_slots;
+    fill_slots(ratings);
+    return true;
+}
+
+static bool grow_entries(Ratings *ratings) {
+    int capacity = ratings->capacity ? ratings->capacity * 2 : 128;
+    float *rating = realloc(ratings->rating, capacity * sizeof(float));
+    if (rating) ratings->rating = rating;
+    uint32_t *events = realloc(ratings->events, capacity * sizeof(uint32_t));
+    if (events) ratings->events = events;
+    uint8_t *kind = realloc(ratings->kind, capacity);
+    if (kind) ratings->kind = kind;
+    char (*team)[MAX_TEAM_NAME_LEN] = realloc(ratings->team, capacity * sizeof(*team));
+    if (team) ratings->team = team;
+    char (*name)[RATINGS_NAME_LEN] = realloc(ratings->name, capacity * sizeof(*name));
+    if (name) ratings->name = name;
+    if (!rating || !events || !kind || !team || !name) return false;
+    ratings->capacity = capacity;
+    return true;
+}
+
+void ratings_init(Ratings *ratings) {
+    memset(ratings, 0, sizeof(*ratings));
+    if (!expected_built) {
+        for (int d = -MAX_DIFFERENCE; d <= MAX_DIFFERENCE; d++) {
+            expected_table[d + MAX_DIFFERENCE] = 1.0f / (1.0f + powf(10.0f, -d / 400.0f));
+        }
+        expected_built = true;
+    }
+}
+
+void ratings_free(Ratings *ratings) {
+    free(ratings->rating);
+    free(ratings->events);
+    free(ratings->kind);
+    free(ratings->team);
+    free(ratings->name);
+    free(ratings->slots);
+    memset(ratings, 0, sizeof(*ratings));
+}
+
+int ratings_find(const Ratings *ratings, const char *team, const char *player) {
+    if (ratings->num_slots == 0) return -1;
+    return ratings->slots[find_slot(ratings, team, player)];
+}
+
+int ratings_add(Ratings *ratings, const char *team, const char *player) {
+    int id = ratings_find(ratings, team, player);
+    if (id >= 0) return id;
+    // Keep the table at most 70% full
+    if ((ratings->count + 1) * 10 > ratings->num_slots * 7 && !grow_slots(ratings)) return -1;
+    if (ratings->count == ratings->capacity && !grow_entries(ratings)) return -1;
+
+    id = ratings->count++;
+    ratings->rating[id] = RATINGS_INITIAL;
+    ratings->events[id] = 0;
+    ratings->kind[id] = (uint8_t)(player ? RATING_PLAYER : RATING_TEAM);
+    snprintf(ratings->team[id], MAX_TEAM_NAME_LEN, "%s", team);
+    snprintf(ratings->name[id], RATINGS_NAME_LEN, "%s", player ? player : team);
+    ratings->slots[find_slot(ratings, ratings->team[id], player_of(ratings, id))] = id;
+    return id;
+}
+
+void ratings_add_team(Ratings *ratings, const Team *team) {
+    ratings_add(ratings, team->name, NULL);
+    for (int i = 0; i < team->num_players; i++) ratings_add(ratings, team->name, team->players[i].name);
+}
+
+void ratings_xi_ids(const Ratings *ratings, const Team *xi, int *ids) {
+    for (int i = 0; i < xi->num_players; i++) ids[i] = ratings_find(ratings, xi->name, xi->players[i].name);
+}
+
+bool ratings_rename(Ratings *ratings, const char *team, const char *player, const char *new_name) {
+    int id = ratings_find(ratings, team, player);
+    if (id < 0 || ratings_find(ratings, player ? team : new_name, player ? new_name : NULL) >= 0) return false;
+    if (player) {
+        snprintf(ratings->name[id], RATINGS_NAME_LEN, "%s", new_name);
+    } else {
+        // The squad goes with the team. Copied first, as team may point into the registry.
+        char old_team[MAX_TEAM_NAME_LEN];
+        snprintf(old_team, sizeof(old_team), "%s", team);
+        for (int i = 0; i < ratings->count; i++) {
+            if (strcmp(ratings->team[i], old_team) != 0) continue;
+            snprintf(ratings->team[i], MAX_TEAM_NAME_LEN, "%s", new_name);
+            if (ratings->kind[i] == RATING_TEAM) snprintf(ratings->name[i], RATINGS_NAME_LEN, "%s", new_name);
+        }
+    }
+    fill_slots(ratings); // Keys changed in place
+    return true;
+}
+
+// --- Updates ---
+
+void ratings_record_result(Ratings *ratings, int team_a, int team_b, int winner) {
+    if (team_a < 0 || team_b < 0 || team_a == team_b) return;
+    float score = winner < 0 ? 0.5f : (winner == 0 ? 1.0f : 0.0f);
+    float change = TEAM_K * (score - expected(ratings->rating[team_a], ratings->rating[team_b]));
+    ratings->rating[team_a] += change;
+    ratings->rating[team_b] -= change;
+    ratings->events[team_a]++;
+    ratings->events[team_b]++;
+}
+
+void ratings_record_ball(Ratings *ratings, int batsman, int bowler, int runs, bool wicket) {
+    if (batsman < 0 || bowler < 0) return;
+    if (runs < 0) runs = 0;
+    if (runs > 6) runs = 6;
+    float score = wicket ? 0.0f : ball_score[runs];
+    float change = BALL_K * (score - expected(ratings->rating[batsman], ratings->rating[bowler]));
+    ratings->rating[batsman] += change;
+    ratings->rating[bowler] -= change;
+    ratings->events[batsman]++;
+    ratings->events[bowler]++;
+}
+
+static void log_push(RatingsLog *log, RatingsEvent event) {
+    if (log->count == log->capacity) {
+        int capacity = log->capacity ? log->capacity * 2 : 512;
+        RatingsEvent *grown = realloc(log->events, capacity * sizeof(RatingsEvent));
+        if (!grown) return;
+        log->events = grown;
+        log->capacity = capacity;
+    }
+    log->events[log->count++] = event;
+}
+
+void ratings_log_ball(RatingsLog *log, int batsman, int bowler, int runs, bool wicket) {
+    log_push(log, (RatingsEvent){ batsman, bowler, (int8_t)(wicket ? EVENT_WICKET : EVENT_BALL), (int8_t)runs });
+}
+
+void ratings_log_result(RatingsLog *log, int team_a, int team_b, int winner) {
+    log_push(log, (RatingsEvent){ team_a, team_b, EVENT_RESULT, (int8_t)winner });
+}
+
+void ratings_apply(Ratings *ratings, const RatingsLog *log) {
+    for (int i = 0; i < log->count; i++) {
+        const RatingsEvent *e = &log->events[i];
+        if (e->kind == EVENT_RESULT) ratings_record_result(ratings, e->a, e->b, e->value);
+        else ratings_record_ball(ratings, e->a, e->b, e->value, e->kind == EVENT_WICKET);
+    }
+}
+
+static int id_in(Ratings *ratings, const Ratings *registry, int id) {
+    if (id < 0 || id >= registry->count) return -1;
+    return ratings_add(ratings, registry->team[id], player_of(registry, id));
+}
+
+void ratings_apply_from(Ratings *ratings, const RatingsLog *log, const Ratings *registry) {
+    for (int i = 0; i < log->count; i++) {
+        const RatingsEvent *e = &log->events[i];
+        int a = id_in(ratings, registry, e->a), b = id_in(ratings, registry, e->b);
+        if (e->kind == EVENT_RESULT) ratings_record_result(ratings, a, b, e->value);
+        else ratings_record_ball(ratings, a, b, e->value, e->kind == EVENT_WICKET);
+    }
+}
+
+void ratings_log_free(RatingsLog *log) {
+    free(log->events);
+    memset(log, 0, sizeof(*log));
+}
+
+// --- Files ---
+
+bool ratings_load(Ratings *ratings, const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        // A player's name may hold commas, so the two numbers are taken off the end; the team,
+        // as in players.dat, never does
+        char *events = strrchr(line, ',');
+        if (!events || (line[0] != 'T' && line[0] != 'P') || line[1] != ',') continue;
+        *events++ = '\0';
+        char *rating = strrchr(line, ',');
+        if (!rating || rating < line + 2) continue;
+        *rating++ = '\0';
+        char *team = line + 2, *player = NULL;
+        if (line[0] == 'P') {
+            player = strchr(team, ',');
+            if (!player) continue; // Written before players were keyed by squad; a rebuild brings them back
+            *player++ = '\0';
+        }
+        int id = ratings_add(ratings, team, player);
+        if (id < 0) break;
+        ratings->rating[id] = strtof(rating, NULL);
+        ratings->events[id] = (uint32_t)strtoul(events, NULL, 10);
+    }
+    fclose(f);
+    return true;
+}
+
+bool ratings_save(const Ratings *ratings, const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+    for (int id = 0; id < ratings->count; id++) {
+        if (ratings->kind[id] == RATING_TEAM) fprintf(f, "T,%s,%.2f,%u\n", ratings->team[id], ratings->rating[id], ratings->events[id]);
+        else fprintf(f, "P,%s,%s,%.2f,%u\n", ratings->team[id], ratings->name[id], ratings->rating[id], ratings->events[id]);
+    }
+    return fclose(f) == 0;
+}
+
+// --- Rebuilding from the match logs ---
+
+// Log names end in _YYYYmmdd_HHMMSS.log, which sorts by time
+static const char* log_time(const char *name) {
+    size_t n = strlen(name);
+    return n >= 20 ? name + n - 20 : name;
+}
+
+static int compare_logs(const void *a, const void *b) {
+    const char *x = *(const char* const*)a, *y = *(const char* const*)b;
+    int c = strcmp(log_time(x), log_time(y));
+    return c ? c : strcmp(x, y);
+}
+
+static int team_of(const Team *teams, int num_teams, const char *player, int exclude) {
+    for (int t = 0; t < num_teams; t++) {
+        if (teams[t].is_deleted || t == exclude) continue;
+        for (int p = 0; p < teams[t].num_players; p++) {
+            if (strcmp(teams[t].players[p].name, player) == 0) return t;
+        }
+    }
+    return -1;
+}
+
+// Splits a CSV line in place; empty fields are kept
+static int split_fields(char *line, char **fields, int max) {
+    int n = 0;
+    line[strcspn(line, "\r\n")] = '\0';
+    while (n < max) {
+        fields[n++] = line;
+        char *comma = strchr(line, ',');
+        if (!comma) break;
+        *comma = '\0';
+        line = comma + 1;
+    }
+    return n;
+}
+
+static bool replay_log(Ratings *ratings, const char *path, const Team *teams, int num_teams) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    char line[512];
+    int batting[2] = { -1, -1 }, bowling[2] = { -1, -1 }; // Found from each innings' first ball
+    bool started[2] = { false, false };
+    int totals[2] = { 0, 0 };
+    while (fgets(line, sizeof(line), f)) {
+        char *fields[9];
+        // Inning,Over,Ball,Bowler,Batsman,Runs,Outcome,DismissalMethod,Fielder
+        if (split_fields(line, fields, 9) < 7) continue;
+        int innings = atoi(fields[0]) - 1; // The header reads as 0 and is skipped here
+        if (innings < 0 || innings > 1) continue;
+        int runs = atoi(fields[5]);
+        totals[innings] += runs;
+        if (!started[innings]) {
+            // The log has names only: the squad with the opening batsman bats, the other squad
+            // holding the opening bowler bowls
+            started[innings] = true;
+            batting[innings] = team_of(teams, num_teams, fields[4], -1);
+            bowling[innings] = team_of(teams, num_teams, fields[3], batting[innings]);
+        }
+        if (batting[innings] < 0 || bowling[innings] < 0) continue; // Teams since removed
+
+        bool wicket = strcmp(fields[6], "WICKET") == 0;
+        if (!wicket && strcmp(fields[6], "DOT") != 0 && strcmp(fields[6], "RUNS") != 0) continue;
+        ratings_record_ball(ratings, ratings_add(ratings, teams[batting[innings]].name, fields[4]),
+                            ratings_add(ratings, teams[bowling[innings]].name, fields[3]), runs, wicket);
+    }
+    fclose(f);
+
+    int first = batting[0], second = batting[1];
+    if (first < 0 || second < 0 || first == second) return false; // Unfinished, or teams since removed
+    int winner = totals[1] > totals[0] ? 1 : (totals[1] < totals[0] ? 0 : -1);
+    ratings_record_result(ratings, ratings_add(ratings, teams[first].name, NULL), ratings_add(ratings, teams[second].name, NULL), winner);
+    return true;
+}
+
+int ratings_rebuild_from_logs(Ratings *ratings, const char *dir, const Team *teams, int num_teams, RatingsProgress *progress) {
+    ratings_free(ratings);
+    ratings_init(ratings);
+    DIR *d = opendir(dir);
+    if (!d) return 0;
+
+    char **names = NULL;
+    int count = 0, capacity = 0;
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        size_t n = strlen(entry->d_name);
+        if (strncmp(entry->d_name, "match_", 6) != 0 || n < 4 || strcmp(entry->d_name + n - 4, ".log") != 0) continue;
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            char **grown = realloc(names, capacity * sizeof(char*));
+            if (!grown) break;
+            names = grown;
+        }
+        names[count] = malloc(n + 1);
+        if (!names[count]) break;
+        memcpy(names[count++], entry->d_name, n + 1);
+    }
+    closedir(d);
+    qsort(names, count, sizeof(char*), compare_logs);
+    if (progress) __atomic_store_n(&progress->total, count, __ATOMIC_RELAXED);
+
+    int replayed = 0;
+    for (int i = 0; i < count; i++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+        if (replay_log(ratings, path, teams, num_teams)) replayed++;
+        free(names[i]);
+        if (progress) __atomic_store_n(&progress->done, i + 1, __ATOMIC_RELAXED);
+    }
+    free(names);
+    return replayed;
+}
+
+// --- Rankings ---
+
+typedef struct {
+    float rating;
+    int id;
+} Ranked;
+
+static int compare_ranked(const void *a, const void *b) {
+    const Ranked *x = a, *y = b;
+    if (x->rating != y->rating) return x->rating < y->rating ? 1 : -1;
+    return x->id - y->id;
+}
+
+int ratings_rank(const Ratings *ratings, RatingKind kind, uint32_t min_events, int *ids, int max) {
+    Ranked *ranked = malloc((ratings->count ? ratings->count : 1) * sizeof(Ranked));
+    if (!ranked) return 0;
+    int n = 0;
+    for (int id = 0; id < ratings->count; id++) {
+        if (ratings->kind[id] == kind && ratings->events[id] >= min_events) ranked[n++] = (Ranked){ ratings->rating[id], id };
+    }
+    qsort(ranked, n, sizeof(Ranked), compare_ranked);
+    if (n > max) n = max;
+    for (int i = 0; i < n; i++) ids[i] = ranked[i].id;
+    free(ranked);
+    return n;
+}
@@ -0,0 +1,95 @@
+#ifndef RATINGS_H
+#define RATINGS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "teams.h"
+
+// Elo-style ratings for teams and players, updated a result at a time. Every team and player
+// gets a registry id the first time it is seen, and ratings and counts are plain arrays by id.
+// Names are hashed only when an id is looked up: a match resolves its two XIs once per innings
+// (ratings_xi_ids), after which an update is two array reads, a table lookup and two writes.
+// Teams are rated on results, players on every delivery as a duel between batsman and bowler.
+// A player is keyed by squad and name, as in players.dat, so namesakes in two squads are rated
+// apart.
+
+#define RATINGS_FILE "Data/ratings.dat"
+#define RATINGS_INITIAL 1500.0f
+#define RATINGS_NAME_LEN (MAX_PLAYER_NAME_LEN > MAX_TEAM_NAME_LEN ? MAX_PLAYER_NAME_LEN : MAX_TEAM_NAME_LEN)
+
+typedef enum {
+    RATING_TEAM,
+    RATING_PLAYER
+} RatingKind;
+
+typedef struct Ratings {
+    int count;
+    int capacity;
+    float *rating;                  // By id
+    uint32_t *events;               // Matches for a team, deliveries for a player
+    uint8_t *kind;                  // RatingKind
+    char (*team)[MAX_TEAM_NAME_LEN]; // The team itself, or the player's squad
+    char (*name)[RATINGS_NAME_LEN];  // The player, or the team's name again
+    int32_t *slots;                 // Open addressing from kind, team and name to id, -1 when empty
+    int num_slots;
+} Ratings;
+
+void ratings_init(Ratings *ratings);
+void ratings_free(Ratings *ratings);
+// player NULL means the team itself. -1 if it has never been seen. Safe from many threads as
+// long as nothing is being added.
+int ratings_find(const Ratings *ratings, const char *team, const char *player);
+int ratings_add(Ratings *ratings, const char *team, const char *player); // Existing or new id, -1 out of memory
+void ratings_add_team(Ratings *ratings, const Team *team);               // The team and all its players
+// ids[i] for xi->players[i], -1 for anyone not added yet; a lookup only, so safe like ratings_find
+void ratings_xi_ids(const Ratings *ratings, const Team *xi, int *ids);
+// Follows a rename: player NULL renames the team and carries its squad along. False if nothing
+// had the old key or something already has the new one.
+bool ratings_rename(Ratings *ratings, const char *team, const char *player, const char *new_name);
+
+// winner: 0 = team_a, 1 = team_b, -1 = tie
+void ratings_record_result(Ratings *ratings, int team_a, int team_b, int winner);
+// A legal delivery; extras are left out as neither side earned them
+void ratings_record_ball(Ratings *ratings, int batsman, int bowler, int runs, bool wicket);
+
+// Results gathered on worker threads (ids from ratings_find) and applied later in a fixed
+// order, so the ratings do not depend on which match finished first
+typedef struct {
+    int32_t a, b;                   // Batsman and bowler, or the two teams
+    int8_t kind;
+    int8_t value;                   // Runs, or the winner
+} RatingsEvent;
+
+typedef struct RatingsLog {
+    RatingsEvent *events;
+    int count;
+    int capacity;
+} RatingsLog;
+
+void ratings_log_ball(RatingsLog *log, int batsman, int bowler, int runs, bool wicket);
+void ratings_log_result(RatingsLog *log, int team_a, int team_b, int winner);
+void ratings_apply(Ratings *ratings, const RatingsLog *log); // Leaves the log as it is
+// Same, for a log whose ids are another registry's: each is found in ratings by name, added if new
+void ratings_apply_from(Ratings *ratings, const RatingsLog *log, const Ratings *registry);
+void ratings_log_free(RatingsLog *log);
+
+// One "T,team,rating,events" or "P,team,player,rating,events" line each, as in the other Data files
+bool ratings_load(Ratings *ratings, const char *path); // false if there is no file yet
+bool ratings_save(const Ratings *ratings, const char *path);
+
+// How far a rebuild has got, for another thread to read with __atomic_load_n while it runs
+typedef struct {
+    int total;                      // Logs found, set once the directory has been listed
+    int done;                       // Logs read so far
+} RatingsProgress;
+
+// Starts again from RATINGS_INITIAL and replays every Data/match_*.log, oldest first, in one
+// pass over each file. Each innings' batting side is the squad with its first batsman, and the
+// fielding side the other squad with its first bowler. progress may be NULL.
+// Returns how many matches were replayed.
+int ratings_rebuild_from_logs(Ratings *ratings, const char *dir, const Team *teams, int num_teams, RatingsProgress *progress);
+
+// Ids of one kind, best first, that have at least min_events; returns how many were written
+int ratings_rank(const Ratings *ratings, RatingKind kind, uint32_t min_events, int *ids, int max);
+
+#endif // RATINGS_H
@@ -0,0 +1,192 @@
+#include "replica.h"
+#include <string.h>
+#include <math.h>
+
+#define POSITION_SCALE 4096.0f // Field units to int16: 1/4096 of the field radius, up to 8 radii out
+
+typedef struct {
+    uint8_t *p;
+    const uint8_t *in;
+} Cursor;
+
+static void put_u8(Cursor *c, int v) { *c->p++ = (uint8_t)v; }
+static void put_u16(Cursor *c, int v) { put_u8(c, v & 0xFF); put_u8(c, (v >> 8) & 0xFF); }
+static void put_text(Cursor *c, const char *text, int len) {
+    strncpy((char*)c->p, text, len); // Pads with zeros, so an unchanged name packs to the same bytes
+    c->p[len - 1] = '\0';
+    c->p += len;
+}
+static void put_coord(Cursor *c, float v) {
+    float q = roundf(v * POSITION_SCALE);
+    if (q > 32767.0f) q = 32767.0f;
+    if (q < -32767.0f) q = -32767.0f;
+    put_u16(c, (int)q);
+}
+static void put_point(Cursor *c, ReplicaPoint pt) { put_coord(c, pt.x); put_coord(c, pt.y); }
+
+static int get_u8(Cursor *c) { return *c->in++; }
+static int get_i8(Cursor *c) { return (int8_t)*c->in++; }
+static int get_u16(Cursor *c) { int v = c->in[0] | (c->in[1] << 8); c->in += 2; return v; }
+static void get_text(Cursor *c, char *text, int len) {
+    memcpy(text, c->in, len);
+    text[len - 1] = '\0';
+    c->in += len;
+}
+static float get_coord(Cursor *c) { return (int16_t)get_u16(c) / POSITION_SCALE; }
+static ReplicaPoint get_point(Cursor *c) { ReplicaPoint pt; pt.x = get_coord(c); pt.y = get_coord(c); return pt; }
+
+void replica_pack(const ReplicaState *s, uint8_t *out) {
+    Cursor c = { out, NULL };
+    put_text(&c, s->batting_team, REPLICA_NAME_LEN);
+    put_text(&c, s->bowling_team, REPLICA_NAME_LEN);
+    put_text(&c, s->striker, REPLICA_NAME_LEN);
+    put_text(&c, s->non_striker, REPLICA_NAME_LEN);
+    put_text(&c, s->bowler, REPLICA_NAME_LEN);
+    put_text(&c, s->keeper, REPLICA_NAME_LEN);
+
+    put_u16(&c, s->total_runs);
+    put_u16(&c, s->wickets);
+    put_u16(&c, s->overs_completed);
+    put_u16(&c, s->balls_in_over);
+    put_u16(&c, s->max_overs);
+    put_u16(&c, s->target);
+    put_u16(&c, s->inning_num);
+    put_u16(&c, s->powerplay);
+    put_u16(&c, s->striker_runs);
+    put_u16(&c, s->striker_balls);
+    put_u16(&c, s->non_striker_runs);
+    put_u16(&c, s->non_striker_balls);
+    put_u16(&c, s->bowler_balls);
+    put_u16(&c, s->bowler_runs);
+    put_u16(&c, s->bowler_wickets);
+    for (int i = 0; i < REPLICA_HISTORY; i++) put_u8(&c, i < s->history_count ? s->history[i] : 0);
+    put_u8(&c, s->history_count);
+
+    put_u8(&c, s->phase);
+    put_u8(&c, s->waiting);
+    put_u16(&c, s->ball_count);
+    put_u8(&c, s->last_ball);
+    put_text(&c, s->message, REPLICA_MESSAGE_LEN);
+    put_u8(&c, s->celebrating);
+
+    for (int i = 0; i < REPLICA_FIELDERS; i++) put_point(&c, s->fielders[i]);
+    put_point(&c, s->striker_pos);
+    put_point(&c, s->non_striker_pos);
+    put_point(&c, s->bowler_pos);
+    put_point(&c, s->runner_pos);
+    put_point(&c, s->ball_pos);
+    put_coord(&c, s->ball_altitude);
+    put_u8(&c, s->ball_visible);
+    put_u8(&c, s->runner_visible);
+}
+
+void replica_unpack(const uint8_t *in, ReplicaState *s) {
+    Cursor c = { NULL, in };
+    memset(s, 0, sizeof(ReplicaState));
+    get_text(&c, s->batting_team, REPLICA_NAME_LEN);
+    get_text(&c, s->bowling_team, REPLICA_NAME_LEN);
+    get_text(&c, s->striker, REPLICA_NAME_LEN);
+    get_text(&c, s->non_striker, REPLICA_NAME_LEN);
+    get_text(&c, s->bowler, REPLICA_NAME_LEN);
+    get_text(&c, s->keeper, REPLICA_NAME_LEN);
+
+    s->total_runs = get_u16(&c);
+    s->wickets = get_u16(&c);
+    s->overs_completed = get_u16(&c);
+    s->balls_in_over = get_u16(&c);
+    s->max_overs = get_u16(&c);
+    s->target = get_u16(&c);
+    s->inning_num = get_u16(&c);
+    s->powerplay = get_u16(&c);
+    s->striker_runs = get_u16(&c);
+    s->striker_balls = get_u16(&c);
+    s->non_striker_runs = get_u16(&c);
+    s->non_striker_balls = get_u16(&c);
+    s->bowler_balls = get_u16(&c);
+    s->bowler_runs = get_u16(&c);
+    s->bowler_wickets = get_u16(&c);
+    for (int i = 0; i < REPLICA_HISTORY; i++) s->history[i] = get_i8(&c);
+    s->history_count = get_u8(&c);
+    if (s->history_count > REPLICA_HISTORY) s->history_count = REPLICA_HISTORY;
+
+    s->phase = get_u8(&c);
+    s->waiting = (ReplicaWait)get_u8(&c);
+    s->ball_count = get_u16(&c);
+    s->last_ball = get_i8(&c);
+    get_text(&c, s->message, REPLICA_MESSAGE_LEN);
+    s->celebrating = get_u8(&c) != 0;
+
+    for (int i = 0; i < REPLICA_FIELDERS; i++) s->fielders[i] = get_point(&c);
+    s->striker_pos = get_point(&c);
+    s->non_striker_pos = get_point(&c);
+    s->bowler_pos = get_point(&c);
+    s->runner_pos = get_point(&c);
+    s->ball_pos = get_point(&c);
+    s->ball_altitude = get_coord(&c);
+    s->ball_visible = get_u8(&c) != 0;
+    s->runner_visible = get_u8(&c) != 0;
+}
+
+// A delta is a list of runs: u8 bytes to keep, u8 bytes to replace, then the new bytes.
+// Gaps of two bytes or less between changes are sent as changed, which is cheaper than a new run.
+int replica_delta_encode(const uint8_t *base, const uint8_t *next, uint8_t *out) {
+    int size = 0, pos = 0;
+    while (pos < REPLICA_PACKED_SIZE) {
+        int start = pos;
+        while (start < REPLICA_PACKED_SIZE && base[start] == next[start]) start++;
+        if (start == REPLICA_PACKED_SIZE) break;
+
+        int end = start + 1;
+        while (end < REPLICA_PACKED_SIZE && end - start < 255) {
+            if (base[end] != next[end]) { end++; continue; }
+            int gap = end;
+            while (gap < REPLICA_PACKED_SIZE && gap - end < 3 && base[gap] == next[gap]) gap++;
+            if (gap - end >= 3 || gap == REPLICA_PACKED_SIZE || gap - start > 255) break;
+            end = gap;
+        }
+
+        int skip = start - pos;
+        while (skip > 255) { // Long unchanged stretch: empty runs
+            out[size++] = 255;
+            out[size++] = 0;
+            skip -= 255;
+        }
+        out[size++] = (uint8_t)skip;
+        out[size++] = (uint8_t)(end - start);
+        memcpy(out + size, next + start, end - start);
+        size += end - start;
+        pos = end;
+    }
+    return size;
+}
+
+bool replica_delta_apply(uint8_t *state, const uint8_t *delta, int size) {
+    int pos = 0, i = 0;
+    while (i < size) {
+        if (i + 2 > size) return false;
+        int skip = delta[i], count = delta[i + 1];
+        i += 2;
+        pos += skip;
+        if (pos + count > REPLICA_PACKED_SIZE || i + count > size) return false;
+        memcpy(state + pos, delta + i, count);
+        pos += count;
+        i += count;
+    }
+    return true;
+}
+
+static ReplicaPoint lerp_point(ReplicaPoint a, ReplicaPoint b, float t) {
+    return (ReplicaPoint){ a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t };
+}
+
+void replica_lerp(const ReplicaState *a, const ReplicaState *b, float t, ReplicaState *out) {
+    *out = *b;
+    for (int i = 0; i < REPLICA_FIELDERS; i++) out->fielders[i] = lerp_point(a->fielders[i], b->fielders[i], t);
+    out->striker_pos = lerp_point(a->striker_pos, b->striker_pos, t);
+    out->non_striker_pos = lerp_point(a->non_striker_pos, b->non_striker_pos, t);
+    out->bowler_pos = lerp_point(a->bowler_pos, b->bowler_pos, t);
+    out->ball_altitude = a->ball_altitude + (b->ball_altitude - a->ball_altitude) * t;
+    // The ball and the chasing fielder appear at their start points; only glide once both ends show them
+    if (a->ball_visible && b->ball_visible) out->ball_pos = lerp_point(a->ball_pos, b->ball_pos, t);
+    if (a->runner_visible && b->runner_visible) out->runner_pos = lerp_point(a->runner_pos, b->runner_pos, t);
+}
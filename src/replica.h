@@ -0,0 +1,95 @@
+#ifndef REPLICA_H
+#define REPLICA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// What a spectator needs to redraw the gameplay screen, and its compact wire form. The host
+// fills one in every frame; only the bytes that changed since the last update are sent, so a
+// ball in flight costs a few bytes and a quiet screen costs nothing. Positions are in field
+// units (the fielding setup coordinates, the boundary is about 1.0 from the centre) so every
+// viewer can scale them to its own window.
+
+#define REPLICA_NAME_LEN 24
+#define REPLICA_MESSAGE_LEN 16
+#define REPLICA_FIELDERS 9
+#define REPLICA_HISTORY 6
+
+typedef struct {
+    float x, y;
+} ReplicaPoint;
+
+typedef enum {
+    REPLICA_WAIT_NONE,
+    REPLICA_WAIT_BOWLER,        // The host is picking the next bowler
+    REPLICA_WAIT_BATSMAN
+} ReplicaWait;
+
+typedef struct {
+    // Who is playing, changes rarely
+    char batting_team[REPLICA_NAME_LEN];
+    char bowling_team[REPLICA_NAME_LEN];
+    char striker[REPLICA_NAME_LEN];
+    char non_striker[REPLICA_NAME_LEN];
+    char bowler[REPLICA_NAME_LEN];
+    char keeper[REPLICA_NAME_LEN];
+
+    // Score
+    int total_runs;
+    int wickets;
+    int overs_completed;
+    int balls_in_over;
+    int max_overs;
+    int target;
+    int inning_num;
+    int powerplay;
+    int striker_runs;
+    int striker_balls;
+    int non_striker_runs;
+    int non_striker_balls;
+    int bowler_balls;
+    int bowler_runs;
+    int bowler_wickets;
+    int history[REPLICA_HISTORY];   // Same encoding as the screen's ball dots: runs, -1 for a wicket
+    int history_count;
+
+    // Play
+    int phase;                      // GameplayPhase
+    ReplicaWait waiting;
+    int ball_count;                 // Goes up once per delivery, so viewers can react to each ball
+    int last_ball;                  // Runs off it, -1 for a wicket
+    char message[REPLICA_MESSAGE_LEN]; // "FOUR!", "Play and Miss!"... while it is up, empty otherwise
+    bool celebrating;
+
+    // Motion, sent at most REPLICA_MOTION_HZ times a second and interpolated by viewers
+    ReplicaPoint fielders[REPLICA_FIELDERS];
+    ReplicaPoint striker_pos;
+    ReplicaPoint non_striker_pos;
+    ReplicaPoint bowler_pos;
+    ReplicaPoint runner_pos;        // The fielder chasing the ball
+    ReplicaPoint ball_pos;
+    float ball_altitude;
+    bool ball_visible;
+    bool runner_visible;
+} ReplicaState;
+
+#define REPLICA_MOTION_HZ 20
+
+// Fixed little-endian layout: the discrete part first, then the motion
+#define REPLICA_DISCRETE_SIZE (6 * REPLICA_NAME_LEN + 15 * 2 + REPLICA_HISTORY + 1 + 1 + 1 + 2 + 1 + REPLICA_MESSAGE_LEN + 1)
+#define REPLICA_MOTION_SIZE ((REPLICA_FIELDERS + 5) * 4 + 2 + 2)
+#define REPLICA_PACKED_SIZE (REPLICA_DISCRETE_SIZE + REPLICA_MOTION_SIZE)
+
+void replica_pack(const ReplicaState *state, uint8_t *out);
+void replica_unpack(const uint8_t *in, ReplicaState *state);
+
+// Writes the changes from `base` to `next` (both packed) and returns the size, 0 if nothing
+// changed. `out` needs room for 2 * REPLICA_PACKED_SIZE bytes.
+int replica_delta_encode(const uint8_t *base, const uint8_t *next, uint8_t *out);
+// Applies a delta to a packed state in place; false if it is malformed
+bool replica_delta_apply(uint8_t *state, const uint8_t *delta, int size);
+
+// Positions from a towards b; everything else is taken from b
+void replica_lerp(const ReplicaState *a, const ReplicaState *b, float t, ReplicaState *out);
+
+#endif // REPLICA_H
@@ -0,0 +1,147 @@
+#include "search_index.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+static unsigned int trigram_bucket(const char *s) {
+    unsigned int h = ((unsigned char)s[0] << 16) | ((unsigned char)s[1] << 8) | (unsigned char)s[2];
+    h *= 2654435761u; // Knuth multiplicative hash
+    return h >> 20;   // Top 12 bits -> SEARCH_TRIGRAM_BUCKETS
+}
+
+static void lower_copy(char *dest, const char *src, int size) {
+    int i = 0;
+    for (; src[i] && i < size - 1; i++) {
+        dest[i] = (char)tolower((unsigned char)src[i]);
+    }
+    dest[i] = '\0';
+}
+
+void search_index_init(SearchIndex *index) {
+    memset(index, 0, sizeof(SearchIndex));
+}
+
+void search_index_free(SearchIndex *index) {
+    free(index->text);
+    free(index->key_offsets);
+    free(index->bucket_start);
+    free(index->postings);
+    free(index->results);
+    search_index_init(index);
+}
+
+void search_index_clear(SearchIndex *index) {
+    index->num_keys = 0;
+    index->text_len = 0;
+    index->results_valid = false;
+}
+
+void search_index_add(SearchIndex *index, const char *key) {
+    int len = (int)strlen(key);
+
+    if (index->num_keys == index->keys_cap) {
+        index->keys_cap = index->keys_cap ? index->keys_cap * 2 : 64;
+        index->key_offsets = realloc(index->key_offsets, index->keys_cap * sizeof(int));
+    }
+    while (index->text_len + len + 1 > index->text_cap) {
+        index->text_cap = index->text_cap ? index->text_cap * 2 : 4096;
+        index->text = realloc(index->text, index->text_cap);
+    }
+
+    index->key_offsets[index->num_keys++] = index->text_len;
+    lower_copy(index->text + index->text_len, key, len + 1);
+    index->text_len += len + 1;
+}
+
+// Builds the trigram postings (counting pass, then a filling pass) for the keys added so far
+void search_index_finish(SearchIndex *index) {
+    free(index->bucket_start);
+    free(index->postings);
+    index->bucket_start = calloc(SEARCH_TRIGRAM_BUCKETS + 1, sizeof(int));
+    index->postings = NULL;
+
+    // A key is listed once per bucket even if it contains the trigram more than once,
+    // so remember the last key seen for every bucket.
+    int *last_key = malloc(SEARCH_TRIGRAM_BUCKETS * sizeof(int));
+    for (int pass = 0; pass < 2; pass++) {
+        int *fill = NULL;
+        if (pass == 1) {
+            for (int b = 0; b < SEARCH_TRIGRAM_BUCKETS; b++) {
+                index->bucket_start[b + 1] += index->bucket_start[b];
+            }
+            index->postings = malloc((index->bucket_start[SEARCH_TRIGRAM_BUCKETS] + 1) * sizeof(int));
+            fill = malloc(SEARCH_TRIGRAM_BUCKETS * sizeof(int));
+            memcpy(fill, index->bucket_start, SEARCH_TRIGRAM_BUCKETS * sizeof(int));
+        }
+        for (int b = 0; b < SEARCH_TRIGRAM_BUCKETS; b++) last_key[b] = -1;
+
+        for (int k = 0; k < index->num_keys; k++) {
+            const char *key = index->text + index->key_offsets[k];
+            for (int i = 0; key[i] && key[i + 1] && key[i + 2]; i++) {
+                unsigned int b = trigram_bucket(key + i);
+                if (last_key[b] == k) continue;
+                last_key[b] = k;
+                if (pass == 0) index->bucket_start[b + 1]++;
+                else index->postings[fill[b]++] = k;
+            }
+        }
+        free(fill);
+    }
+    free(last_key);
+
+    index->results = realloc(index->results, (index->num_keys + 1) * sizeof(int));
+    index->results_valid = false;
+}
+
+const int* search_index_query(SearchIndex *index, const char *query, int *num_results) {
+    char q[SEARCH_MAX_QUERY_LEN];
+    lower_copy(q, query, sizeof(q));
+    int qlen = (int)strlen(q);
+
+    if (!index->bucket_start) { // Never built
+        *num_results = 0;
+        return index->results;
+    }
+
+    if (index->results_valid && strcmp(q, index->last_query) == 0) {
+        *num_results = index->num_results; // Unchanged query, nothing to do
+        return index->results;
+    }
+
+    int count = 0;
+    if (qlen == 0) {
+        for (int k = 0; k < index->num_keys; k++) index->results[count++] = k;
+    } else if (index->results_valid && strncmp(q, index->last_query, strlen(index->last_query)) == 0) {
+        // Characters were appended: every new match was already a match, so only refine
+        for (int i = 0; i < index->num_results; i++) {
+            int k = index->results[i];
+            if (strstr(index->text + index->key_offsets[k], q)) index->results[count++] = k;
+        }
+    } else if (qlen >= 3) {
+        // Only keys that share the query's rarest trigram can match
+        int best_start = 0, best_len = -1;
+        for (int i = 0; i + 2 < qlen; i++) {
+            unsigned int b = trigram_bucket(q + i);
+            int len = index->bucket_start[b + 1] - index->bucket_start[b];
+            if (best_len < 0 || len < best_len) {
+                best_len = len;
+                best_start = index->bucket_start[b];
+            }
+        }
+        for (int i = 0; i < best_len; i++) {
+            int k = index->postings[best_start + i];
+            if (strstr(index->text + index->key_offsets[k], q)) index->results[count++] = k;
+        }
+    } else {
+        // One or two characters, too short for the trigram index
+        for (int k = 0; k < index->num_keys; k++) {
+            if (strstr(index->text + index->key_offsets[k], q)) index->results[count++] = k;
+        }
+    }
+
+    strcpy(index->last_query, q);
+    index->num_results = count;
+    index->results_valid = true;
+    *num_results = count;
+    return index->results;
+}
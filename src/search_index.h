@@ -0,0 +1,41 @@
+#ifndef SEARCH_INDEX_H
+#define SEARCH_INDEX_H
+
+#include <stdbool.h>
+
+#define SEARCH_MAX_QUERY_LEN 128
+#define SEARCH_TRIGRAM_BUCKETS 4096
+
+// Case-insensitive substring search over a fixed list of keys.
+// Keys are stored lower-cased together with a trigram index, and the result
+// of the last query is cached so it is only recomputed when the query changes.
+typedef struct {
+    char *text;                 // All lower-cased keys, each NUL terminated
+    int *key_offsets;           // Start of each key inside text
+    int num_keys;
+    int text_len;
+    int text_cap;
+    int keys_cap;
+
+    int *bucket_start;          // SEARCH_TRIGRAM_BUCKETS + 1 offsets into postings
+    int *postings;              // Ascending key ids for every trigram bucket
+
+    char last_query[SEARCH_MAX_QUERY_LEN];
+    int *results;               // Key ids matching last_query, ascending
+    int num_results;
+    bool results_valid;
+} SearchIndex;
+
+void search_index_init(SearchIndex *index);
+void search_index_free(SearchIndex *index);
+
+// Rebuilding: clear, add every key in id order, then finish
+void search_index_clear(SearchIndex *index);
+void search_index_add(SearchIndex *index, const char *key);
+void search_index_finish(SearchIndex *index);
+
+// Returns the ids of all keys containing the query (ascending). An empty query matches everything.
+// The returned array belongs to the index and stays valid until the next query or rebuild.
+const int* search_index_query(SearchIndex *index, const char *query, int *num_results);
+
+#endif // SEARCH_INDEX_H
@@ -0,0 +1,127 @@
+#ifndef SIM_ENGINE_H
+#define SIM_ENGINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "match.h"
+
+// Headless ball-by-ball simulation on a GameState, using the same batting, placement and
+// fielding model as the gameplay screen. Nothing is drawn, printed or prompted for, and every
+// match carries its own random state, so any number of matches can run at once on worker threads.
+
+#define SIM_REFERENCE_FIELD_RADIUS 240.0f // Gameplay field radius in pixels at 1280x720
+#define SIM_MAX_OVERS 50
+
+// Counter-based: draw n of a stream is a hash of (key, n), so a stream can be jumped to any
+// position. The engine moves to a fixed position before every delivery, which keeps two matches
+// on the same key drawing the same numbers ball for ball even when their choices differ; that
+// is what makes paired what-if studies (common random numbers) work. An antithetic stream
+// mirrors every draw of the plain one with the same key.
+typedef struct {
+    uint64_t key;
+    uint32_t counter;
+    bool antithetic;
+} SimRng;
+
+void sim_rng_seed(SimRng *rng, uint32_t seed);
+void sim_rng_seed_key(SimRng *rng, uint64_t key, bool antithetic);
+uint32_t sim_rng_next(SimRng *rng);
+int sim_rng_range(SimRng *rng, int min, int max); // Inclusive, like GetRandomValue
+SimRng sim_rng_split(SimRng *rng); // A new stream keyed from this one's key and position, mirrored with it
+// The stream of one replicate of one scenario. Studies pass the same scenario for every arm to
+// play them on common random numbers.
+uint64_t sim_stream_key(uint32_t seed, uint32_t scenario, uint32_t replicate);
+
+// Automatic selections, used whenever the GameState is waiting for one
+int sim_choose_bowler(const GameState *state);  // Least used bowler with overs left who did not bowl the last over
+int sim_choose_batsman(const GameState *state); // First batsman in the order who is not out and not in the middle
+void sim_pick_playing_xi(const Team *squad, Team *xi); // Keeper, five bowling options, then the order
+int sim_bowling_quota(const GameState *state); // Overs one bowler may bowl in the innings
+
+// Resets the innings counters and per-player match stats; the openers and the first bowler
+// are then waited for like any other selection
+void sim_start_innings(GameState *state, Team *batting, Team *bowling, int max_overs, int target);
+bool sim_innings_over(const GameState *state);
+// The side that bowled chases total_runs + 1 in the same number of overs
+void sim_start_second_innings(GameState *state);
+
+// A resumable innings on a GameState. sim_engine_step() never blocks: when the next delivery
+// needs a decision it returns what it is waiting for, and the caller answers with
+// sim_engine_decide() whenever it likes, from a prompt, a click or a strategy. Decisions named
+// in auto_decisions are made by the engine itself. The CLI, the gameplay screen and the
+// background matches all bowl through it, so there is one ball model in the game.
+
+typedef enum {
+    SIM_STATUS_BALL_DONE,       // A delivery was completed, it is in engine->last
+    SIM_STATUS_NEED_BOWLER,
+    SIM_STATUS_NEED_BATSMAN,    // One end is empty, at the start of the innings or after a wicket
+    SIM_STATUS_NEED_RUNS,       // The ball is in the field (engine->last has the shot and fielder) until the runs are decided
+    SIM_STATUS_INNINGS_OVER,    // First innings over; sim_start_second_innings() carries on
+    SIM_STATUS_MATCH_OVER
+} SimStatus;
+
+typedef enum {
+    SIM_DECISION_BOWLER,        // value: index into the bowling team, only between overs
+    SIM_DECISION_BATSMAN,       // value: index into the batting team, goes to the empty end
+    SIM_DECISION_FIELD,         // value: a FieldingSetup, at any time
+    SIM_DECISION_RUNS           // value: runs completed, only while the ball is in the field
+} SimDecisionType;
+
+typedef struct {
+    SimDecisionType type;
+    int value;
+} SimDecision;
+
+#define SIM_AUTO_BOWLER  0x1
+#define SIM_AUTO_BATSMAN 0x2
+#define SIM_AUTO_RUNS    0x4
+#define SIM_AUTO_ALL     (SIM_AUTO_BOWLER | SIM_AUTO_BATSMAN | SIM_AUTO_RUNS)
+
+typedef struct {
+    GameState *state;
+    SimRng rng;
+    unsigned auto_decisions;    // SIM_AUTO_* flags
+    bool ball_in_field;         // Waiting for SIM_DECISION_RUNS
+    int suggested_runs;         // What the batsmen would run by themselves while the ball is in the field
+    BallOutcome last;
+    int last_striker;           // Who faced and who bowled `last`
+    int last_bowler;
+} SimEngine;
+
+void sim_engine_init(SimEngine *engine, GameState *state, uint32_t seed, unsigned auto_decisions);
+// Makes the automatic decisions, then bowls one delivery if nothing else is waited for
+SimStatus sim_engine_step(SimEngine *engine);
+// Returns false, changing nothing, if the decision is not allowed right now
+bool sim_engine_decide(SimEngine *engine, SimDecision decision);
+
+typedef enum {
+    SIM_UNTIL_END_OF_OVER,
+    SIM_UNTIL_END_OF_INNINGS,
+    SIM_UNTIL_END_OF_MATCH      // Starts the second innings when the first one ends
+} SimUntil;
+
+// Bowls deliveries with every decision made automatically and returns how many.
+// Stops early when the innings (or, for SIM_UNTIL_END_OF_MATCH, the match) is over.
+int sim_engine_play_until(SimEngine *engine, SimUntil until);
+
+// A whole limited-overs match. state points into teams[], so a SimMatch must not be copied once started.
+typedef struct {
+    Team teams[2];          // Playing XIs, teams[0] bats first
+    GameState state;
+    SimEngine engine;       // Makes every decision
+    int runs[2];
+    int wickets[2];
+    int balls[2];
+    int innings;            // Innings in progress, 2 once the match is over
+    int winner;             // 0 or 1 (index into teams), -1 for a tie; set when the match is over
+} SimMatch;
+
+void sim_match_init(SimMatch *match, const Team *bat_first, const Team *bowl_first, int overs, uint32_t seed);
+bool sim_match_play_over(SimMatch *match); // Plays up to the end of the over or innings, false once the match is over
+// One sim_engine_step() with the engine's own auto_decisions. The chase and the result are
+// handled here: SIM_STATUS_INNINGS_OVER means the second innings has just been set up.
+SimStatus sim_match_step(SimMatch *match);
+void sim_match_play(SimMatch *match);
+bool sim_match_finished(const SimMatch *match);
+
+#endif // SIM_ENGINE_H
@@ -0,0 +1,294 @@
+#include "sim_service.h"
+#include "sim_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define MAX_TIMELINE (2 * SIM_MAX_OVERS)
+
+// Score at the end of one over, or at the end of an innings that stopped mid-over
+typedef struct {
+    int innings;
+    int runs;
+    int wickets;
+    int balls;
+} OverMark;
+
+typedef struct {
+    // Set up on the main thread before the job is queued
+    Team team_a, team_b;
+    bool background;
+    bool rated;         // Its deliveries and result are logged for the caller's ratings
+    uint32_t seed;
+
+    // Written by the worker; read by the main thread only after `computed` is seen under the lock
+    int batting_first;
+    int winner;
+    RatingsLog deliveries;  // With ratings: ids are the service's own registry's
+    OverMark timeline[MAX_TIMELINE];
+    int num_marks;
+    bool computed;
+
+    // Main thread only
+    bool ready;         // `computed` has been seen, the results above can be read freely
+    bool opened;
+    double opened_at;
+    bool revealed;      // Everything is shown, regardless of the clock
+    int shown_marks;
+    bool reported;      // Its finish was returned by sim_service_update
+} FixtureRecord;
+
+static FixtureRecord *records = NULL;
+static int num_records = 0;
+static Ratings *rated_into = NULL;  // Main thread only
+static Ratings registry;            // Every background team and player, filled before the jobs and read-only while they run
+static int open_first = 0, open_last = 0;
+static double clock_now = 0.0;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t all_done = PTHREAD_COND_INITIALIZER;
+static int jobs_pending = 0;
+
+static void play_fixture_job(void *arg) {
+    FixtureRecord *rec = (FixtureRecord*)arg;
+    SimMatch *match = malloc(sizeof(SimMatch));
+    int batting_first = 0, winner = -1, num_marks = 0;
+
+    if (match) {
+        SimRng toss;
+        sim_rng_seed(&toss, rec->seed);
+        batting_first = sim_rng_range(&toss, 0, 1);
+        const Team *first = batting_first ? &rec->team_b : &rec->team_a;
+        const Team *second = batting_first ? &rec->team_a : &rec->team_b;
+        sim_match_init(match, first, second, SIM_MAX_OVERS, sim_rng_next(&toss));
+        if (rec->rated) {
+            match->state.ratings = &registry;
+            match->state.ratings_log = &rec->deliveries;
+        }
+
+        bool more = true;
+        while (more && num_marks < MAX_TIMELINE) {
+            int innings = match->innings;
+            more = sim_match_play_over(match);
+            OverMark *mark = &rec->timeline[num_marks++];
+            mark->innings = innings;
+            if (match->innings != innings) {
+                mark->runs = match->runs[innings];
+                mark->wickets = match->wickets[innings];
+                mark->balls = match->balls[innings];
+            } else {
+                mark->runs = match->state.total_runs;
+                mark->wickets = match->state.wickets;
+                mark->balls = match->state.overs_completed * 6 + match->state.balls_bowled_in_over;
+            }
+        }
+        // Map the engine's "side batting first" back to teamA/teamB
+        if (match->winner >= 0) winner = (match->winner == 0) ? batting_first : 1 - batting_first;
+        if (rec->rated) {
+            ratings_log_result(&rec->deliveries, ratings_find(&registry, rec->team_a.name, NULL), ratings_find(&registry, rec->team_b.name, NULL), winner);
+        }
+        free(match);
+    }
+
+    pthread_mutex_lock(&lock);
+    rec->batting_first = batting_first;
+    rec->winner = winner;
+    rec->num_marks = num_marks;
+    rec->computed = true;
+    if (--jobs_pending == 0) pthread_cond_broadcast(&all_done);
+    pthread_mutex_unlock(&lock);
+}
+
+void sim_service_start(JobQueue *pool, const Match *fixtures, const bool *background, int count, uint32_t seed, Ratings *ratings) {
+    sim_service_stop();
+    if (count <= 0) return;
+
+    records = calloc(count, sizeof(FixtureRecord));
+    if (!records) return;
+    num_records = count;
+    open_first = open_last = 0;
+
+    for (int i = 0; i < count; i++) {
+        FixtureRecord *rec = &records[i];
+        rec->team_a = *fixtures[i].teamA;
+        rec->team_b = *fixtures[i].teamB;
+        rec->background = background[i];
+        rec->seed = seed + (uint32_t)i * 0x9E3779B9u; // Spread neighbouring fixtures across the sequence
+        rec->winner = -1;
+        rec->rated = ratings && rec->background;
+        if (rec->rated) {
+            ratings_add_team(&registry, &rec->team_a);
+            ratings_add_team(&registry, &rec->team_b);
+        }
+    }
+    rated_into = ratings;
+
+    pthread_mutex_lock(&lock);
+    for (int i = 0; i < count; i++) if (records[i].background) jobs_pending++;
+    pthread_mutex_unlock(&lock);
+    for (int i = 0; i < count; i++) {
+        if (records[i].background) job_queue_push(pool, play_fixture_job, &records[i]);
+    }
+}
+
+void sim_service_stop(void) {
+    pthread_mutex_lock(&lock);
+    while (jobs_pending > 0) pthread_cond_wait(&all_done, &lock);
+    pthread_mutex_unlock(&lock);
+
+    for (int i = 0; i < num_records; i++) ratings_log_free(&records[i].deliveries);
+    free(records);
+    records = NULL;
+    num_records = 0;
+    rated_into = NULL;
+    ratings_free(&registry);
+    open_first = open_last = 0;
+}
+
+bool sim_service_active(void) {
+    return records != NULL;
+}
+
+void sim_service_open_day(int first, int last) {
+    if (!records) return;
+    sim_service_finish_day();
+    if (first < 0) first = 0;
+    if (last > num_records) last = num_records;
+    for (int i = first; i < last; i++) {
+        records[i].opened = true;
+        records[i].opened_at = clock_now;
+    }
+    open_first = first;
+    open_last = last;
+}
+
+void sim_service_finish_day(void) {
+    for (int i = 0; i < open_last && records; i++) {
+        if (records[i].opened) records[i].revealed = true;
+    }
+}
+
+static bool is_computed(FixtureRecord *rec) {
+    pthread_mutex_lock(&lock);
+    bool computed = rec->computed;
+    pthread_mutex_unlock(&lock);
+    return computed;
+}
+
+static bool is_finished(const FixtureRecord *rec) {
+    return rec->ready && rec->shown_marks >= rec->num_marks;
+}
+
+bool sim_service_day_finished(void) {
+    for (int i = open_first; i < open_last && records; i++) {
+        if (records[i].background && !is_finished(&records[i])) return false;
+    }
+    return true;
+}
+
+void sim_service_day_range(int *first, int *last) {
+    *first = open_first;
+    *last = open_last;
+}
+
+bool sim_service_update(double now) {
+    clock_now = now;
+    bool any_finished = false;
+    for (int i = 0; i < open_last && records; i++) {
+        FixtureRecord *rec = &records[i];
+        if (!rec->background || !rec->opened || rec->reported) continue;
+        if (!rec->ready) rec->ready = is_computed(rec);
+        if (!rec->ready) continue; // Only while its job is still in the queue, never for long
+
+        if (rec->revealed) {
+            rec->shown_marks = rec->num_marks;
+        } else {
+            int due = (int)((now - rec->opened_at) / SIM_TICKER_SECONDS_PER_OVER);
+            rec->shown_marks = due < rec->num_marks ? due : rec->num_marks;
+        }
+        if (is_finished(rec)) {
+            rec->reported = true;
+            any_finished = true;
+            if (rated_into) {
+                ratings_apply_from(rated_into, &rec->deliveries, &registry);
+                ratings_log_free(&rec->deliveries);
+            }
+        }
+    }
+    return any_finished;
+}
+
+bool sim_service_view(int fixture, SimFixtureView *view) {
+    if (!records || fixture < 0 || fixture >= num_records || !records[fixture].background) {
+        if (view) *view = (SimFixtureView){ .status = SIM_FIXTURE_NOT_SIMULATED, .winner = -1 };
+        return false;
+    }
+    const FixtureRecord *rec = &records[fixture];
+    SimFixtureView v = { .status = SIM_FIXTURE_SCHEDULED, .winner = -1 };
+
+    if (rec->opened) v.status = SIM_FIXTURE_LIVE;
+    if (rec->opened && rec->ready) {
+        v.batting_first = rec->batting_first;
+        for (int m = 0; m < rec->shown_marks; m++) {
+            const OverMark *mark = &rec->timeline[m];
+            v.innings = mark->innings;
+            v.runs[mark->innings] = mark->runs;
+            v.wickets[mark->innings] = mark->wickets;
+            v.balls[mark->innings] = mark->balls;
+        }
+        // Once the first innings is complete the chase is shown from 0/0
+        if (rec->shown_marks > 0 && v.innings == 0 && rec->shown_marks < rec->num_marks &&
+            rec->timeline[rec->shown_marks].innings == 1) {
+            v.innings = 1;
+        }
+        if (rec->reported) {
+            v.status = SIM_FIXTURE_FINISHED;
+            v.winner = rec->winner;
+        }
+    }
+    if (view) *view = v;
+    return true;
+}
+
+static const char* short_name(const Team *team) {
+    return team->tag[0] ? team->tag : team->name;
+}
+
+void sim_service_describe(int fixture, char *buffer, size_t size) {
+    SimFixtureView v;
+    if (!sim_service_view(fixture, &v)) {
+        buffer[0] = '\0';
+        return;
+    }
+    const FixtureRecord *rec = &records[fixture];
+    const Team *sides[2] = { &rec->team_a, &rec->team_b };
+    const Team *first = sides[v.batting_first];
+    const Team *second = sides[1 - v.batting_first];
+
+    switch (v.status) {
+        case SIM_FIXTURE_SCHEDULED:
+        case SIM_FIXTURE_NOT_SIMULATED:
+            snprintf(buffer, size, "%s v %s", short_name(sides[0]), short_name(sides[1]));
+            break;
+        case SIM_FIXTURE_LIVE:
+            if (v.innings == 0) {
+                snprintf(buffer, size, "%s %d/%d (%d.%d) v %s", short_name(first), v.runs[0], v.wickets[0],
+                         v.balls[0] / 6, v.balls[0] % 6, short_name(second));
+            } else {
+                snprintf(buffer, size, "%s %d/%d (%d.%d) need %d v %s", short_name(second), v.runs[1], v.wickets[1],
+                         v.balls[1] / 6, v.balls[1] % 6, v.runs[0] + 1 - v.runs[1], short_name(first));
+            }
+            break;
+        case SIM_FIXTURE_FINISHED:
+            if (v.winner < 0) {
+                snprintf(buffer, size, "%s v %s tied on %d", short_name(first), short_name(second), v.runs[0]);
+            } else if (sides[v.winner] == second) {
+                int all_out = second->num_players > 11 ? 10 : second->num_players - 1; // Squads are cut to an XI
+                snprintf(buffer, size, "%s beat %s by %d wickets", short_name(second), short_name(first), all_out - v.wickets[1]);
+            } else {
+                snprintf(buffer, size, "%s beat %s by %d runs", short_name(first), short_name(second), v.runs[0] - v.runs[1]);
+            }
+            break;
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef SIM_SERVICE_H
+#define SIM_SERVICE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "match.h"
+#include "ratings.h"
+#include "job_queue.h"
+
+// Plays the World Cup fixtures the user is not in on the worker pool. Each whole match takes
+// microseconds, so everything is computed as soon as the tournament starts; what the GUI sees
+// is revealed over by over at a watchable pace once the fixture's match day opens, and a day
+// can be closed at any time without waiting for anything.
+
+#define SIM_TICKER_SECONDS_PER_OVER 8.0 // A 100 over match takes about 13 minutes to play out
+
+typedef enum {
+    SIM_FIXTURE_NOT_SIMULATED,  // Not a background fixture (the user plays it) or no service running
+    SIM_FIXTURE_SCHEDULED,      // Its match day has not opened yet
+    SIM_FIXTURE_LIVE,
+    SIM_FIXTURE_FINISHED
+} SimFixtureStatus;
+
+// What the GUI may show of a fixture right now
+typedef struct {
+    SimFixtureStatus status;
+    int batting_first;          // 0 if teamA batted first, 1 if teamB did
+    int innings;                // Innings being shown, 0 or 1
+    int runs[2];                // Per innings, so runs[0] belongs to the side batting first
+    int wickets[2];
+    int balls[2];
+    int winner;                 // 0 = teamA, 1 = teamB, -1 = tie; only once finished
+} SimFixtureView;
+
+// Copies the teams of every fixture with background[i] set and queues their matches on `pool`.
+// Any running service is stopped first. The fixtures array is not kept. With `ratings`, each
+// fixture's deliveries and result are rated into it by sim_service_update when it is reported,
+// in the order the results are shown; the workers never touch it.
+void sim_service_start(JobQueue *pool, const Match *fixtures, const bool *background, int count, uint32_t seed, Ratings *ratings);
+void sim_service_stop(void); // Waits for the queued matches, then frees everything
+bool sim_service_active(void);
+
+// Fixtures first..last-1 go live now; fixtures opened earlier are finished instantly
+void sim_service_open_day(int first, int last);
+void sim_service_finish_day(void); // Reveals every opened fixture to the end
+bool sim_service_day_finished(void);
+void sim_service_day_range(int *first, int *last); // Fixtures of the open day, first..last-1
+
+// Call once per frame. Returns true when a fixture finished since the last call (and, with
+// ratings, changed them).
+bool sim_service_update(double now);
+
+bool sim_service_view(int fixture, SimFixtureView *view); // false for fixtures it does not simulate
+// One ticker line, e.g. "IND 187/4 (32.3) v AUS" or "AUS beat IND by 23 runs", using the team tags
+void sim_service_describe(int fixture, char *buffer, size_t size);
+
+#endif // SIM_SERVICE_H
@@ -0,0 +1,88 @@
+#include "sim_study.h"
+#include "sim_engine.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define Z_95 1.959964
+#define DEFAULT_MIN_REPLICATES 30
+#define DEFAULT_BATCH 256
+
+typedef struct {
+    const SimStudyConfig *config;
+    SimStudyFunc play;
+    void *ctx;
+    long replicate;
+    double value[2];            // Per scenario, averaged over the antithetic pair
+} Observation;
+
+static void observe_job(void *arg) {
+    Observation *obs = (Observation*)arg;
+    const SimStudyConfig *config = obs->config;
+    int mirrors = config->antithetic ? 2 : 1;
+    for (int s = 0; s < config->num_scenarios; s++) {
+        uint64_t key = sim_stream_key(config->seed, config->common_random_numbers ? 0 : (uint32_t)s, (uint32_t)obs->replicate);
+        double sum = 0.0;
+        for (int m = 0; m < mirrors; m++) sum += obs->play(obs->ctx, s, key, m == 1);
+        obs->value[s] = sum / mirrors;
+    }
+}
+
+// Running mean and sum of squared deviations (Welford), added to in replicate order
+typedef struct {
+    long n;
+    double mean, m2;
+} Moments;
+
+static void moments_add(Moments *m, double x) {
+    m->n++;
+    double delta = x - m->mean;
+    m->mean += delta / m->n;
+    m->m2 += delta * (x - m->mean);
+}
+
+static double moments_std_dev(const Moments *m) {
+    return m->n > 1 ? sqrt(m->m2 / (m->n - 1)) : 0.0;
+}
+
+void sim_study_run(JobQueue *pool, const SimStudyConfig *config, SimStudyFunc play, void *ctx, SimStudyResult *result) {
+    SimStudyConfig c = *config;
+    if (c.num_scenarios < 1) c.num_scenarios = 1;
+    if (c.num_scenarios > 2) c.num_scenarios = 2;
+    if (c.min_replicates <= 1) c.min_replicates = DEFAULT_MIN_REPLICATES;
+    if (c.max_replicates < c.min_replicates) c.max_replicates = c.min_replicates;
+    if (c.batch <= 0) c.batch = DEFAULT_BATCH;
+
+    memset(result, 0, sizeof(*result));
+    Observation *batch = malloc((size_t)c.batch * sizeof(Observation));
+    if (!batch) return;
+
+    // The interval is only looked at between batches, so when it stops does not depend on timing
+    Moments scenario[2] = { 0 }, estimate = { 0 };
+    while (estimate.n < c.max_replicates) {
+        long count = c.max_replicates - estimate.n;
+        if (count > c.batch) count = c.batch;
+        for (long i = 0; i < count; i++) {
+            batch[i] = (Observation){ .config = &c, .play = play, .ctx = ctx, .replicate = estimate.n + i };
+            job_queue_push(pool, observe_job, &batch[i]);
+        }
+        if (pool) job_queue_wait(pool);
+
+        for (long i = 0; i < count; i++) {
+            for (int s = 0; s < c.num_scenarios; s++) moments_add(&scenario[s], batch[i].value[s]);
+            moments_add(&estimate, c.num_scenarios == 2 ? batch[i].value[1] - batch[i].value[0] : batch[i].value[0]);
+        }
+        result->half_width = Z_95 * moments_std_dev(&estimate) / sqrt((double)estimate.n);
+        if (c.half_width > 0 && estimate.n >= c.min_replicates && result->half_width <= c.half_width) {
+            result->converged = true;
+            break;
+        }
+    }
+    free(batch);
+
+    for (int s = 0; s < c.num_scenarios; s++) result->mean[s] = scenario[s].mean;
+    result->estimate = estimate.mean;
+    result->std_dev = moments_std_dev(&estimate);
+    result->replicates = estimate.n;
+    result->matches = estimate.n * c.num_scenarios * (c.antithetic ? 2 : 1);
+}
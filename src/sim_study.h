@@ -0,0 +1,47 @@
+#ifndef SIM_STUDY_H
+#define SIM_STUDY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "job_queue.h"
+
+// What-if studies: the mean of some measure over many simulated matches, or the difference
+// between two scenarios (batting order A against B, say), played until its 95% confidence
+// interval is as narrow as asked for.
+//
+// Replicate r of every scenario is played on the stream sim_stream_key(seed, 0, r), so the two
+// arms see the same luck ball for ball and only the change being studied separates them
+// (common random numbers). With antithetic set, every replicate is also played on the mirrored
+// stream and the pair counts as one observation. Both usually cut the matches needed for the
+// same interval by an order of magnitude; the result says how many were played.
+
+// Plays one match of `scenario` on the given stream and returns the measured value
+// (runs, 1 for a win, ...). Called from the worker threads, so it must not share state.
+typedef double (*SimStudyFunc)(void *ctx, int scenario, uint64_t key, bool antithetic);
+
+typedef struct {
+    int num_scenarios;          // 1 estimates the mean of scenario 0, 2 estimates scenario 1 - scenario 0
+    uint32_t seed;
+    bool common_random_numbers; // false plays every scenario on its own streams, for comparison
+    bool antithetic;
+    double half_width;          // Stop once the interval is within +/- this; 0 plays max_replicates
+    long min_replicates;        // Observations before the interval is trusted (default 30)
+    long max_replicates;        // Observations at most
+    long batch;                 // Observations between two looks at the interval (default 256)
+} SimStudyConfig;
+
+typedef struct {
+    double mean[2];             // Of each scenario
+    double estimate;            // mean[0], or mean[1] - mean[0]
+    double half_width;          // Of the 95% interval around estimate
+    double std_dev;             // Of one observation
+    long replicates;            // Observations, each one or (antithetic) two matches per scenario
+    long matches;               // Simulated in total
+    bool converged;             // Reached half_width before max_replicates
+} SimStudyResult;
+
+// Blocks until the study is done, running its matches on `pool` (NULL plays them right here).
+// The answer does not depend on the number of workers.
+void sim_study_run(JobQueue *pool, const SimStudyConfig *config, SimStudyFunc play, void *ctx, SimStudyResult *result);
+
+#endif // SIM_STUDY_H
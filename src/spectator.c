@@ -0,0 +1,402 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // getaddrinfo
+#endif
+#include "spectator.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef SOCKET NetSocket;
+#define NET_INVALID INVALID_SOCKET
+#define net_close closesocket
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+typedef int NetSocket;
+#define NET_INVALID (-1)
+#define net_close close
+#endif
+
+#define SPECTATOR_PROTOCOL_VERSION 1
+#define MSG_SNAPSHOT 1          // u8 version, then the packed state
+#define MSG_DELTA 2             // replica_delta_encode() runs against the previous state
+#define MAX_PENDING (64 * 1024) // A viewer this far behind is dropped; it reconnects for a fresh snapshot
+#define RETRY_SECONDS 2.0
+
+// --- Sockets ---
+
+static bool net_start(void) {
+#ifdef _WIN32
+    static bool started = false;
+    if (!started) {
+        WSADATA wsa;
+        if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) return false;
+        started = true;
+    }
+#endif
+    return true;
+}
+
+static bool net_would_block(void) {
+#ifdef _WIN32
+    int e = WSAGetLastError();
+    return e == WSAEWOULDBLOCK || e == WSAEINPROGRESS;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINPROGRESS || errno == EINTR;
+#endif
+}
+
+static void net_setup(NetSocket s) {
+#ifdef _WIN32
+    u_long on = 1;
+    ioctlsocket(s, FIONBIO, &on);
+#else
+    fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+#endif
+    int nodelay = 1; // Updates are tiny and latency is what a viewer notices
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char*)&nodelay, sizeof(nodelay));
+}
+
+static int net_send(NetSocket s, const uint8_t *data, size_t len) {
+#ifdef MSG_NOSIGNAL
+    return (int)send(s, (const char*)data, len, MSG_NOSIGNAL);
+#else
+    return (int)send(s, (const char*)data, (int)len, 0);
+#endif
+}
+
+static int net_recv(NetSocket s, uint8_t *data, size_t len) {
+    return (int)recv(s, (char*)data, (int)len, 0);
+}
+
+// --- Host ---
+
+typedef struct {
+    NetSocket sock;
+    uint8_t *out;
+    size_t len;
+    size_t cap;
+    bool needs_snapshot;
+} Viewer;
+
+struct SpectatorHost {
+    NetSocket listener;
+    Viewer viewers[SPECTATOR_MAX_VIEWERS];
+    int num_viewers;
+    uint8_t last[REPLICA_PACKED_SIZE];  // What every live viewer has been brought up to
+    bool have_last;
+    double last_send;
+    uint64_t bytes_sent;
+};
+
+SpectatorHost* spectator_host_start(int port) {
+    if (!net_start()) return NULL;
+    NetSocket s = socket(AF_INET, SOCK_STREAM, 0);
+    if (s == NET_INVALID) return NULL;
+
+    int reuse = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((unsigned short)port);
+    if (bind(s, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(s, SPECTATOR_MAX_VIEWERS) != 0) {
+        net_close(s);
+        return NULL;
+    }
+    net_setup(s);
+
+    SpectatorHost *host = calloc(1, sizeof(SpectatorHost));
+    if (!host) {
+        net_close(s);
+        return NULL;
+    }
+    host->listener = s;
+    return host;
+}
+
+static void queue_frame(Viewer *v, uint8_t type, const uint8_t *payload, int size) {
+    if (v->len + 3 + size > v->cap) {
+        size_t cap = v->cap ? v->cap * 2 : 1024;
+        while (cap < v->len + 3 + size) cap *= 2;
+        uint8_t *grown = realloc(v->out, cap);
+        if (!grown) return;
+        v->out = grown;
+        v->cap = cap;
+    }
+    v->out[v->len++] = (uint8_t)(size & 0xFF);
+    v->out[v->len++] = (uint8_t)(size >> 8);
+    v->out[v->len++] = type;
+    memcpy(v->out + v->len, payload, size);
+    v->len += size;
+}
+
+static void drop_viewer(SpectatorHost *host, int i) {
+    net_close(host->viewers[i].sock);
+    free(host->viewers[i].out);
+    host->viewers[i] = host->viewers[--host->num_viewers];
+}
+
+void spectator_host_poll(SpectatorHost *host) {
+    if (!host) return;
+
+    for (;;) {
+        NetSocket s = accept(host->listener, NULL, NULL);
+        if (s == NET_INVALID) break;
+        if (host->num_viewers == SPECTATOR_MAX_VIEWERS) {
+            net_close(s);
+            continue;
+        }
+        net_setup(s);
+        host->viewers[host->num_viewers++] = (Viewer){ .sock = s, .needs_snapshot = true };
+    }
+
+    for (int i = host->num_viewers - 1; i >= 0; i--) {
+        Viewer *v = &host->viewers[i];
+        if (v->needs_snapshot && host->have_last) {
+            uint8_t snapshot[1 + REPLICA_PACKED_SIZE];
+            snapshot[0] = SPECTATOR_PROTOCOL_VERSION;
+            memcpy(snapshot + 1, host->last, REPLICA_PACKED_SIZE);
+            queue_frame(v, MSG_SNAPSHOT, snapshot, sizeof(snapshot));
+            v->needs_snapshot = false;
+        }
+
+        size_t sent = 0;
+        while (sent < v->len) {
+            int n = net_send(v->sock, v->out + sent, v->len - sent);
+            if (n > 0) { sent += n; continue; }
+            if (n < 0 && net_would_block()) break;
+            sent = (size_t)-1; // Gone
+            break;
+        }
+        if (sent == (size_t)-1 || v->len - sent > MAX_PENDING) {
+            drop_viewer(host, i);
+            continue;
+        }
+        host->bytes_sent += sent;
+        memmove(v->out, v->out + sent, v->len - sent);
+        v->len -= sent;
+    }
+}
+
+void spectator_host_publish(SpectatorHost *host, const ReplicaState *state, double now) {
+    if (!host) return;
+    uint8_t next[REPLICA_PACKED_SIZE];
+    replica_pack(state, next);
+
+    if (!host->have_last) {
+        memcpy(host->last, next, REPLICA_PACKED_SIZE);
+        host->have_last = true;
+        host->last_send = now;
+        spectator_host_poll(host); // Snapshots for whoever is already waiting
+        return;
+    }
+
+    bool discrete_changed = memcmp(host->last, next, REPLICA_DISCRETE_SIZE) != 0;
+    if (!discrete_changed && now - host->last_send < 1.0 / REPLICA_MOTION_HZ) return;
+
+    uint8_t delta[2 * REPLICA_PACKED_SIZE];
+    int size = replica_delta_encode(host->last, next, delta);
+    if (size == 0) return;
+    for (int i = 0; i < host->num_viewers; i++) {
+        if (!host->viewers[i].needs_snapshot) queue_frame(&host->viewers[i], MSG_DELTA, delta, size);
+    }
+    memcpy(host->last, next, REPLICA_PACKED_SIZE);
+    host->last_send = now;
+    spectator_host_poll(host);
+}
+
+int spectator_host_viewers(const SpectatorHost *host) {
+    return host ? host->num_viewers : 0;
+}
+
+uint64_t spectator_host_bytes_sent(const SpectatorHost *host) {
+    return host ? host->bytes_sent : 0;
+}
+
+void spectator_host_stop(SpectatorHost *host) {
+    if (!host) return;
+    while (host->num_viewers > 0) drop_viewer(host, host->num_viewers - 1);
+    net_close(host->listener);
+    free(host);
+}
+
+// --- Viewer ---
+
+struct SpectatorViewer {
+    char address[128];
+    int port;
+    NetSocket sock;
+    bool connected;             // TCP is up; status turns LIVE with the first snapshot
+    SpectatorStatus status;
+    double retry_at;
+
+    uint8_t in[4096];
+    size_t len;
+    uint8_t packed[REPLICA_PACKED_SIZE];
+    ReplicaState prev, cur;     // The last two updates, for interpolation
+    double cur_time;
+    bool have_state;
+    uint64_t bytes;
+};
+
+static void viewer_disconnect(SpectatorViewer *v, double now) {
+    if (v->sock != NET_INVALID) net_close(v->sock);
+    v->sock = NET_INVALID;
+    v->connected = false;
+    v->len = 0;
+    v->status = SPECTATOR_DISCONNECTED;
+    v->retry_at = now + RETRY_SECONDS;
+}
+
+static void viewer_connect(SpectatorViewer *v, double now) {
+    char port[16];
+    snprintf(port, sizeof(port), "%d", v->port);
+    struct addrinfo hints, *found = NULL;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(v->address, port, &hints, &found) != 0 || !found) {
+        viewer_disconnect(v, now);
+        return;
+    }
+
+    v->sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (v->sock == NET_INVALID) {
+        freeaddrinfo(found);
+        viewer_disconnect(v, now);
+        return;
+    }
+    net_setup(v->sock);
+    int r = connect(v->sock, found->ai_addr, (int)found->ai_addrlen);
+    freeaddrinfo(found);
+    if (r != 0 && !net_would_block()) {
+        viewer_disconnect(v, now);
+        return;
+    }
+    v->connected = (r == 0);
+    v->status = SPECTATOR_CONNECTING;
+}
+
+SpectatorViewer* spectator_viewer_create(const char *address, int port) {
+    if (!net_start()) return NULL;
+    SpectatorViewer *v = calloc(1, sizeof(SpectatorViewer));
+    if (!v) return NULL;
+    strncpy(v->address, address, sizeof(v->address) - 1);
+    v->port = port;
+    v->sock = NET_INVALID;
+    v->status = SPECTATOR_DISCONNECTED;
+    return v;
+}
+
+// Finishes a non-blocking connect; false while it is still going
+static bool viewer_check_connect(SpectatorViewer *v, double now) {
+    fd_set writable, failed;
+    FD_ZERO(&writable);
+    FD_ZERO(&failed);
+    FD_SET(v->sock, &writable);
+    FD_SET(v->sock, &failed);
+    struct timeval no_wait = { 0, 0 };
+    if (select((int)v->sock + 1, NULL, &writable, &failed, &no_wait) <= 0) return false;
+
+    int error = 0;
+    socklen_t len = sizeof(error);
+    getsockopt(v->sock, SOL_SOCKET, SO_ERROR, (char*)&error, &len);
+    if (error != 0 || FD_ISSET(v->sock, &failed)) {
+        viewer_disconnect(v, now);
+        return false;
+    }
+    v->connected = true;
+    return true;
+}
+
+static bool viewer_handle_frame(SpectatorViewer *v, uint8_t type, const uint8_t *payload, int size, double now) {
+    if (type == MSG_SNAPSHOT) {
+        if (size != 1 + REPLICA_PACKED_SIZE || payload[0] != SPECTATOR_PROTOCOL_VERSION) return false;
+        memcpy(v->packed, payload + 1, REPLICA_PACKED_SIZE);
+        replica_unpack(v->packed, &v->cur);
+        v->prev = v->cur;
+        v->have_state = true;
+        v->status = SPECTATOR_LIVE;
+    } else if (type == MSG_DELTA) {
+        if (!v->have_state || !replica_delta_apply(v->packed, payload, size)) return false;
+        v->prev = v->cur;
+        replica_unpack(v->packed, &v->cur);
+    } else {
+        return false;
+    }
+    v->cur_time = now;
+    return true;
+}
+
+bool spectator_viewer_poll(SpectatorViewer *v, double now) {
+    if (!v) return false;
+    if (v->status == SPECTATOR_DISCONNECTED) {
+        if (now < v->retry_at) return false;
+        viewer_connect(v, now);
+    }
+    if (v->sock == NET_INVALID) return false;
+    if (!v->connected && !viewer_check_connect(v, now)) return false;
+
+    bool changed = false;
+    for (;;) {
+        int n = net_recv(v->sock, v->in + v->len, sizeof(v->in) - v->len);
+        if (n <= 0) {
+            if (n < 0 && net_would_block()) break;
+            viewer_disconnect(v, now); // The host went away; keep showing the last state
+            return changed;
+        }
+        v->bytes += n;
+        v->len += n;
+
+        size_t off = 0;
+        while (v->len - off >= 3) {
+            int size = v->in[off] | (v->in[off + 1] << 8);
+            if (v->len - off < 3 + (size_t)size) break;
+            if (!viewer_handle_frame(v, v->in[off + 2], v->in + off + 3, size, now)) {
+                viewer_disconnect(v, now); // Out of step, a fresh connection brings a snapshot
+                return changed;
+            }
+            changed = true;
+            off += 3 + size;
+        }
+        memmove(v->in, v->in + off, v->len - off);
+        v->len -= off;
+    }
+    return changed;
+}
+
+SpectatorStatus spectator_viewer_status(const SpectatorViewer *v) {
+    return v ? v->status : SPECTATOR_DISCONNECTED;
+}
+
+bool spectator_viewer_state(const SpectatorViewer *v, double now, ReplicaState *out) {
+    if (!v || !v->have_state) return false;
+    // Show the previous update and glide to the latest over one update interval. A new phase
+    // is a cut (the ball jumps back to the bowler), so it is not smoothed.
+    float t = (float)((now - v->cur_time) * REPLICA_MOTION_HZ);
+    if (t > 1.0f || v->prev.phase != v->cur.phase) t = 1.0f;
+    if (t < 0.0f) t = 0.0f;
+    replica_lerp(&v->prev, &v->cur, t, out);
+    return true;
+}
+
+uint64_t spectator_viewer_bytes_received(const SpectatorViewer *v) {
+    return v ? v->bytes : 0;
+}
+
+void spectator_viewer_destroy(SpectatorViewer *v) {
+    if (!v) return;
+    if (v->sock != NET_INVALID) net_close(v->sock);
+    free(v);
+}
@@ -0,0 +1,51 @@
+#ifndef SPECTATOR_H
+#define SPECTATOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "replica.h"
+
+// Mirrors the gameplay screen to other machines over TCP. The host publishes a ReplicaState
+// every frame; each viewer gets a snapshot when it connects and then only the deltas, at most
+// REPLICA_MOTION_HZ times a second while things move and straight away when the score, phase or
+// a message changes. Viewers simulate nothing, they draw what they are sent.
+//
+// Every message is a frame: u16 payload length, u8 type, then the payload.
+// Kept free of platform headers so it can sit next to raylib.h (windows.h clashes with it).
+
+#define SPECTATOR_DEFAULT_PORT 7777
+#define SPECTATOR_MAX_VIEWERS 16
+
+// --- Host ---
+
+typedef struct SpectatorHost SpectatorHost;
+
+SpectatorHost* spectator_host_start(int port); // NULL if the port cannot be opened
+// Accepts viewers and sends what they have not had yet; call once a frame on any screen
+void spectator_host_poll(SpectatorHost *host);
+void spectator_host_publish(SpectatorHost *host, const ReplicaState *state, double now);
+int spectator_host_viewers(const SpectatorHost *host);
+uint64_t spectator_host_bytes_sent(const SpectatorHost *host);
+void spectator_host_stop(SpectatorHost *host);
+
+// --- Viewer ---
+
+typedef enum {
+    SPECTATOR_CONNECTING,
+    SPECTATOR_LIVE,             // Snapshot received, following deltas
+    SPECTATOR_DISCONNECTED      // Retried automatically
+} SpectatorStatus;
+
+typedef struct SpectatorViewer SpectatorViewer;
+
+SpectatorViewer* spectator_viewer_create(const char *address, int port);
+// Reads what has arrived; true if the state moved on. Reconnects after a drop.
+bool spectator_viewer_poll(SpectatorViewer *viewer, double now);
+SpectatorStatus spectator_viewer_status(const SpectatorViewer *viewer);
+// The state to draw at `now`: positions glide between the last two updates, everything else
+// is the latest. False until the first snapshot has arrived.
+bool spectator_viewer_state(const SpectatorViewer *viewer, double now, ReplicaState *out);
+uint64_t spectator_viewer_bytes_received(const SpectatorViewer *viewer);
+void spectator_viewer_destroy(SpectatorViewer *viewer);
+
+#endif // SPECTATOR_H
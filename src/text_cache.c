@@ -0,0 +1,184 @@
+#include "text_cache.h"
+#include "gfx.h"
+#include <string.h>
+
+typedef struct {
+    char text[TEXT_CACHE_MAX_LEN];
+    unsigned int hash;
+    int font_size;
+    TextStyle style;
+    int width;
+    int first_glyph;        // Into glyph_pool
+    int num_glyphs;
+    bool used;
+} TextEntry;
+
+static TextEntry entries[TEXT_CACHE_ENTRIES];
+static GfxGlyph glyph_pool[TEXT_CACHE_GLYPHS];
+static int num_entries = 0;
+static int num_pool_glyphs = 0;
+static unsigned int generation = 1; // Bumped on every clear so TextSlots drop stale entry indices
+
+static unsigned int hash_key(const char *text, int font_size, TextStyle style) {
+    unsigned int hash = 2166136261u;
+    for (const char *c = text; *c; c++) hash = (hash ^ (unsigned char)*c) * 16777619u;
+    hash = (hash ^ (unsigned int)font_size) * 16777619u;
+    hash = (hash ^ (unsigned int)style) * 16777619u;
+    return hash;
+}
+
+void text_cache_clear(void) {
+    memset(entries, 0, sizeof(entries));
+    num_entries = 0;
+    num_pool_glyphs = 0;
+    generation++;
+}
+
+// Same layout DrawText/DrawTextEx produce for the default font
+static void layout_entry(TextEntry *entry) {
+    Font font = GetFontDefault();
+    int font_size = entry->font_size < 10 ? 10 : entry->font_size; // DrawText's minimum
+    float scale = (float)font_size / font.baseSize;
+    float spacing = (float)(font_size / 10);
+    float pad = (float)font.glyphPadding;
+
+    entry->width = MeasureText(entry->text, entry->font_size);
+    entry->first_glyph = num_pool_glyphs;
+    entry->num_glyphs = 0;
+
+    int passes = (entry->style == TEXT_STYLE_BOLD) ? 2 : 1;
+    for (int pass = 0; pass < passes; pass++) {
+        // Bold draws the offset copy first, like the old DrawTextBold did
+        float shift = (passes == 2 && pass == 0) ? 1.0f : 0.0f;
+        float offset_x = 0.0f, offset_y = 0.0f;
+        int length = (int)strlen(entry->text);
+
+        for (int i = 0; i < length;) {
+            int codepoint_size = 0;
+            int codepoint = GetCodepointNext(&entry->text[i], &codepoint_size);
+            int index = GetGlyphIndex(font, codepoint);
+            i += codepoint_size;
+
+            if (codepoint == '\n') {
+                offset_y += 15.0f; // raylib's default line spacing (SetTextLineSpacing is never called)
+                offset_x = 0.0f;
+                continue;
+            }
+
+            if (codepoint != ' ' && codepoint != '\t' && num_pool_glyphs < TEXT_CACHE_GLYPHS) {
+                Rectangle rec = font.recs[index];
+                GfxGlyph *glyph = &glyph_pool[num_pool_glyphs++];
+                glyph->source = (Rectangle){ rec.x - pad, rec.y - pad, rec.width + 2*pad, rec.height + 2*pad };
+                glyph->dest = (Rectangle){
+                    shift + offset_x + font.glyphs[index].offsetX*scale - pad*scale,
+                    shift + offset_y + font.glyphs[index].offsetY*scale - pad*scale,
+                    (rec.width + 2*pad)*scale,
+                    (rec.height + 2*pad)*scale
+                };
+                entry->num_glyphs++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) offset_x += font.recs[index].width*scale + spacing;
+            else offset_x += font.glyphs[index].advanceX*scale + spacing;
+        }
+    }
+}
+
+// Returns the index of the cached layout, creating it on a miss. -1 if the text cannot be cached.
+static int find_entry(const char *text, int font_size, TextStyle style) {
+    size_t length = strlen(text);
+    if (length >= TEXT_CACHE_MAX_LEN) return -1;
+
+    unsigned int hash = hash_key(text, font_size, style);
+    unsigned int i = hash & (TEXT_CACHE_ENTRIES - 1);
+    for (; entries[i].used; i = (i + 1) & (TEXT_CACHE_ENTRIES - 1)) {
+        const TextEntry *entry = &entries[i];
+        if (entry->hash == hash && entry->font_size == font_size && entry->style == style && strcmp(entry->text, text) == 0) {
+            return (int)i;
+        }
+    }
+
+    // Clear rather than evict one by one: the screens redraw the same few strings every frame,
+    // so the working set is rebuilt within a frame
+    if (num_entries >= TEXT_CACHE_ENTRIES*3/4 || num_pool_glyphs + 2*(int)length > TEXT_CACHE_GLYPHS) {
+        text_cache_clear();
+        i = hash & (TEXT_CACHE_ENTRIES - 1);
+    }
+
+    TextEntry *entry = &entries[i];
+    memcpy(entry->text, text, length + 1);
+    entry->hash = hash;
+    entry->font_size = font_size;
+    entry->style = style;
+    entry->used = true;
+    layout_entry(entry);
+    num_entries++;
+    return (int)i;
+}
+
+static void draw_entry(const TextEntry *entry, int x, int y, Color color) {
+    GfxDrawGlyphs(GetFontDefault().texture, &glyph_pool[entry->first_glyph], entry->num_glyphs, (Vector2){ (float)x, (float)y }, color);
+}
+
+int text_cache_measure(const char *text, int font_size) {
+    if (text == NULL || text[0] == '\0') return 0;
+    int index = find_entry(text, font_size, TEXT_STYLE_PLAIN);
+    return (index >= 0) ? entries[index].width : MeasureText(text, font_size);
+}
+
+void text_cache_draw(const char *text, int x, int y, int font_size, TextStyle style, Color color) {
+    if (text == NULL || text[0] == '\0') return;
+    int index = find_entry(text, font_size, style);
+    if (index >= 0) {
+        draw_entry(&entries[index], x, y, color);
+    } else {
+        if (style == TEXT_STYLE_BOLD) GfxDrawText(text, x + 1, y + 1, font_size, color);
+        GfxDrawText(text, x, y, font_size, color);
+    }
+}
+
+bool text_slot_changed(TextSlot *slot, const void *owner, long long a, long long b, long long c) {
+    if (slot->valid && slot->owner == owner && slot->keys[0] == a && slot->keys[1] == b && slot->keys[2] == c) {
+        return false;
+    }
+    slot->owner = owner;
+    slot->keys[0] = a;
+    slot->keys[1] = b;
+    slot->keys[2] = c;
+    slot->valid = true;
+    slot->entry_generation = 0; // Re-layout on the next draw
+    return true;
+}
+
+void text_slot_set(TextSlot *slot, const char *text) {
+    if (slot->valid && strcmp(slot->text, text) == 0) return;
+    strncpy(slot->text, text, TEXT_CACHE_MAX_LEN - 1);
+    slot->text[TEXT_CACHE_MAX_LEN - 1] = '\0';
+    slot->valid = true;
+    slot->entry_generation = 0;
+}
+
+// The slot remembers its entry, so an unchanged slot skips even the hash lookup
+static int slot_entry(TextSlot *slot, int font_size, TextStyle style) {
+    if (slot->entry_generation == generation && slot->entry_size == font_size && slot->entry_style == style) {
+        return slot->entry;
+    }
+    slot->entry = find_entry(slot->text, font_size, style);
+    slot->entry_size = font_size;
+    slot->entry_style = style;
+    slot->entry_generation = generation;
+    return slot->entry;
+}
+
+int text_slot_measure(TextSlot *slot, int font_size) {
+    if (slot->text[0] == '\0') return 0;
+    int index = slot_entry(slot, font_size, TEXT_STYLE_PLAIN);
+    return (index >= 0) ? entries[index].width : MeasureText(slot->text, font_size);
+}
+
+void text_slot_draw(TextSlot *slot, int x, int y, int font_size, TextStyle style, Color color) {
+    if (slot->text[0] == '\0') return;
+    int index = slot_entry(slot, font_size, style);
+    if (index >= 0) draw_entry(&entries[index], x, y, color);
+    else text_cache_draw(slot->text, x, y, font_size, style, color);
+}
@@ -0,0 +1,48 @@
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define TEXT_CACHE_MAX_LEN 128      // Longer strings bypass the cache
+#define TEXT_CACHE_ENTRIES 512      // Power of two
+#define TEXT_CACHE_GLYPHS 16384     // Shared pool for all cached glyph runs
+#define TEXT_SLOT_KEYS 3
+
+typedef enum {
+    TEXT_STYLE_PLAIN,
+    TEXT_STYLE_BOLD     // Drawn over a copy offset by one pixel
+} TextStyle;
+
+// Layout cache for the default font keyed by (string, size, style). Each entry keeps the
+// measured width and the glyph run (source and destination quads), so drawing a cached
+// string only submits quads. When the cache fills up it is cleared and refilled.
+int text_cache_measure(const char *text, int font_size);    // Same result as MeasureText
+void text_cache_draw(const char *text, int x, int y, int font_size, TextStyle style, Color color);
+
+// A formatted string that is only re-formatted and re-laid out when the values it shows
+// change. Typical use:
+//     static TextSlot slot;
+//     if (text_slot_changed(&slot, player, player->total_runs, player->balls_faced, 0))
+//         snprintf(slot.text, sizeof(slot.text), "%s  %d(%d)", player->name, player->total_runs, player->balls_faced);
+//     text_slot_draw(&slot, x, y, 20, TEXT_STYLE_PLAIN, ICC_WHITE);
+typedef struct {
+    char text[TEXT_CACHE_MAX_LEN];
+    const void *owner;              // Whatever the text describes (a player, a team...)
+    long long keys[TEXT_SLOT_KEYS];
+    bool valid;
+    int entry;                      // Cached layout for text at the last size/style drawn
+    int entry_size;
+    TextStyle entry_style;
+    unsigned int entry_generation;
+} TextSlot;
+
+// True (and remembers the new values) if owner or any value differs from the last call
+bool text_slot_changed(TextSlot *slot, const void *owner, long long a, long long b, long long c);
+void text_slot_set(TextSlot *slot, const char *text); // Static text, no values
+int text_slot_measure(TextSlot *slot, int font_size);
+void text_slot_draw(TextSlot *slot, int x, int y, int font_size, TextStyle style, Color color);
+
+void text_cache_clear(void);
+
+#endif // TEXT_CACHE_H
@@ -8,6 +8,9 @@
 #include "ui.h"
 #include "grounds.h"
 #include "umpires.h"
+#include "qualification.h"
+#include "field_coverage.h"
+#include "tournament_format.h"
 
 static void run_tournament(MatchFormat format, const char* user_email);
 
@@ -137,7 +140,7 @@ void tournament_menu(const char *user_email, const char *user_name)
             clean_stdin();
 
             char summary[512] = {0};
-            simulate_match(teamA, teamB, fmt, autoplay, rain, umpire_names, selected_ground->name, summary, sizeof(summary));
+            simulate_match(teamA, teamB, fmt, autoplay, rain, umpire_names, selected_ground->name, summary, sizeof(summary), NULL);
             printf("\nMatch result:\n%s\n", summary);
             append_user_history(user_email, summary);
             free(teams);
@@ -155,6 +158,32 @@ void tournament_menu(const char *user_email, const char *user_name)
     }
 }
 
+static Tournament* new_tournament(const char *name, MatchFormat format) {
+    Tournament *t = calloc(1, sizeof(Tournament));
+    if (!t) return NULL;
+    snprintf(t->name, sizeof(t->name), "%s", name);
+    t->format = format;
+    return t;
+}
+
+static void free_tournament(Tournament *t) {
+    if (!t) return;
+    free(t->fixtures);
+    free(t);
+}
+
+static bool add_fixture(Tournament *t, int team_a, int team_b) {
+    if (t->num_fixtures == t->fixture_capacity) {
+        int capacity = t->fixture_capacity ? t->fixture_capacity * 2 : 16;
+        TournamentFixture *grown = realloc(t->fixtures, capacity * sizeof(TournamentFixture));
+        if (!grown) return false;
+        t->fixtures = grown;
+        t->fixture_capacity = capacity;
+    }
+    t->fixtures[t->num_fixtures++] = (TournamentFixture){ .team_a = (uint8_t)team_a, .team_b = (uint8_t)team_b, .winner = TOURNAMENT_PENDING };
+    return true;
+}
+
 static void create_tournament(Tournament *t, Team *all_teams, int num_all_teams) {
     printf("\n--- Create Tournament ---\n");
     printf("Available teams:\n");
@@ -162,8 +191,9 @@ static void create_tournament(Tournament *t, Team *all_teams, int num_all_teams)
         printf("%d) %s\n", i + 1, all_teams[i].name);
     }
 
+    int max_teams = num_all_teams < MAX_TEAMS_IN_TOURNAMENT ? num_all_teams : MAX_TEAMS_IN_TOURNAMENT;
     printf("Enter number of teams for the tournament: ");
-    if (scanf("%d", &t->num_teams) != 1 || t->num_teams < 2 || t->num_teams > num_all_teams) {
+    if (scanf("%d", &t->num_teams) != 1 || t->num_teams < 2 || t->num_teams > max_teams) {
         printf("Invalid number of teams.\n");
         t->num_teams = 0;
         clean_stdin();
@@ -181,47 +211,149 @@ static void create_tournament(Tournament *t, Team *all_teams, int num_all_teams)
             continue;
         }
         clean_stdin();
-        t->teams[i] = all_teams[team_idx - 1];
+        t->teams[i] = &all_teams[team_idx - 1];
     }
 
-    // Initialize points table
-    for (int i = 0; i < t->num_teams; i++) {
-        t->points_table[i].team = &t->teams[i];
-        t->points_table[i].played = 0;
-        t->points_table[i].wins = 0;
-        t->points_table[i].losses = 0;
-        t->points_table[i].draws = 0;
-        t->points_table[i].points = 0;
-    }
-    t->num_matches = 0;
+    points_table_init(&t->points_table, NULL, t->num_teams);
+    for (int i = 0; i < t->num_teams; i++) t->points_table.entries[i].team = t->teams[i];
+    t->num_fixtures = 0;
 }
 
-static void generate_fixtures(Tournament *t) {
-    if (t->num_teams < 2) return;
-
-    t->num_matches = 0;
+// Every team plays every other once, however many that is
+static bool generate_fixtures(Tournament *t) {
+    t->num_fixtures = 0;
     for (int i = 0; i < t->num_teams; i++) {
         for (int j = i + 1; j < t->num_teams; j++) {
-            if (t->num_matches < MAX_MATCHES_IN_TOURNAMENT) {
-                Match *m = &t->matches[t->num_matches++];
-                m->teamA = &t->teams[i];
-                m->teamB = &t->teams[j];
-                m->format = t->format;
-            }
+            if (!add_fixture(t, i, j)) return false;
         }
     }
+    return true;
+}
+
+// Written from the stored result, so no summary text is kept per fixture
+static void fixture_summary(const Tournament *t, const TournamentFixture *f, char *out, size_t out_sz) {
+    const char *names[2] = { t->teams[f->team_a]->name, t->teams[f->team_b]->name };
+    if (f->winner == TOURNAMENT_PENDING) snprintf(out, out_sz, "%s vs %s: yet to be played", names[0], names[1]);
+    else if (f->winner < 0) snprintf(out, out_sz, "Match Drawn: %s %d - %s %d", names[0], f->runs[0], names[1], f->runs[1]);
+    else {
+        int w = f->winner, l = 1 - w;
+        snprintf(out, out_sz, "%s beat %s. Score %d/%d vs %d/%d", names[w], names[l], f->runs[w], f->wickets[w], f->runs[l], f->wickets[l]);
+    }
 }
 
 static void display_points_table(const Tournament *t) {
+    int order[MAX_TEAMS_IN_TOURNAMENT];
+    int n = points_table_standings(&t->points_table, order);
     printf("\n--- Points Table: %s ---\n", t->name);
-    printf("%-20s | P | W | L | D | Pts\n", "Team");
-    printf("------------------------------------------------\n");
+    printf("%-20s | P | W | L | D | Pts | NRR\n", "Team");
+    printf("--------------------------------------------------------\n");
+    for (int i = 0; i < n; i++) {
+        const PointsTableEntry *entry = &t->points_table.entries[order[i]];
+        printf("%-20s | %d | %d | %d | %d | %3d | %+.3f\n",
+               entry->team->name, entry->played, entry->wins, entry->losses, entry->draws, entry->points, points_table_nrr(entry));
+    }
+    printf("--------------------------------------------------------\n");
+}
+
+// Plays the rest of the round-robin QUAL_DEFAULT_RUNS times over and prints each team's odds
+static void display_qualification_odds(const Tournament *t, JobQueue *pool) {
+    QualFixture *fixtures = malloc(t->num_fixtures * sizeof(QualFixture));
+    Team *teams = malloc(t->num_teams * sizeof(Team)); // The engine takes the teams side by side
+    if (!fixtures || !teams) {
+        free(fixtures);
+        free(teams);
+        return;
+    }
+    for (int i = 0; i < t->num_teams; i++) teams[i] = *t->teams[i];
+    for (int i = 0; i < t->num_fixtures; i++) {
+        const TournamentFixture *f = &t->fixtures[i];
+        fixtures[i] = (QualFixture){ .team_a = f->team_a, .team_b = f->team_b,
+                                     .winner = f->winner == TOURNAMENT_PENDING ? QUAL_PENDING : f->winner,
+                                     .runs = { f->runs[0], f->runs[1] }, .balls = { f->balls[0], f->balls[1] } };
+    }
+    int overs = t->format == FORMAT_T20 ? 20 : 50; // The engine plays limited overs only
+    int qualify_places = t->num_teams > 4 ? 4 : 2;
+
+    qualification_start(pool, teams, t->num_teams, fixtures, t->num_fixtures, overs, qualify_places, QUAL_DEFAULT_RUNS, (uint32_t)rand());
+    job_queue_wait(pool);
+    free(fixtures);
+    free(teams);
+
+    printf("\n--- Odds from %d simulated tournaments ---\n", qualification_runs());
+    printf("%-20s | Top %d          | Semi-final     | Title\n", "Team", qualify_places);
+    printf("------------------------------------------------------------------------\n");
     for (int i = 0; i < t->num_teams; i++) {
-        const PointsTableEntry *entry = &t->points_table[i];
-        printf("%-20s | %d | %d | %d | %d | %d\n",
-               entry->team->name, entry->played, entry->wins, entry->losses, entry->draws, entry->points);
+        QualOdds odds;
+        if (!qualification_odds(i, &odds)) continue;
+        const QualEstimate *est[] = { &odds.qualify, &odds.semi_final, &odds.title };
+        printf("%-20s", t->teams[i]->name);
+        for (int c = 0; c < 3; c++) printf(" | %5.1f%% +/-%4.1f", est[c]->p * 100, (est[c]->high - est[c]->low) * 50);
+        printf("\n");
+    }
+    printf("------------------------------------------------------------------------\n");
+    qualification_stop();
+}
+
+static void display_group_tables(const FormatPlan *plan) {
+    for (int g = 0; g < plan->num_groups; g++) {
+        const FormatGroup *group = &plan->groups[g];
+        int order[FORMAT_MAX_GROUP];
+        int n = points_table_standings(&group->table, order);
+        printf("\n--- Stage %d, Group %c ---\n", group->stage + 1, 'A' + g);
+        for (int i = 0; i < n; i++) {
+            const PointsTableEntry *entry = &group->table.entries[order[i]];
+            printf("%-20s | P %d | W %d | Pts %2d | NRR %+.3f\n", entry->team ? entry->team->name : "(to be decided)",
+                   entry->played, entry->wins, entry->points, points_table_nrr(entry));
+        }
+    }
+}
+
+// Groups and knockouts are played headless, a day at a time, every match of a day at once
+static void play_format_tournament(Tournament *t, FormatPreset preset, JobQueue *pool, const char *user_email) {
+    FormatSpec spec = format_preset(preset, t->num_teams);
+    FormatPlan *plan = format_plan_create(&spec, t->teams, t->num_teams);
+    if (!plan) {
+        printf("That format needs more teams.\n");
+        return;
+    }
+    int num_grounds = 0;
+    Ground *grounds = load_grounds(&num_grounds);
+    FormatScheduleRules rules = { .min_rest_days = 1, .ground_rest_days = 1, .stage_break_days = 1 };
+    if (!format_schedule(plan, grounds, num_grounds, &rules)) {
+        printf("Could not fit the matches into a schedule.\n");
+        free(grounds);
+        format_plan_destroy(plan);
+        return;
+    }
+    printf("%d matches over %d days.\n", plan->num_matches, plan->num_days);
+
+    int overs = t->format == FORMAT_T20 ? 20 : 50; // The engine plays limited overs only
+    int *today = malloc(plan->num_matches * sizeof(int));
+    uint32_t seed = (uint32_t)rand();
+    for (int day = 0; today && day < plan->num_days; day++) {
+        int n = format_matches_on_day(plan, day, today, plan->num_matches);
+        if (n == 0) continue;
+        format_play_day(plan, pool, day, overs, seed);
+        printf("\nDay %d\n", day + 1);
+        for (int i = 0; i < n; i++) {
+            const FormatMatch *m = &plan->matches[today[i]];
+            const char *venue = m->ground >= 0 ? grounds[m->ground].name : "TBD";
+            if (m->winner == FORMAT_PENDING) continue;
+            if (m->winner < 0) printf("  %s tied with %s at %s\n", plan->teams[m->team[0]]->name, plan->teams[m->team[1]]->name, venue);
+            else printf("  %s beat %s at %s\n", plan->teams[m->team[m->winner]]->name, plan->teams[m->team[1 - m->winner]]->name, venue);
+        }
+    }
+    free(today);
+    display_group_tables(plan);
+
+    if (plan->champion >= 0) {
+        char line[MAX_TEAM_NAME_LEN + sizeof(t->name) + sizeof(" won ")];
+        snprintf(line, sizeof(line), "%s won %s", plan->teams[plan->champion]->name, t->name);
+        printf("\n%s\n", line);
+        append_user_history(user_email, line);
     }
-    printf("------------------------------------------------\n");
+    free(grounds);
+    format_plan_destroy(plan);
 }
 
 static void run_tournament(MatchFormat format, const char* user_email) {
@@ -233,63 +365,81 @@ static void run_tournament(MatchFormat format, const char* user_email) {
         return;
     }
 
-    Tournament t = {0};
-    strncpy(t.name, "My Tournament", sizeof(t.name) - 1);
-    t.format = format;
+    Tournament *t = new_tournament("My Tournament", format);
+    if (!t) {
+        free(all_teams);
+        return;
+    }
 
-    create_tournament(&t, all_teams, num_all_teams);
+    create_tournament(t, all_teams, num_all_teams);
     
-    if (t.num_teams < 2) {
+    if (t->num_teams < 2 || !generate_fixtures(t)) {
+        free_tournament(t);
         free(all_teams);
         return;
     }
 
-    generate_fixtures(&t);
-    printf("Tournament created with %d teams and %d matches.\n", t.num_teams, t.num_matches);
+    int structure = 1;
+    printf("Format: 1) Round robin  2) League and semi-finals  3) Groups and knockout  4) Super eights: ");
+    if (scanf("%d", &structure) != 1 || structure < 1 || structure > 4) structure = 1;
+    clean_stdin();
+    if (structure > 1) {
+        static const FormatPreset presets[] = { FORMAT_LEAGUE_SEMIS, FORMAT_GROUPS_KNOCKOUT, FORMAT_SUPER_EIGHTS };
+        JobQueue *pool = job_queue_create(0);
+        field_coverage_init();
+        play_format_tournament(t, presets[structure - 2], pool, user_email);
+        job_queue_destroy(pool);
+        free_tournament(t);
+        free(all_teams);
+        return;
+    }
+    printf("Tournament created with %d teams and %d matches.\n", t->num_teams, t->num_fixtures);
 
     int autoplay = 1;
     printf("Enable autoplay for all matches? (1 for yes, 0 for no): ");
     if (scanf("%d", &autoplay) != 1) autoplay = 1;
     clean_stdin();
 
-    for (int i = 0; i < t.num_matches; i++) {
-        Match *m = &t.matches[i];
-        printf("\nSimulating match: %s vs %s\n", m->teamA->name, m->teamB->name);
+    JobQueue *pool = job_queue_create(0);
+    field_coverage_init(); // The odds engine plays its samples headless
+
+    for (int i = 0; i < t->num_fixtures; i++) {
+        TournamentFixture *f = &t->fixtures[i];
+        Match m = { .teamA = t->teams[f->team_a], .teamB = t->teams[f->team_b], .format = t->format };
+        printf("\nSimulating match: %s vs %s\n", m.teamA->name, m.teamB->name);
         char summary[512] = {0};
         const char* default_umpires = "Default Umpire";
         const char* default_ground = "Default Ground";
-        simulate_match(m->teamA, m->teamB, m->format, autoplay, 1, default_umpires, default_ground, summary, sizeof(summary));
+        simulate_match(m.teamA, m.teamB, m.format, autoplay, 1, default_umpires, default_ground, summary, sizeof(summary), &m);
         printf("%s\n", summary);
         append_user_history(user_email, summary);
 
-        // Update points table
-        PointsTableEntry *entryA = NULL, *entryB = NULL;
-        for (int j = 0; j < t.num_teams; j++) {
-            if (t.points_table[j].team == m->teamA) entryA = &t.points_table[j];
-            if (t.points_table[j].team == m->teamB) entryB = &t.points_table[j];
-        }
+        // Keep the result, then update points table
+        f->winner = (int8_t)(m.runsA > m.runsB ? 0 : (m.runsB > m.runsA ? 1 : -1));
+        f->runs[0] = (int16_t)m.runsA;
+        f->runs[1] = (int16_t)m.runsB;
+        f->wickets[0] = (int8_t)m.wicketsA;
+        f->wickets[1] = (int8_t)m.wicketsB;
+        f->balls[0] = (int16_t)m.ballsA;
+        f->balls[1] = (int16_t)m.ballsB;
+        const int runs[2] = { m.runsA, m.runsB }, balls[2] = { m.ballsA, m.ballsB };
+        points_table_record(&t->points_table, f->team_a, f->team_b, f->winner, runs, balls);
 
-        if (entryA && entryB) {
-            entryA->played++;
-            entryB->played++;
-            if (strstr(summary, m->teamA->name) == summary) { // Team A won
-                entryA->wins++;
-                entryA->points += 2;
-                entryB->losses++;
-            } else if (strstr(summary, m->teamB->name) == summary) { // Team B won
-                entryB->wins++;
-                entryB->points += 2;
-                entryA->losses++;
-            } else { // Draw
-                entryA->draws++;
-                entryB->draws++;
-                entryA->points += 1;
-                entryB->points += 1;
-            }
+        if (i + 1 < t->num_fixtures) {
+            display_points_table(t);
+            display_qualification_odds(t, pool);
         }
     }
 
-    display_points_table(&t);
+    printf("\n--- Results: %s ---\n", t->name);
+    for (int i = 0; i < t->num_fixtures; i++) {
+        char line[160];
+        fixture_summary(t, &t->fixtures[i], line, sizeof(line));
+        printf("%3d. %s\n", i + 1, line);
+    }
+    display_points_table(t);
 
+    job_queue_destroy(pool);
+    free_tournament(t);
     free(all_teams);
 }
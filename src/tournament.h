@@ -4,30 +4,34 @@
 #include "common.h"
 #include "teams.h"
 #include "match.h"
+#include "points_table.h"
 
-#define MAX_TEAMS_IN_TOURNAMENT 32
-#define MAX_MATCHES_IN_TOURNAMENT 64
+#include <stdint.h>
 
-// Entry for the points table
+#define MAX_TEAMS_IN_TOURNAMENT POINTS_TABLE_MAX_TEAMS
+#define MAX_MATCHES_IN_TOURNAMENT 64    // The World Cup screen's fixture arrays; a Tournament has no cap
+#define TOURNAMENT_PENDING -2           // TournamentFixture.winner until it is played
+
+// One fixture and, once it is played, its result. Summaries are written from this when wanted.
 typedef struct {
-    Team *team;
-    int played;
-    int wins;
-    int losses;
-    int draws;
-    int points;
-} PointsTableEntry;
+    uint8_t team_a, team_b;     // Indices into Tournament.teams
+    int8_t winner;              // TOURNAMENT_PENDING, 0 = team_a, 1 = team_b, -1 = tie
+    int8_t wickets[2];          // team_a's and team_b's
+    int16_t runs[2];
+    int16_t balls[2];           // Charged, for the net run rate
+} TournamentFixture;
 
-// Structure to represent a tournament
+// Structure to represent a tournament, kept on the heap
 typedef struct {
     char name[128];
-    Team teams[MAX_TEAMS_IN_TOURNAMENT];
+    Team *teams[MAX_TEAMS_IN_TOURNAMENT]; // Into the loaded teams, never copies
     int num_teams;
-    Match matches[MAX_MATCHES_IN_TOURNAMENT];
-    int num_matches;
+    TournamentFixture *fixtures; // Grows as fixtures are added
+    int num_fixtures;
+    int fixture_capacity;
     MatchFormat format;
     int num_groups;
-    PointsTableEntry points_table[MAX_TEAMS_IN_TOURNAMENT];
+    PointsTable points_table;
 } Tournament;
 
 void tournament_menu(const char *user_email, const char *user_name);
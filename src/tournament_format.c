@@ -0,0 +1,514 @@
+#include "tournament_format.h"
+#include "sim_engine.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MAX_SCHEDULE_DAYS 32767     // FormatMatch.day is 16 bits
+
+// --- Presets ---
+
+static int power_of_two_at_most(int n) {
+    int p = 1;
+    while (p * 2 <= n) p *= 2;
+    return p;
+}
+
+FormatSpec format_preset(FormatPreset preset, int num_teams) {
+    FormatSpec spec = { 0 };
+    if (preset == FORMAT_SUPER_EIGHTS && num_teams < 8) preset = FORMAT_GROUPS_KNOCKOUT;
+
+    switch (preset) {
+        case FORMAT_LEAGUE:
+            spec.stages[spec.num_stages++] = (StageSpec){ STAGE_GROUPS, 1, 1 };
+            break;
+        case FORMAT_LEAGUE_SEMIS:
+            spec.stages[spec.num_stages++] = (StageSpec){ STAGE_GROUPS, 1, num_teams >= 4 ? 4 : 2 };
+            spec.stages[spec.num_stages++] = (StageSpec){ STAGE_KNOCKOUT, 0, 0 };
+            break;
+        case FORMAT_GROUPS_KNOCKOUT: {
+            // A power of two of groups, so the top two of each fill the bracket exactly
+            int groups = power_of_two_at_most(num_teams / 4 > 0 ? num_teams / 4 : 1);
+            while ((num_teams + groups - 1) / groups > FORMAT_MAX_GROUP) groups *= 2;
+            int advance = groups == 1 ? (num_teams >= 4 ? 4 : 2) : 2;
+            spec.stages[spec.num_stages++] = (StageSpec){ STAGE_GROUPS, groups, advance };
+            spec.stages[spec.num_stages++] = (StageSpec){ STAGE_KNOCKOUT, 0, 0 };
+            break;
+        }
+        case FORMAT_SUPER_EIGHTS:
+            spec.stages[spec.num_stages++] = (StageSpec){ STAGE_GROUPS, 4, 2 };
+            spec.stages[spec.num_stages++] = (StageSpec){ STAGE_GROUPS, 2, 2 };
+            spec.stages[spec.num_stages++] = (StageSpec){ STAGE_KNOCKOUT, 0, 0 };
+            break;
+    }
+    return spec;
+}
+
+// --- Building the plan ---
+
+static FormatMatch* add_match(FormatPlan *plan, int stage, int round, int group, FormatSlot a, FormatSlot b) {
+    if (plan->num_matches == plan->match_capacity) {
+        int capacity = plan->match_capacity ? plan->match_capacity * 2 : 64;
+        FormatMatch *grown = realloc(plan->matches, capacity * sizeof(FormatMatch));
+        if (!grown) return NULL;
+        plan->matches = grown;
+        plan->match_capacity = capacity;
+    }
+    FormatMatch *m = &plan->matches[plan->num_matches++];
+    *m = (FormatMatch){ .stage = (uint8_t)stage, .round = (uint8_t)round, .group = (int16_t)group,
+                        .slot = { a, b }, .team = { -1, -1 }, .seed = { -1, -1 }, .winner = FORMAT_PENDING, .day = -1, .ground = -1 };
+    return m;
+}
+
+static bool same_slot(FormatSlot x, FormatSlot y) {
+    return x.kind == y.kind && x.a == y.a && x.b == y.b;
+}
+
+static int member_of(const FormatGroup *g, FormatSlot slot) {
+    for (int i = 0; i < g->num_members; i++) if (same_slot(g->member[i], slot)) return i;
+    return -1;
+}
+
+// Round robin by the circle method: one member stays put and the rest rotate, so every round
+// has each member playing once (one sits out when the group is odd)
+static bool add_group_round(FormatPlan *plan, int stage, int group, int round) {
+    const FormatGroup *g = &plan->groups[group];
+    int n = g->num_members + (g->num_members & 1); // With a bye
+    if (round >= n - 1) return true;
+    int pos[FORMAT_MAX_GROUP + 1];
+    pos[0] = 0;
+    for (int k = 1; k < n; k++) pos[k] = 1 + (k - 1 + round) % (n - 1);
+    for (int i = 0; i < n / 2; i++) {
+        int a = pos[i], b = pos[n - 1 - i];
+        if (a >= g->num_members || b >= g->num_members) continue; // The bye
+        if (round & 1) { int t = a; a = b; b = t; }
+        if (!add_match(plan, stage, round, group, g->member[a], g->member[b])) return false;
+    }
+    return true;
+}
+
+static bool build_groups(FormatPlan *plan, int stage, const FormatSlot *entrants, int count, int prev_groups) {
+    const StageSpec *s = &plan->spec.stages[stage];
+    if (s->num_groups < 1 || count / s->num_groups < 2 || (count + s->num_groups - 1) / s->num_groups > FORMAT_MAX_GROUP) return false;
+
+    int first = plan->num_groups;
+    FormatGroup *grown = realloc(plan->groups, (first + s->num_groups) * sizeof(FormatGroup));
+    if (!grown) return false;
+    plan->groups = grown;
+    plan->num_groups += s->num_groups;
+    for (int g = first; g < plan->num_groups; g++) {
+        memset(&plan->groups[g], 0, sizeof(FormatGroup));
+        plan->groups[g].stage = (uint8_t)stage;
+        plan->groups[g].last_day = -1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        int g;
+        if (prev_groups == 0) {
+            // Seeds snake across the groups: 1 2 3 4 / 8 7 6 5 / ...
+            int row = i / s->num_groups, col = i % s->num_groups;
+            g = (row & 1) ? s->num_groups - 1 - col : col;
+        } else {
+            // Entrants come place by place; moving each place along by one keeps group mates apart
+            int place = i / prev_groups, from = i % prev_groups;
+            g = (from + place) % s->num_groups;
+        }
+        FormatGroup *group = &plan->groups[first + g];
+        if (group->num_members == FORMAT_MAX_GROUP) return false;
+        group->member[group->num_members] = entrants[i];
+        group->team[group->num_members] = -1;
+        group->num_members++;
+    }
+
+    int rounds = 0;
+    for (int g = first; g < plan->num_groups; g++) {
+        FormatGroup *group = &plan->groups[g];
+        if (group->num_members < 2 || s->advance > group->num_members) return false;
+        group->num_matches = group->num_members * (group->num_members - 1) / 2;
+        points_table_init(&group->table, NULL, group->num_members);
+        int r = group->num_members - 1 + (group->num_members & 1);
+        if (r > rounds) rounds = r;
+    }
+    // Round by round across the groups, which is the order they are scheduled in
+    for (int r = 0; r < rounds; r++) {
+        for (int g = first; g < plan->num_groups; g++) {
+            if (!add_group_round(plan, stage, g, r)) return false;
+        }
+    }
+    return true;
+}
+
+static bool build_knockout(FormatPlan *plan, int stage, const FormatSlot *entrants, int count) {
+    int size = power_of_two_at_most(count); // The lowest seeds miss out when the count is not a power of two
+    if (size < 2) return false;
+
+    // Bracket positions by seed, so 1 and 2 can only meet in the final: 1 4 2 3, 1 8 4 5 2 7 3 6, ...
+    int order[2 * FORMAT_MAX_GROUP * FORMAT_MAX_STAGES];
+    int *bracket = size <= (int)(sizeof(order) / sizeof(order[0])) ? order : malloc(size * sizeof(int));
+    if (!bracket) return false;
+    bracket[0] = 0;
+    for (int n = 1; n < size; n *= 2) {
+        for (int i = n - 1; i >= 0; i--) {
+            bracket[2 * i] = bracket[i];
+            bracket[2 * i + 1] = 2 * n - 1 - bracket[i];
+        }
+    }
+
+    int round_first = plan->num_matches;
+    bool ok = true;
+    for (int i = 0; i < size / 2 && ok; i++) {
+        FormatMatch *m = add_match(plan, stage, 0, -1, entrants[bracket[2 * i]], entrants[bracket[2 * i + 1]]);
+        ok = m != NULL;
+        if (ok) {
+            m->seed[0] = (int16_t)bracket[2 * i];
+            m->seed[1] = (int16_t)bracket[2 * i + 1];
+        }
+    }
+    if (bracket != order) free(bracket);
+
+    for (int round = 1, matches = size / 4; matches >= 1 && ok; round++, matches /= 2) {
+        int next_first = plan->num_matches;
+        for (int i = 0; i < matches && ok; i++) {
+            FormatSlot a = { SLOT_WINNER, (int16_t)(round_first + 2 * i), 0 };
+            FormatSlot b = { SLOT_WINNER, (int16_t)(round_first + 2 * i + 1), 0 };
+            ok = add_match(plan, stage, round, -1, a, b) != NULL;
+        }
+        round_first = next_first;
+    }
+    return ok;
+}
+
+FormatPlan* format_plan_create(const FormatSpec *spec, Team **teams, int num_teams) {
+    if (!spec || spec->num_stages < 1 || spec->num_stages > FORMAT_MAX_STAGES || num_teams < 2) return NULL;
+    const StageSpec *last = &spec->stages[spec->num_stages - 1];
+    if (last->kind == STAGE_GROUPS && last->num_groups != 1) return NULL; // Someone has to win it
+
+    FormatPlan *plan = calloc(1, sizeof(FormatPlan));
+    FormatSlot *entrants = malloc(num_teams * sizeof(FormatSlot));
+    if (plan) plan->teams = malloc(num_teams * sizeof(Team*));
+    if (!plan || !entrants || !plan->teams) {
+        free(entrants);
+        format_plan_destroy(plan);
+        return NULL;
+    }
+    plan->spec = *spec;
+    plan->num_teams = num_teams;
+    plan->champion = -1;
+    memcpy(plan->teams, teams, num_teams * sizeof(Team*));
+
+    int count = num_teams, prev_groups = 0;
+    for (int i = 0; i < num_teams; i++) entrants[i] = (FormatSlot){ SLOT_TEAM, (int16_t)i, 0 };
+
+    bool ok = true;
+    for (int stage = 0; stage < spec->num_stages && ok; stage++) {
+        const StageSpec *s = &spec->stages[stage];
+        if (s->kind == STAGE_KNOCKOUT) {
+            ok = stage == spec->num_stages - 1 && build_knockout(plan, stage, entrants, count);
+            break;
+        }
+        int first_group = plan->num_groups;
+        ok = build_groups(plan, stage, entrants, count, prev_groups);
+        if (!ok) break;
+
+        // Who goes through: every group's winner, then every runner-up, ...
+        count = 0;
+        for (int place = 0; place < s->advance; place++) {
+            for (int g = first_group; g < plan->num_groups; g++) {
+                entrants[count++] = (FormatSlot){ SLOT_GROUP_PLACE, (int16_t)g, (int16_t)place };
+            }
+        }
+        prev_groups = s->num_groups;
+    }
+    free(entrants);
+    if (!ok) {
+        format_plan_destroy(plan);
+        return NULL;
+    }
+    for (int i = 0; i < plan->num_groups; i++) {
+        FormatGroup *g = &plan->groups[i];
+        for (int m = 0; m < g->num_members; m++) {
+            if (g->member[m].kind != SLOT_TEAM) continue;
+            g->team[m] = g->member[m].a;
+            g->table.entries[m].team = plan->teams[g->team[m]];
+        }
+    }
+    for (int i = 0; i < plan->num_matches; i++) {
+        FormatMatch *m = &plan->matches[i];
+        for (int k = 0; k < 2; k++) if (m->slot[k].kind == SLOT_TEAM) m->team[k] = m->slot[k].a;
+    }
+    return plan;
+}
+
+void format_plan_destroy(FormatPlan *plan) {
+    if (!plan) return;
+    free(plan->teams);
+    free(plan->groups);
+    free(plan->matches);
+    free(plan);
+}
+
+// --- Results ---
+
+static int resolve_slot(const FormatPlan *plan, FormatSlot slot) {
+    switch (slot.kind) {
+        case SLOT_TEAM:
+            return slot.a;
+        case SLOT_GROUP_PLACE: {
+            const FormatGroup *g = &plan->groups[slot.a];
+            if (g->played < g->num_matches) return -1;
+            int member = points_table_team_at(&g->table, slot.b);
+            return member < 0 ? -1 : g->team[member];
+        }
+        case SLOT_WINNER: {
+            const FormatMatch *m = &plan->matches[slot.a];
+            return m->winner == FORMAT_PENDING ? -1 : m->team[m->winner];
+        }
+    }
+    return -1;
+}
+
+// Fills in every slot that has just become known
+static void resolve_all(FormatPlan *plan) {
+    for (int i = 0; i < plan->num_groups; i++) {
+        FormatGroup *g = &plan->groups[i];
+        for (int m = 0; m < g->num_members; m++) {
+            if (g->team[m] >= 0) continue;
+            int team = resolve_slot(plan, g->member[m]);
+            if (team < 0) continue;
+            g->team[m] = (int16_t)team;
+            g->table.entries[m].team = plan->teams[team];
+        }
+    }
+    for (int i = 0; i < plan->num_matches; i++) {
+        FormatMatch *m = &plan->matches[i];
+        for (int k = 0; k < 2; k++) {
+            if (m->team[k] < 0) m->team[k] = (int16_t)resolve_slot(plan, m->slot[k]);
+            if (m->slot[k].kind == SLOT_WINNER && m->seed[k] < 0 && m->team[k] >= 0) {
+                const FormatMatch *from = &plan->matches[m->slot[k].a];
+                m->seed[k] = from->seed[from->winner]; // The winner carries its seeding on
+            }
+        }
+    }
+
+    const StageSpec *last = &plan->spec.stages[plan->spec.num_stages - 1];
+    if (last->kind == STAGE_KNOCKOUT) {
+        const FormatMatch *final = &plan->matches[plan->num_matches - 1];
+        if (final->winner != FORMAT_PENDING) plan->champion = final->team[final->winner];
+    } else {
+        plan->champion = resolve_slot(plan, (FormatSlot){ SLOT_GROUP_PLACE, (int16_t)(plan->num_groups - 1), 0 });
+    }
+}
+
+bool format_record(FormatPlan *plan, int match, int winner, const int runs[2], const int balls[2]) {
+    if (match < 0 || match >= plan->num_matches) return false;
+    FormatMatch *m = &plan->matches[match];
+    if (m->winner != FORMAT_PENDING || m->team[0] < 0 || m->team[1] < 0 || winner < -1 || winner > 1) return false;
+
+    if (m->group < 0) {
+        if (winner < 0) winner = (m->seed[1] >= 0 && m->seed[1] < m->seed[0]) ? 1 : 0;
+        m->winner = (int8_t)winner;
+        resolve_all(plan);
+        return true;
+    }
+    FormatGroup *g = &plan->groups[m->group];
+    int a = member_of(g, m->slot[0]), b = member_of(g, m->slot[1]);
+    points_table_record(&g->table, a, b, winner, runs, balls);
+    m->winner = (int8_t)winner;
+    if (++g->played == g->num_matches) resolve_all(plan); // Places are only final once the group is
+    return true;
+}
+
+typedef struct {
+    const Team *teams[2];
+    int overs;
+    uint32_t seed;
+    int winner;
+    int runs[2], balls[2];          // Of teams[0] and teams[1], balls charged
+} DayJob;
+
+static void play_job(void *arg) {
+    DayJob *job = (DayJob*)arg;
+    SimMatch *match = malloc(sizeof(SimMatch));
+    job->winner = -1;
+    if (!match) return;
+
+    SimRng toss;
+    sim_rng_seed(&toss, job->seed);
+    int first = sim_rng_range(&toss, 0, 1); // Which team bats first
+    sim_match_init(match, job->teams[first], job->teams[1 - first], job->overs, sim_rng_next(&toss));
+    sim_match_play(match);
+    for (int i = 0; i < 2; i++) {
+        int side = (i == 0) ? first : 1 - first;
+        job->runs[side] = match->runs[i];
+        job->balls[side] = match->wickets[i] >= 10 ? job->overs * 6 : match->balls[i];
+    }
+    job->winner = match->winner < 0 ? -1 : (match->winner == 0 ? first : 1 - first);
+    free(match);
+}
+
+int format_matches_on_day(const FormatPlan *plan, int day, int *out, int max) {
+    int count = 0;
+    for (int i = 0; i < plan->num_matches && count < max; i++) {
+        if (plan->matches[i].day == day) out[count++] = i;
+    }
+    return count;
+}
+
+int format_play_day(FormatPlan *plan, JobQueue *pool, int day, int overs, uint32_t seed) {
+    int count = 0;
+    for (int i = 0; i < plan->num_matches; i++) if (plan->matches[i].day == day) count++;
+    if (count == 0) return 0;
+    int *index = malloc(count * sizeof(int));
+    DayJob *jobs = malloc(count * sizeof(DayJob));
+    if (!index || !jobs) {
+        free(index);
+        free(jobs);
+        return 0;
+    }
+
+    int ready = 0;
+    for (int i = 0; i < plan->num_matches; i++) {
+        const FormatMatch *m = &plan->matches[i];
+        if (m->day != day || m->winner != FORMAT_PENDING || m->team[0] < 0 || m->team[1] < 0) continue;
+        index[ready] = i;
+        jobs[ready] = (DayJob){ .teams = { plan->teams[m->team[0]], plan->teams[m->team[1]] }, .overs = overs, .seed = seed + (uint32_t)i };
+        ready++;
+    }
+    for (int j = 0; j < ready; j++) job_queue_push(pool, play_job, &jobs[j]);
+    if (pool) job_queue_wait(pool);
+    for (int j = 0; j < ready; j++) format_record(plan, index[j], jobs[j].winner, jobs[j].runs, jobs[j].balls);
+
+    free(index);
+    free(jobs);
+    return ready;
+}
+
+// --- Scheduling ---
+
+static bool names_home(const char *country, const char *team) {
+    size_t n = strlen(team);
+    if (n == 0) return false;
+    for (const char *p = country; *p; p++) {
+        size_t i = 0;
+        while (i < n && p[i] && tolower((unsigned char)p[i]) == tolower((unsigned char)team[i])) i++;
+        if (i == n) return true;
+    }
+    return false;
+}
+
+typedef struct {
+    const FormatScheduleRules *rules;
+    int num_grounds;
+    int capacity;                   // Days the arrays below have room for
+    uint8_t *ground_busy;           // [day * num_grounds + ground]
+    int *day_matches;
+} Calendar;
+
+static bool calendar_reserve(Calendar *cal, int day) {
+    if (day < cal->capacity) return true;
+    if (day >= MAX_SCHEDULE_DAYS) return false;
+    int capacity = cal->capacity ? cal->capacity : 64;
+    while (capacity <= day) capacity *= 2;
+    int stride = cal->num_grounds > 0 ? cal->num_grounds : 1;
+    uint8_t *busy = realloc(cal->ground_busy, (size_t)capacity * stride);
+    int *matches = realloc(cal->day_matches, capacity * sizeof(int));
+    if (busy) cal->ground_busy = busy;
+    if (matches) cal->day_matches = matches;
+    if (!busy || !matches) return false;
+    memset(cal->ground_busy + (size_t)cal->capacity * stride, 0, (size_t)(capacity - cal->capacity) * stride);
+    memset(cal->day_matches + cal->capacity, 0, (capacity - cal->capacity) * sizeof(int));
+    cal->capacity = capacity;
+    return true;
+}
+
+static bool ground_free(const Calendar *cal, int ground, int day) {
+    int rest = cal->rules->ground_rest_days;
+    for (int d = day - rest; d <= day + rest; d++) {
+        if (d >= 0 && d < cal->capacity && cal->ground_busy[(size_t)d * cal->num_grounds + ground]) return false;
+    }
+    return true;
+}
+
+bool format_schedule(FormatPlan *plan, const Ground *grounds, int num_grounds, const FormatScheduleRules *rules) {
+    static const FormatScheduleRules defaults = { .min_rest_days = 1, .ground_rest_days = 1, .stage_break_days = 1 };
+    if (!rules) rules = &defaults;
+    if (!grounds) num_grounds = 0;
+    int rest = rules->min_rest_days > 0 ? rules->min_rest_days : 0;
+
+    Calendar cal = { .rules = rules, .num_grounds = num_grounds };
+    int *team_ready = calloc(plan->num_teams, sizeof(int));
+    int (*member_ready)[FORMAT_MAX_GROUP] = calloc(plan->num_groups ? plan->num_groups : 1, sizeof(*member_ready));
+    // Each team's home grounds, by bit; past 64 grounds only the first 64 can be home
+    uint64_t *home = calloc(plan->num_teams, sizeof(uint64_t));
+    bool ok = team_ready && member_ready && home;
+    for (int t = 0; ok && t < plan->num_teams; t++) {
+        for (int g = 0; g < num_grounds && g < 64; g++) {
+            if (names_home(grounds[g].country, plan->teams[t]->name)) home[t] |= 1ull << g;
+        }
+    }
+
+    int stage_start = 0, last_day = -1;
+    for (int stage = 0; ok && stage < plan->spec.num_stages; stage++) {
+        int stage_end = stage_start;
+        for (int i = 0; ok && i < plan->num_matches; i++) {
+            FormatMatch *m = &plan->matches[i];
+            if (m->stage != stage) continue;
+
+            // Earliest day both sides are rested
+            int earliest = stage_start, members[2] = { -1, -1 };
+            FormatGroup *group = m->group >= 0 ? &plan->groups[m->group] : NULL;
+            for (int k = 0; k < 2; k++) {
+                FormatSlot s = m->slot[k];
+                int ready = 0;
+                if (group) {
+                    members[k] = member_of(group, s);
+                    ready = member_ready[m->group][members[k]];
+                }
+                if (s.kind == SLOT_TEAM) { if (team_ready[s.a] > ready) ready = team_ready[s.a]; }
+                else if (s.kind == SLOT_GROUP_PLACE) { int d = plan->groups[s.a].last_day + rest + 1; if (d > ready) ready = d; }
+                else { int d = plan->matches[s.a].day + rest + 1; if (d > ready) ready = d; }
+                if (ready > earliest) earliest = ready;
+            }
+
+            // First day with room and a free ground, a home ground before a neutral one
+            uint64_t preferred = 0;
+            for (int k = 0; k < 2; k++) if (m->team[k] >= 0) preferred |= home[m->team[k]];
+            int day = earliest, ground = -1;
+            for (;; day++) {
+                if (!calendar_reserve(&cal, day)) { ok = false; break; }
+                if (rules->max_matches_per_day > 0 && cal.day_matches[day] >= rules->max_matches_per_day) continue;
+                if (num_grounds == 0) break;
+                for (int pass = 0; pass < 2 && ground < 0; pass++) {
+                    for (int g = 0; g < num_grounds; g++) {
+                        bool is_home = g < 64 && (preferred >> g & 1);
+                        if ((pass == 0) != is_home) continue;
+                        if (ground_free(&cal, g, day)) { ground = g; break; }
+                    }
+                }
+                if (ground >= 0) break;
+            }
+            if (!ok) break;
+
+            m->day = (int16_t)day;
+            m->ground = (int16_t)ground;
+            cal.day_matches[day]++;
+            if (ground >= 0) cal.ground_busy[(size_t)day * num_grounds + ground] = 1;
+            for (int k = 0; k < 2; k++) {
+                if (group) member_ready[m->group][members[k]] = day + rest + 1;
+                if (m->slot[k].kind == SLOT_TEAM) team_ready[m->slot[k].a] = day + rest + 1;
+            }
+            if (group && day > group->last_day) group->last_day = day;
+            if (day > stage_end) stage_end = day;
+            if (day > last_day) last_day = day;
+        }
+        stage_start = stage_end + 1 + (rules->stage_break_days > 0 ? rules->stage_break_days : 0);
+    }
+    plan->num_days = ok ? last_day + 1 : 0;
+
+    free(cal.ground_busy);
+    free(cal.day_matches);
+    free(team_ready);
+    free(member_ready);
+    free(home);
+    return ok;
+}
@@ -0,0 +1,118 @@
+#ifndef TOURNAMENT_FORMAT_H
+#define TOURNAMENT_FORMAT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "teams.h"
+#include "grounds.h"
+#include "points_table.h"
+#include "job_queue.h"
+
+// Tournament formats beyond a flat round robin: group stages, a second group stage (super
+// eights) and knockout brackets. A FormatPlan holds every match of the event from the start;
+// matches of later stages name where their teams come from (2nd in group B, winner of match
+// 41) until those results are in. format_schedule() then gives every match a day and a ground,
+// and format_play_day() plays all the matches of one day at once on the worker pool.
+
+#define FORMAT_MAX_STAGES 4
+#define FORMAT_PENDING -2           // FormatMatch.winner until it is played
+#define FORMAT_MAX_GROUP POINTS_TABLE_MAX_TEAMS
+
+typedef enum {
+    STAGE_GROUPS,                   // Round robin inside each group, the top `advance` of each go through
+    STAGE_KNOCKOUT                  // Seeded bracket down to the final
+} StageKind;
+
+typedef struct {
+    StageKind kind;
+    int num_groups;
+    int advance;
+} StageSpec;
+
+typedef struct {
+    StageSpec stages[FORMAT_MAX_STAGES];
+    int num_stages;
+} FormatSpec;
+
+typedef enum {
+    FORMAT_LEAGUE,                  // Everyone plays everyone, top of the table wins
+    FORMAT_LEAGUE_SEMIS,            // Then the top four play semi-finals and a final
+    FORMAT_GROUPS_KNOCKOUT,         // Groups of about four, the top two into a knockout
+    FORMAT_SUPER_EIGHTS             // Four groups, the top two into two groups of four, then semi-finals
+} FormatPreset;
+
+typedef enum {
+    SLOT_TEAM,                      // a: team
+    SLOT_GROUP_PLACE,               // a: group, b: place (0 = top)
+    SLOT_WINNER                     // a: match
+} SlotKind;
+
+typedef struct {
+    int8_t kind;
+    int16_t a, b;
+} FormatSlot;
+
+typedef struct {
+    uint8_t stage;
+    uint8_t round;                  // Round of the group or of the knockout
+    int16_t group;                  // -1 in a knockout
+    FormatSlot slot[2];
+    int16_t team[2];                // -1 until the slot is decided
+    int16_t seed[2];                // Knockout seeding of those teams, 0 = top; -1 in groups and until decided
+    int8_t winner;                  // FORMAT_PENDING, 0 = team[0], 1 = team[1], -1 = tie (groups only)
+    int16_t day;                    // -1 until scheduled
+    int16_t ground;                 // Index into the grounds given to format_schedule, -1 for none
+} FormatMatch;
+
+typedef struct {
+    uint8_t stage;
+    int num_members;
+    FormatSlot member[FORMAT_MAX_GROUP];
+    int16_t team[FORMAT_MAX_GROUP]; // -1 until the slot is decided
+    int played;
+    int num_matches;
+    int last_day;                   // Of its last scheduled match
+    PointsTable table;              // By member
+} FormatGroup;
+
+typedef struct {
+    FormatSpec spec;
+    Team **teams;                   // Given to format_plan_create, in seeding order
+    int num_teams;
+    FormatGroup *groups;
+    int num_groups;
+    FormatMatch *matches;           // Stage by stage, round by round
+    int num_matches;
+    int match_capacity;
+    int num_days;                   // Once scheduled
+    int champion;                   // Team, -1 until decided
+} FormatPlan;
+
+typedef struct {
+    int min_rest_days;              // Full days off for a team between two of its matches
+    int ground_rest_days;           // Full days between two matches on one ground
+    int stage_break_days;           // Extra days between the end of one stage and the next
+    int max_matches_per_day;        // 0 lets the grounds decide
+} FormatScheduleRules;
+
+// Groups as even as the team count allows; no group larger than FORMAT_MAX_GROUP
+FormatSpec format_preset(FormatPreset preset, int num_teams);
+// NULL if the spec cannot be built for this many teams. teams are referenced, not copied.
+FormatPlan* format_plan_create(const FormatSpec *spec, Team **teams, int num_teams);
+void format_plan_destroy(FormatPlan *plan);
+
+// Days and grounds for every match. A match goes to a home ground of one of its teams (a
+// ground whose country names the team) when one is free that day. Without grounds only the
+// rest days and the daily cap apply. Returns false if it runs out of days.
+bool format_schedule(FormatPlan *plan, const Ground *grounds, int num_grounds, const FormatScheduleRules *rules);
+
+int format_matches_on_day(const FormatPlan *plan, int day, int *out, int max);
+// winner: 0 = team[0], 1 = team[1], -1 = tie. A tied knockout match goes to the team seeded
+// higher going into the knockout, whichever slot it is in. runs/balls as for
+// points_table_record, may be NULL. Decides the slots that depend on it.
+bool format_record(FormatPlan *plan, int match, int winner, const int runs[2], const int balls[2]);
+// Plays every decided match of the day headless and records them in match order, so the
+// results do not depend on the number of workers. Returns how many were played.
+int format_play_day(FormatPlan *plan, JobQueue *pool, int day, int overs, uint32_t seed);
+
+#endif // TOURNAMENT_FORMAT_H
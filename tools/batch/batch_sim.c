@@ -0,0 +1,696 @@
+// Batch simulation: plays many matches or round-robin tournaments without any prompt and
+// streams the results as JSON lines, one object per line, to stdout or a file. Never reads
+// stdin, so it can sit in the middle of a shell pipeline.
+//
+//   sh tools/batch/build_batch_sim.sh
+//   ./batch_sim --teams India,Austraila --format T20 --matches 100000 --seed 7 | jq ...
+//   ./batch_sim --config campaign.cfg --out results.jsonl
+//
+// A config file holds the same options, one "name = value" per line ('#' starts a comment);
+// options are applied in order, so flags after --config override it. Match i is played with
+// seed + i, so any single match can be replayed with --seed <its seed> --matches 1.
+// Output order does not depend on the thread count. Run it from the repository root so
+// Data/teams.dat is found.
+//
+// Lines written:
+//   {"type":"match", ...}       every match, with both innings and the winner
+//   {"type":"ball", ...}        every delivery before its match, with --balls
+//   {"type":"tournament", ...}  the final table of each tournament, with --tournaments
+//   {"type":"study", ...}       the estimate and its interval, with --compare or --ci
+//
+// With --ratings FILE the team and player ratings in FILE are updated by every match, in match
+// order, and written back at the end; the rankings screen reads Data/ratings.dat.
+//
+// A study measures the first team: its runs, its wins or its winning margin. With --compare
+// the options given to it are changed for a second scenario, both are played on common random
+// numbers, and the difference is estimated; --ci stops once the 95% interval is that narrow:
+//
+//   ./batch_sim --teams India,Austraila --compare batsman=best --measure runs --ci 2 --antithetic
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <time.h>
+#include "sim_engine.h"
+#include "sim_study.h"
+#include "points_table.h"
+#include "ratings.h"
+#include "field_coverage.h"
+#include "job_queue.h"
+#include "teams.h"
+
+#define MAX_BATCH_TEAMS 16
+#define JOBS_PER_WORKER 64              // Jobs handed out between two writes of the output
+#define RAIN_CHANCE_PER_OVER 0.1f       // Same as simulate_match
+#define MAX_COMPARE_OPTIONS 8
+
+typedef enum { BOWLER_ROTATE, BOWLER_BEST } BowlerPolicy;
+typedef enum { BATSMAN_ORDER, BATSMAN_BEST } BatsmanPolicy;
+typedef enum { RUNS_ENGINE, RUNS_SINGLES } RunsPolicy;
+typedef enum { MEASURE_RUNS, MEASURE_WIN, MEASURE_MARGIN } StudyMeasure;
+
+typedef struct {
+    const Team *teams[MAX_BATCH_TEAMS];
+    int num_teams;
+    MatchFormat format;
+    int overs;                          // 0: from the format
+    long matches;
+    long tournaments;                   // Replaces matches when set
+    uint32_t seed;
+    int threads;                        // 0: one per core
+    bool balls;
+    bool rain;
+    BowlerPolicy bowler;
+    BatsmanPolicy batsman;
+    RunsPolicy runs;
+    int field;                          // FieldingSetup, -1 for the engine's default
+    const char *out_path;
+    const char *ratings_path;
+    // Studies
+    char *compare[MAX_COMPARE_OPTIONS]; // "name=value", applied on top of the rest for the second scenario
+    int num_compare;
+    StudyMeasure measure;
+    double ci;                          // Target half width of the 95% interval, 0 to play --matches
+    bool independent;                   // No common random numbers
+    bool antithetic;
+} BatchConfig;
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} Buffer;
+
+typedef struct {
+    long index;                         // Match or tournament number
+    Buffer out;
+    RatingsLog ratings;                 // With --ratings, applied once the job's window is done
+} Job;
+
+static Team *all_teams = NULL;
+static int num_all_teams = 0;
+static BatchConfig config = { .format = FORMAT_ODI, .matches = 1, .seed = 1, .field = -1 };
+static BatchConfig scenarios[2];        // What each arm of a study plays
+static Ratings ratings;                 // Only read by the workers, so ids can be looked up while they run
+
+// --- Output ---
+
+static void buffer_printf(Buffer *b, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+static void buffer_printf(Buffer *b, const char *fmt, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(b->data ? b->data + b->len : NULL, b->cap - b->len, fmt, args);
+        va_end(args);
+        if (n < 0) return;
+        if (b->len + (size_t)n < b->cap) { b->len += (size_t)n; return; }
+        size_t cap = b->cap ? b->cap * 2 : 1024;
+        while (cap <= b->len + (size_t)n) cap *= 2;
+        char *grown = realloc(b->data, cap);
+        if (!grown) return;
+        b->data = grown;
+        b->cap = cap;
+    }
+}
+
+static void buffer_append(Buffer *b, const char *data, size_t n) {
+    if (b->len + n >= b->cap) {
+        size_t cap = b->cap ? b->cap * 2 : 1024;
+        while (cap <= b->len + n) cap *= 2;
+        char *grown = realloc(b->data, cap);
+        if (!grown) return;
+        b->data = grown;
+        b->cap = cap;
+    }
+    memcpy(b->data + b->len, data, n);
+    b->len += n;
+}
+
+// Appends text as the inside of a JSON string
+static void buffer_escape(Buffer *b, const char *text) {
+    const char *run = text;
+    for (const unsigned char *p = (const unsigned char*)text; *p; p++) {
+        if (*p != '"' && *p != '\\' && *p >= 0x20) continue;
+        buffer_append(b, run, (const char*)p - run);
+        if (*p == '"' || *p == '\\') buffer_printf(b, "\\%c", *p);
+        else buffer_printf(b, "\\u%04x", *p);
+        run = (const char*)p + 1;
+    }
+    buffer_append(b, run, strlen(run));
+}
+
+static const char* format_name(MatchFormat format) {
+    return format == FORMAT_T20 ? "T20" : format == FORMAT_TEST ? "Test" : "ODI";
+}
+
+static const char* outcome_name(BallOutcomeType type) {
+    switch (type) {
+        case OUTCOME_DOT: return "dot";
+        case OUTCOME_RUNS: return "runs";
+        case OUTCOME_WICKET: return "wicket";
+        default: return "extra";
+    }
+}
+
+static int match_overs(const BatchConfig *cfg) {
+    if (cfg->overs > 0) return cfg->overs;
+    return cfg->format == FORMAT_T20 ? 20 : SIM_MAX_OVERS; // The engine plays limited-overs innings only
+}
+
+// --- Autoplay policies ---
+
+static int best_bowler(const GameState *state) {
+    const Team *team = state->bowling_team;
+    int quota = sim_bowling_quota(state), best = -1;
+    for (int i = 0; i < team->num_players; i++) {
+        const Player *p = &team->players[i];
+        if (i == state->last_bowler_idx || p->is_wicketkeeper || p->match_balls_bowled / 6 >= quota) continue;
+        if (best < 0 || p->bowling_skill > team->players[best].bowling_skill) best = i;
+    }
+    return best >= 0 ? best : sim_choose_bowler(state);
+}
+
+static int best_batsman(const GameState *state) {
+    const Team *team = state->batting_team;
+    int best = -1;
+    for (int i = 0; i < team->num_players; i++) {
+        if (team->players[i].is_out || i == state->striker_idx || i == state->non_striker_idx) continue;
+        if (best < 0 || team->players[i].batting_skill > team->players[best].batting_skill) best = i;
+    }
+    return best;
+}
+
+// Answers what the engine waits for; false if the policy has no valid answer
+static bool decide(SimMatch *match, SimStatus status) {
+    SimEngine *engine = &match->engine;
+    const GameState *state = &match->state;
+    switch (status) {
+        case SIM_STATUS_NEED_BOWLER:
+            return sim_engine_decide(engine, (SimDecision){ SIM_DECISION_BOWLER, best_bowler(state) }) ||
+                   sim_engine_decide(engine, (SimDecision){ SIM_DECISION_BOWLER, sim_choose_bowler(state) });
+        case SIM_STATUS_NEED_BATSMAN:
+            return sim_engine_decide(engine, (SimDecision){ SIM_DECISION_BATSMAN, best_batsman(state) });
+        case SIM_STATUS_NEED_RUNS: {
+            int runs = engine->suggested_runs > 1 ? 1 : engine->suggested_runs;
+            return sim_engine_decide(engine, (SimDecision){ SIM_DECISION_RUNS, runs });
+        }
+        default:
+            return false;
+    }
+}
+
+// --- Matches ---
+
+typedef struct {
+    int batting_first;                  // 0 if team a batted first
+    int winner;                         // 0 = team a, 1 = team b, -1 = tie
+    int runs[2], wickets[2], balls[2];  // Per innings
+} MatchResult;
+
+static void write_ball(Buffer *out, long match_index, int innings, const SimMatch *match) {
+    const GameState *state = &match->state;
+    const SimEngine *engine = &match->engine;
+    bool over_done = (state->balls_bowled_in_over == 0);
+    int over = over_done ? state->overs_completed - 1 : state->overs_completed;
+    int in_over = over_done ? 6 : state->balls_bowled_in_over;
+
+    buffer_printf(out, "{\"type\":\"ball\",\"match\":%ld,\"innings\":%d,\"over\":%d,\"ball\":%d,\"bowler\":\"", match_index, innings, over, in_over);
+    buffer_escape(out, state->bowling_team->players[engine->last_bowler].name);
+    buffer_printf(out, "\",\"batsman\":\"");
+    buffer_escape(out, state->batting_team->players[engine->last_striker].name);
+    buffer_printf(out, "\",\"outcome\":\"%s\",\"runs\":%d,\"total\":%d,\"wickets\":%d}\n",
+                  outcome_name(engine->last.type), engine->last.runs, state->total_runs, state->wickets);
+}
+
+// The toss and then the whole match are drawn from `stream`
+static MatchResult play_match(const BatchConfig *cfg, const Team *a, const Team *b, SimRng *stream, long match_index, Buffer *out, RatingsLog *rated) {
+    SimMatch *match = malloc(sizeof(SimMatch));
+    MatchResult result = { .winner = -1 };
+    if (!match) return result;
+
+    result.batting_first = sim_rng_range(stream, 0, 1);
+    sim_match_init(match, result.batting_first ? b : a, result.batting_first ? a : b, match_overs(cfg), 0);
+    match->engine.rng = sim_rng_split(stream);
+    if (cfg->rain) match->state.rain_percentage = RAIN_CHANCE_PER_OVER;
+    if (cfg->field >= 0) sim_engine_decide(&match->engine, (SimDecision){ SIM_DECISION_FIELD, cfg->field });
+    if (cfg->bowler == BOWLER_BEST) match->engine.auto_decisions &= ~SIM_AUTO_BOWLER;
+    if (cfg->batsman == BATSMAN_BEST) match->engine.auto_decisions &= ~SIM_AUTO_BATSMAN;
+    if (cfg->runs == RUNS_SINGLES) match->engine.auto_decisions &= ~SIM_AUTO_RUNS;
+    int ids[2][MAX_PLAYERS];
+    if (rated) for (int i = 0; i < 2; i++) ratings_xi_ids(&ratings, &match->teams[i], ids[i]); // Once per match, not per ball
+
+    for (;;) {
+        int innings = match->innings;
+        SimStatus status = sim_match_step(match);
+        if (status == SIM_STATUS_BALL_DONE) {
+            if (out) write_ball(out, match_index, innings + 1, match);
+            BallOutcomeType type = match->engine.last.type;
+            if (rated && (type == OUTCOME_DOT || type == OUTCOME_RUNS || type == OUTCOME_WICKET)) {
+                ratings_log_ball(rated, ids[innings][match->engine.last_striker], ids[1 - innings][match->engine.last_bowler],
+                                 match->engine.last.runs, type == OUTCOME_WICKET);
+            }
+        } else if (status == SIM_STATUS_MATCH_OVER) {
+            break;
+        } else if (status != SIM_STATUS_INNINGS_OVER && !decide(match, status)) {
+            match->engine.auto_decisions = SIM_AUTO_ALL; // Nothing valid left to choose, let the engine carry on
+        }
+    }
+
+    // Map the engine's "side batting first" back to team a/team b
+    result.winner = (match->winner < 0) ? -1 : (match->winner == 0 ? result.batting_first : 1 - result.batting_first);
+    if (rated) ratings_log_result(rated, ratings_find(&ratings, a->name, NULL), ratings_find(&ratings, b->name, NULL), result.winner);
+    for (int i = 0; i < 2; i++) {
+        result.runs[i] = match->runs[i];
+        result.wickets[i] = match->wickets[i];
+        result.balls[i] = match->balls[i];
+    }
+    free(match);
+    return result;
+}
+
+static void write_match(Buffer *out, long match_index, long tournament, uint32_t seed, const Team *team_a, const Team *team_b, const MatchResult *r) {
+    const Team *order[2] = { r->batting_first ? team_b : team_a, r->batting_first ? team_a : team_b };
+    buffer_printf(out, "{\"type\":\"match\",\"match\":%ld,", match_index);
+    if (tournament >= 0) buffer_printf(out, "\"tournament\":%ld,", tournament);
+    buffer_printf(out, "\"seed\":%u,\"format\":\"%s\",\"overs\":%d,\"team_a\":\"", seed, format_name(config.format), match_overs(&config));
+    buffer_escape(out, team_a->name);
+    buffer_printf(out, "\",\"team_b\":\"");
+    buffer_escape(out, team_b->name);
+    buffer_printf(out, "\",\"innings\":[");
+    for (int i = 0; i < 2; i++) {
+        buffer_printf(out, "%s{\"team\":\"", i ? "," : "");
+        buffer_escape(out, order[i]->name);
+        buffer_printf(out, "\",\"runs\":%d,\"wickets\":%d,\"balls\":%d}", r->runs[i], r->wickets[i], r->balls[i]);
+    }
+    buffer_printf(out, "],\"winner\":");
+    if (r->winner < 0) {
+        buffer_printf(out, "null,\"margin\":\"tie\"}\n");
+        return;
+    }
+    buffer_printf(out, "\"");
+    buffer_escape(out, r->winner ? team_b->name : team_a->name);
+    // The side batting first wins by runs, the chasing side by the wickets it had left
+    if (r->winner == r->batting_first) buffer_printf(out, "\",\"margin\":\"%d runs\"}\n", r->runs[0] - r->runs[1]);
+    else buffer_printf(out, "\",\"margin\":\"%d wickets\"}\n", 10 - r->wickets[1]);
+}
+
+// The two teams of the pairing-th of all n*(n-1)/2 pairings, in a fixed order
+static void pairing(int pairing_index, int *a, int *b) {
+    int n = config.num_teams;
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            if (pairing_index-- == 0) { *a = i; *b = j; return; }
+        }
+    }
+    *a = 0;
+    *b = 1;
+}
+
+static void match_job(void *arg) {
+    Job *job = (Job*)arg;
+    int pairs = config.num_teams * (config.num_teams - 1) / 2;
+    int a, b;
+    pairing((int)(job->index % pairs), &a, &b);
+    uint32_t seed = config.seed + (uint32_t)job->index;
+    SimRng stream;
+    sim_rng_seed(&stream, seed);
+    MatchResult result = play_match(&config, config.teams[a], config.teams[b], &stream, job->index, config.balls ? &job->out : NULL,
+                                    config.ratings_path ? &job->ratings : NULL);
+    write_match(&job->out, job->index, -1, seed, config.teams[a], config.teams[b], &result);
+}
+
+// --- Tournaments ---
+
+// Every team plays every other once; matches are numbered from the tournament's first one
+static void tournament_job(void *arg) {
+    Job *job = (Job*)arg;
+    int n = config.num_teams, pairs = n * (n - 1) / 2;
+    PointsTable table;
+    points_table_init(&table, NULL, n);
+
+    for (int p = 0; p < pairs; p++) {
+        int a, b;
+        pairing(p, &a, &b);
+        long match_index = job->index * pairs + p;
+        uint32_t seed = config.seed + (uint32_t)match_index;
+        SimRng stream;
+        sim_rng_seed(&stream, seed);
+        MatchResult r = play_match(&config, config.teams[a], config.teams[b], &stream, match_index, config.balls ? &job->out : NULL,
+                                   config.ratings_path ? &job->ratings : NULL);
+        write_match(&job->out, match_index, job->index, seed, config.teams[a], config.teams[b], &r);
+
+        // Back from innings order to team a/team b; an all-out side is charged its full overs, as in the real rule
+        int runs[2], balls[2];
+        for (int i = 0; i < 2; i++) {
+            int side = (i == 0) ? r.batting_first : 1 - r.batting_first;
+            runs[side] = r.runs[i];
+            balls[side] = (r.wickets[i] >= 10) ? match_overs(&config) * 6 : r.balls[i];
+        }
+        points_table_record(&table, a, b, r.winner, runs, balls);
+    }
+
+    int order[MAX_BATCH_TEAMS];
+    points_table_standings(&table, order);
+    buffer_printf(&job->out, "{\"type\":\"tournament\",\"tournament\":%ld,\"format\":\"%s\",\"champion\":\"", job->index, format_name(config.format));
+    buffer_escape(&job->out, config.teams[order[0]]->name);
+    buffer_printf(&job->out, "\",\"table\":[");
+    for (int i = 0; i < n; i++) {
+        const PointsTableEntry *s = &table.entries[order[i]];
+        buffer_printf(&job->out, "%s{\"team\":\"", i ? "," : "");
+        buffer_escape(&job->out, config.teams[order[i]]->name);
+        buffer_printf(&job->out, "\",\"played\":%d,\"won\":%d,\"lost\":%d,\"tied\":%d,\"points\":%d,\"nrr\":%.3f}",
+                      s->played, s->wins, s->losses, s->draws, s->points, points_table_nrr(s));
+    }
+    buffer_printf(&job->out, "]}\n");
+}
+
+// --- Studies ---
+
+static const char* measure_name(StudyMeasure measure) {
+    return measure == MEASURE_WIN ? "win" : measure == MEASURE_MARGIN ? "margin" : "runs";
+}
+
+// One match between the first two teams, measured for the first of them
+static double study_match(void *ctx, int scenario, uint64_t key, bool antithetic) {
+    (void)ctx;
+    SimRng stream;
+    sim_rng_seed_key(&stream, key, antithetic);
+    MatchResult r = play_match(&scenarios[scenario], config.teams[0], config.teams[1], &stream, 0, NULL, NULL);
+    int own = r.batting_first ? 1 : 0; // Innings the first team batted
+    switch (config.measure) {
+        case MEASURE_WIN: return r.winner < 0 ? 0.5 : (r.winner == 0 ? 1.0 : 0.0);
+        case MEASURE_MARGIN: return r.runs[own] - r.runs[1 - own];
+        default: return r.runs[own];
+    }
+}
+
+static void write_study(FILE *out, const SimStudyConfig *study, const SimStudyResult *r) {
+    fprintf(out, "{\"type\":\"study\",\"team\":\"");
+    Buffer name = { 0 };
+    buffer_escape(&name, config.teams[0]->name);
+    fwrite(name.data, 1, name.len, out);
+    free(name.data);
+    fprintf(out, "\",\"measure\":\"%s\",\"compare\":[", measure_name(config.measure));
+    for (int i = 0; i < config.num_compare; i++) fprintf(out, "%s\"%s\"", i ? "," : "", config.compare[i]);
+    fprintf(out, "],\"common_random_numbers\":%s,\"antithetic\":%s,\"mean\":[%.4f",
+            study->common_random_numbers ? "true" : "false", study->antithetic ? "true" : "false", r->mean[0]);
+    if (study->num_scenarios == 2) fprintf(out, ",%.4f", r->mean[1]);
+    fprintf(out, "],\"estimate\":%.4f,\"half_width\":%.4f,\"std_dev\":%.4f,\"replicates\":%ld,\"matches\":%ld,\"converged\":%s}\n",
+            r->estimate, r->half_width, r->std_dev, r->replicates, r->matches, r->converged ? "true" : "false");
+}
+
+// --- Options ---
+
+static const Team* find_team(const char *key) {
+    for (int i = 0; i < num_all_teams; i++) {
+        const Team *t = &all_teams[i];
+        if (t->is_deleted || t->num_players < 2) continue;
+        if ((t->tag[0] && strcasecmp(t->tag, key) == 0) || strcasecmp(t->name, key) == 0) return t;
+    }
+    return NULL;
+}
+
+static void usage(FILE *to) {
+    fprintf(to,
+        "usage: batch_sim --teams A,B[,...] [options]\n"
+        "  --teams LIST        teams by tag or name, comma separated\n"
+        "  --format T20|ODI    sets the overs (Test is played as a 50 over match)\n"
+        "  --overs N           overs per innings, overrides the format\n"
+        "  --matches N         matches to play, cycling through every pairing (default 1)\n"
+        "  --tournaments N     round-robin tournaments to play instead\n"
+        "  --seed N            match i uses seed N + i (default 1)\n"
+        "  --threads N         worker threads, 0 for one per core (default 0)\n"
+        "  --balls             also write every delivery\n"
+        "  --rain              overs can be lost to rain\n"
+        "  --bowler rotate|best      least used bowler (default) or the best one with overs left\n"
+        "  --batsman order|best      batting order (default) or the best batsman left\n"
+        "  --runs engine|singles     run what the shot allows (default) or never more than one\n"
+        "  --field NAME        pp_aggressive, pp_defensive, mo_normal, mo_defensive or do_defensive\n"
+        "  --compare NAME=VALUE      study: a second scenario with this option changed (repeatable;\n"
+        "                      rain, overs, bowler, batsman, runs or field)\n"
+        "  --measure runs|win|margin what a study measures for the first team (default runs)\n"
+        "  --ci W              study: stop once the 95%% interval is within +/- W (--matches caps it)\n"
+        "  --independent       study without common random numbers, to see what they save\n"
+        "  --antithetic        study on mirrored pairs of matches\n"
+        "  --ratings FILE      update the team and player ratings in FILE (e.g. Data/ratings.dat)\n"
+        "  --out FILE          write to FILE instead of stdout\n"
+        "  --config FILE       read options from FILE, one \"name = value\" per line\n");
+}
+
+static bool load_config(const char *path);
+
+// Applies one option; `value` is NULL for flags. Returns false with a message on stderr.
+static bool set_option(const char *name, const char *value) {
+    static const char *field_names[FIELD_SETUP_COUNT] = { "pp_aggressive", "pp_defensive", "mo_normal", "mo_defensive", "do_defensive" };
+    bool is_flag = strcmp(name, "balls") == 0 || strcmp(name, "rain") == 0 ||
+                   strcmp(name, "independent") == 0 || strcmp(name, "antithetic") == 0;
+    if (!is_flag && !value) {
+        fprintf(stderr, "Error: --%s needs a value\n", name);
+        return false;
+    }
+
+    if (strcmp(name, "teams") == 0) {
+        char list[512];
+        snprintf(list, sizeof(list), "%s", value);
+        config.num_teams = 0;
+        for (char *tok = strtok(list, ","); tok; tok = strtok(NULL, ",")) {
+            while (*tok == ' ') tok++;
+            const Team *t = find_team(tok);
+            if (!t) { fprintf(stderr, "Error: no team with tag or name \"%s\" and a squad\n", tok); return false; }
+            if (config.num_teams == MAX_BATCH_TEAMS) { fprintf(stderr, "Error: at most %d teams\n", MAX_BATCH_TEAMS); return false; }
+            config.teams[config.num_teams++] = t;
+        }
+    } else if (strcmp(name, "format") == 0) {
+        if (strcasecmp(value, "T20") == 0) config.format = FORMAT_T20;
+        else if (strcasecmp(value, "ODI") == 0) config.format = FORMAT_ODI;
+        else if (strcasecmp(value, "Test") == 0) config.format = FORMAT_TEST;
+        else { fprintf(stderr, "Error: unknown format \"%s\"\n", value); return false; }
+    } else if (strcmp(name, "overs") == 0) {
+        config.overs = atoi(value);
+        if (config.overs < 1 || config.overs > SIM_MAX_OVERS) { fprintf(stderr, "Error: overs must be 1 to %d\n", SIM_MAX_OVERS); return false; }
+    } else if (strcmp(name, "matches") == 0) {
+        config.matches = atol(value);
+    } else if (strcmp(name, "tournaments") == 0) {
+        config.tournaments = atol(value);
+    } else if (strcmp(name, "seed") == 0) {
+        config.seed = (uint32_t)strtoul(value, NULL, 10);
+    } else if (strcmp(name, "threads") == 0) {
+        config.threads = atoi(value);
+    } else if (strcmp(name, "balls") == 0) {
+        config.balls = !value || strcmp(value, "false") != 0;
+    } else if (strcmp(name, "rain") == 0) {
+        config.rain = !value || strcmp(value, "false") != 0;
+    } else if (strcmp(name, "bowler") == 0) {
+        if (strcmp(value, "rotate") == 0) config.bowler = BOWLER_ROTATE;
+        else if (strcmp(value, "best") == 0) config.bowler = BOWLER_BEST;
+        else { fprintf(stderr, "Error: unknown bowler policy \"%s\"\n", value); return false; }
+    } else if (strcmp(name, "batsman") == 0) {
+        if (strcmp(value, "order") == 0) config.batsman = BATSMAN_ORDER;
+        else if (strcmp(value, "best") == 0) config.batsman = BATSMAN_BEST;
+        else { fprintf(stderr, "Error: unknown batsman policy \"%s\"\n", value); return false; }
+    } else if (strcmp(name, "runs") == 0) {
+        if (strcmp(value, "engine") == 0) config.runs = RUNS_ENGINE;
+        else if (strcmp(value, "singles") == 0) config.runs = RUNS_SINGLES;
+        else { fprintf(stderr, "Error: unknown runs policy \"%s\"\n", value); return false; }
+    } else if (strcmp(name, "field") == 0) {
+        config.field = -1;
+        for (int i = 0; i < FIELD_SETUP_COUNT; i++) if (strcasecmp(value, field_names[i]) == 0) config.field = i;
+        if (config.field < 0) { fprintf(stderr, "Error: unknown field setup \"%s\"\n", value); return false; }
+    } else if (strcmp(name, "compare") == 0) {
+        static const char *allowed[] = { "rain", "overs", "bowler", "batsman", "runs", "field" };
+        size_t len = strcspn(value, "=");
+        bool ok = false;
+        for (size_t i = 0; i < sizeof(allowed) / sizeof(allowed[0]); i++) {
+            if (strlen(allowed[i]) == len && strncmp(value, allowed[i], len) == 0) ok = true;
+        }
+        if (!ok) { fprintf(stderr, "Error: --compare takes rain, overs, bowler, batsman, runs or field, as NAME=VALUE\n"); return false; }
+        if (config.num_compare == MAX_COMPARE_OPTIONS) { fprintf(stderr, "Error: at most %d --compare options\n", MAX_COMPARE_OPTIONS); return false; }
+        config.compare[config.num_compare++] = strdup(value);
+    } else if (strcmp(name, "measure") == 0) {
+        if (strcmp(value, "runs") == 0) config.measure = MEASURE_RUNS;
+        else if (strcmp(value, "win") == 0) config.measure = MEASURE_WIN;
+        else if (strcmp(value, "margin") == 0) config.measure = MEASURE_MARGIN;
+        else { fprintf(stderr, "Error: unknown measure \"%s\"\n", value); return false; }
+    } else if (strcmp(name, "ci") == 0) {
+        config.ci = atof(value);
+        if (config.ci <= 0) { fprintf(stderr, "Error: --ci must be above 0\n"); return false; }
+    } else if (strcmp(name, "independent") == 0) {
+        config.independent = !value || strcmp(value, "false") != 0;
+    } else if (strcmp(name, "antithetic") == 0) {
+        config.antithetic = !value || strcmp(value, "false") != 0;
+    } else if (strcmp(name, "out") == 0) {
+        config.out_path = strdup(value);
+    } else if (strcmp(name, "ratings") == 0) {
+        config.ratings_path = strdup(value);
+    } else if (strcmp(name, "config") == 0) {
+        return load_config(value);
+    } else {
+        fprintf(stderr, "Error: unknown option \"%s\"\n", name);
+        return false;
+    }
+    return true;
+}
+
+static bool load_config(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "Error: cannot open config file %s\n", path);
+        return false;
+    }
+    char line[512];
+    int line_number = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), f)) {
+        line_number++;
+        char *hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+        char *name = line;
+        while (*name == ' ' || *name == '\t') name++;
+        char *end = name + strlen(name);
+        while (end > name && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t')) *--end = '\0';
+        if (!*name) continue;
+
+        char *value = strchr(name, '=');
+        if (value) {
+            char *name_end = value;
+            while (name_end > name && (name_end[-1] == ' ' || name_end[-1] == '\t')) name_end--;
+            *name_end = '\0';
+            for (value++; *value == ' ' || *value == '\t'; value++) { }
+        }
+        if (!set_option(name, value)) {
+            fprintf(stderr, "  in %s, line %d\n", path, line_number);
+            ok = false;
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    all_teams = load_teams(&num_all_teams);
+    if (!all_teams) {
+        fprintf(stderr, "Error: could not load Data/teams.dat, run from the repository root.\n");
+        return 1;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) { usage(stdout); return 0; }
+        if (strncmp(argv[i], "--", 2) != 0) { usage(stderr); return 2; }
+        const char *name = argv[i] + 2;
+        bool is_flag = strcmp(name, "balls") == 0 || strcmp(name, "rain") == 0 ||
+                       strcmp(name, "independent") == 0 || strcmp(name, "antithetic") == 0;
+        const char *value = (!is_flag && i + 1 < argc) ? argv[++i] : NULL;
+        if (!set_option(name, value)) return 2;
+    }
+    if (config.num_teams < 2) {
+        fprintf(stderr, "Error: --teams needs at least two teams\n");
+        usage(stderr);
+        return 2;
+    }
+
+    FILE *out = stdout;
+    if (config.out_path && !(out = fopen(config.out_path, "w"))) {
+        fprintf(stderr, "Error: cannot write %s\n", config.out_path);
+        return 1;
+    }
+    field_coverage_init();
+
+    if (config.num_compare > 0 || config.ci > 0) {
+        // The second scenario is the first with the --compare options applied over it
+        BatchConfig base = config;
+        for (int i = 0; i < config.num_compare; i++) {
+            char option[64];
+            snprintf(option, sizeof(option), "%s", base.compare[i]);
+            char *value = strchr(option, '=');
+            if (value) *value++ = '\0';
+            if (!set_option(option, value)) return 2;
+        }
+        scenarios[1] = config;
+        config = base;
+        scenarios[0] = config;
+
+        SimStudyConfig study = {
+            .num_scenarios = config.num_compare > 0 ? 2 : 1,
+            .seed = config.seed,
+            .common_random_numbers = !config.independent,
+            .antithetic = config.antithetic,
+            .half_width = config.ci,
+            .max_replicates = config.ci > 0 && config.matches <= 1 ? 1000000 : config.matches,
+        };
+        JobQueue *pool = job_queue_create(config.threads);
+        SimStudyResult result;
+        double start = now_seconds();
+        sim_study_run(pool, &study, study_match, NULL, &result);
+        double seconds = now_seconds() - start;
+        write_study(out, &study, &result);
+        fprintf(stderr, "%ld matches in %.2f s, estimate %.3f +/- %.3f\n", result.matches, seconds, result.estimate, result.half_width);
+        job_queue_destroy(pool);
+        free(all_teams);
+        if (out != stdout) fclose(out);
+        return 0;
+    }
+
+    // Every squad player is registered up front, so the workers only ever look ids up
+    ratings_init(&ratings);
+    if (config.ratings_path) {
+        ratings_load(&ratings, config.ratings_path);
+        for (int i = 0; i < config.num_teams; i++) ratings_add_team(&ratings, config.teams[i]);
+    }
+
+    bool tournaments = config.tournaments > 0;
+    long total = tournaments ? config.tournaments : config.matches;
+    JobFunc func = tournaments ? tournament_job : match_job;
+    JobQueue *pool = job_queue_create(config.threads);
+    int workers = config.threads > 0 ? config.threads : job_queue_cpu_count();
+    long window = (long)workers * JOBS_PER_WORKER;
+    Job *jobs = calloc((size_t)window, sizeof(Job));
+    if (!pool || !jobs) {
+        fprintf(stderr, "Error: out of memory\n");
+        return 1;
+    }
+
+    // Hand out a window of jobs, wait for all of it, then write it in order
+    double start = now_seconds();
+    for (long first = 0; first < total; first += window) {
+        long count = (total - first < window) ? total - first : window;
+        for (long i = 0; i < count; i++) {
+            jobs[i].index = first + i;
+            jobs[i].out.len = 0;
+            job_queue_push(pool, func, &jobs[i]);
+        }
+        job_queue_wait(pool);
+        for (long i = 0; i < count; i++) {
+            fwrite(jobs[i].out.data, 1, jobs[i].out.len, out);
+            ratings_apply(&ratings, &jobs[i].ratings);
+            jobs[i].ratings.count = 0;
+        }
+        if (fflush(out) != 0) break; // The reader went away
+    }
+    double seconds = now_seconds() - start;
+
+    int pairs = config.num_teams * (config.num_teams - 1) / 2;
+    long matches = tournaments ? total * pairs : total;
+    fprintf(stderr, "%ld matches in %.2f s (%.0f matches/s) on %d threads\n", matches, seconds, seconds > 0 ? matches / seconds : 0.0, workers);
+
+    if (config.ratings_path && !ratings_save(&ratings, config.ratings_path)) fprintf(stderr, "Error: cannot write %s\n", config.ratings_path);
+    ratings_free(&ratings);
+
+    job_queue_destroy(pool);
+    for (long i = 0; i < window; i++) {
+        free(jobs[i].out.data);
+        ratings_log_free(&jobs[i].ratings);
+    }
+    free(jobs);
+    free(all_teams);
+    if (out != stdout) fclose(out);
+    return 0;
+}
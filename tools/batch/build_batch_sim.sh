@@ -0,0 +1,12 @@
+#!/bin/sh
+# Builds the batch simulator, no raylib needed. Run it from the repository root so
+# Data/teams.dat is found:
+#
+#   sh tools/batch/build_batch_sim.sh && ./batch_sim --teams India,Austraila --matches 10
+
+set -e
+cd "$(dirname "$0")/../.."
+
+gcc tools/batch/batch_sim.c src/sim_engine.c src/sim_study.c src/points_table.c src/match.c src/ratings.c src/teams.c src/ui.c src/field_setups.c \
+    src/field_coverage.c src/job_queue.c src/live_feed.c \
+    -o batch_sim -I. -Isrc -Iinclude -std=gnu99 -O2 -Wall -Wextra -lm -lpthread
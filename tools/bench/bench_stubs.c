@@ -0,0 +1,55 @@
+// Stand-ins for the modules that need a GPU or an audio device. Flags still produce one
+// textured quad each, so the recorder sees the same texture switches the real atlas causes.
+
+#include <stddef.h>
+#include "gfx.h"
+#include "flag_atlas.h"
+#include "audio_cache.h"
+
+#define BENCH_FLAG_TEXTURE_ID 2 // Anything but the default font's texture
+
+// gui.c's own main refers to this; the bench never runs it
+const GfxBackend gfx_raylib_backend = { .name = "raylib (not linked)" };
+
+void flag_atlas_start_loading(const char *directory) { (void)directory; }
+bool flag_atlas_update(void) { return true; }
+bool flag_atlas_is_ready(void) { return true; }
+bool flag_atlas_is_loading(void) { return false; }
+bool flag_atlas_finish(void) { return true; }
+void flag_atlas_unload(void) { }
+
+bool flag_atlas_lookup(const char *team_name, Rectangle *source) {
+    if (team_name == NULL || team_name[0] == '\0') return false;
+    if (source) *source = (Rectangle){ 0, 0, 144, FLAG_ATLAS_CELL_HEIGHT };
+    return true;
+}
+
+Texture2D flag_atlas_texture(void) {
+    return (Texture2D){ .id = BENCH_FLAG_TEXTURE_ID, .width = FLAG_ATLAS_WIDTH, .height = FLAG_ATLAS_WIDTH, .mipmaps = 1 };
+}
+
+bool flag_atlas_draw(const char *team_name, Rectangle dest, Color tint) {
+    Rectangle source;
+    if (!flag_atlas_lookup(team_name, &source)) return false;
+    GfxDrawTexturePro(flag_atlas_texture(), source, dest, tint);
+    return true;
+}
+
+bool audio_cache_load(CachedWave *cached, const char *source_path) {
+    (void)source_path;
+    *cached = (CachedWave){ 0 };
+    return false;
+}
+
+void audio_cache_release(CachedWave *cached) { (void)cached; }
+
+AudioClip audio_clip_create(CachedWave *cached, bool allow_streaming) {
+    (void)cached; (void)allow_streaming;
+    return (AudioClip){ 0 };
+}
+
+void audio_clip_play(AudioClip *clip) { (void)clip; }
+void audio_clip_stop(AudioClip *clip) { (void)clip; }
+bool audio_clip_is_playing(AudioClip *clip) { (void)clip; return false; }
+void audio_clip_update(AudioClip *clip) { (void)clip; }
+void audio_clip_unload(AudioClip *clip) { (void)clip; }
@@ -0,0 +1,15 @@
+#!/bin/sh
+# Builds the headless GUI benchmark. Needs only a C compiler, no raylib, window or GPU.
+# Run it from the repository root so the Data/ files are found:
+#
+#   sh tools/bench/build_bench.sh && ./gui_bench
+
+set -e
+cd "$(dirname "$0")/../.."
+
+gcc tools/bench/gui_bench.c tools/bench/headless_platform.c tools/bench/bench_stubs.c \
+    src/accounts.c src/teams.c src/match.c src/ratings.c src/tournament.c src/points_table.c src/tournament_format.c src/history.c src/ui.c src/field_setups.c \
+    "src/Play Match/toss.c" src/grounds.c src/umpires.c src/search_index.c src/job_queue.c src/lod.c \
+    src/field_coverage.c src/text_cache.c src/figure_batch.c src/gfx.c src/gfx_recorder.c src/sim_engine.c src/sim_service.c src/qualification.c src/match_scheduler.c src/live_feed.c \
+    src/replica.c src/spectator.c \
+    -o gui_bench -I. -Isrc -Iinclude -Itools/bench -std=gnu99 -O2 -Wall -Wextra -lm -lpthread
@@ -0,0 +1,12 @@
+#!/bin/sh
+# Builds the match scheduler load test, no raylib needed. Run it from the repository root so
+# Data/teams.dat is found:
+#
+#   sh tools/bench/build_scheduler_bench.sh && ./scheduler_bench --matches 10000 --workers 4
+
+set -e
+cd "$(dirname "$0")/../.."
+
+gcc tools/bench/scheduler_bench.c src/match_scheduler.c src/sim_engine.c src/match.c src/ratings.c src/teams.c src/ui.c src/field_setups.c \
+    src/field_coverage.c src/job_queue.c src/live_feed.c \
+    -o scheduler_bench -I. -Isrc -Iinclude -std=gnu99 -O2 -Wall -Wextra -lm -lpthread
@@ -0,0 +1,175 @@
+// Headless GUI benchmark.
+// Drives every GameScreen with scripted input on the recording Gfx backend and checks the
+// per-frame draw cost against a budget. Runs on any CPU-only box, no window or GPU needed.
+//
+//   ./gui_bench [--frames N] [--trace file]
+//
+// Exits with 1 if any screen goes over its budget.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The screens are static functions in gui.c, so it is compiled into the bench directly
+#define main gui_main
+#include "../../src/gui.c"
+#undef main
+
+#include "gfx_recorder.h"
+#include "headless_platform.h"
+
+typedef struct {
+    GameScreen screen;
+    const char *name;
+    int max_draw_calls;     // Per frame
+    int max_vertices;       // Per frame
+    int max_glyphs;         // Per frame
+} ScreenBudget;
+
+// Budgets sit a little above what the screens cost today; raise them deliberately
+static const ScreenBudget budgets[] = {
+    { SCREEN_LOGIN,         "login",         4,    400,  100 },
+    { SCREEN_REGISTER,      "register",      4,    400,  100 },
+    { SCREEN_MAIN_MENU,     "main_menu",     4,    600,  150 },
+    { SCREEN_ADMIN_MENU,    "admin_menu",    4,    400,  100 },
+    { SCREEN_TEAMS,         "teams",         6,   2000,  400 },
+    { SCREEN_UMPIRES,       "umpires",      10,   3500,  800 },
+    { SCREEN_GROUNDS,       "grounds",      10,  11500, 2800 },
+    { SCREEN_MANAGE_USERS,  "manage_users",  6,   1800,  420 },
+    { SCREEN_MATCH_SETUP,   "match_setup",   4,    800,  200 },
+    { SCREEN_WC_SETUP,      "wc_setup",      4,   1600,  380 },
+    { SCREEN_HISTORY,       "history",       4,    200,   50 },
+    { SCREEN_RANKINGS,      "rankings",      4,   5000, 1300 }, // Room for full team and player columns
+    { SCREEN_GAMEPLAY,      "gameplay",     16, 130000,  320 },
+    { SCREEN_SPECTATE,      "spectate",     16, 130000,  320 }, // Follows the gameplay run over loopback
+};
+
+#define NUM_BUDGETS (int)(sizeof(budgets) / sizeof(budgets[0]))
+
+typedef struct {
+    int frames;
+    int max_draw_calls;
+    int max_vertices;
+    int max_glyphs;
+    long long total_draw_calls;
+    const char *left_to;    // Set if the script made the screen switch away
+} ScreenResult;
+
+// Input for frame f of a screen's run: sweep the mouse across the window, scroll the wheel
+// down and back up, and press keys that only move focus. No clicks, so the screen stays put.
+static void scripted_input(int f, int frames) {
+    HeadlessInput input = { 0 };
+    float t = (float)f / (frames > 1 ? frames - 1 : 1);
+    input.mouse = (Vector2){ 40 + t * (HEADLESS_SCREEN_WIDTH - 80), 120 + (f % 40) * 12.0f };
+    if (f >= frames / 4 && f < frames / 2) input.wheel = -1.0f;
+    else if (f >= frames / 2 && f < frames * 3 / 4) input.wheel = 1.0f;
+    if (f % 30 == 15) input.key_pressed = KEY_TAB;
+    headless_set_input(&input);
+}
+
+static void reset_gameplay(GameState *gameState) {
+    gameState->striker_idx = 0;
+    gameState->non_striker_idx = 1;
+    gameState->bowler_idx = gameState->bowling_team->num_players - 1;
+    gameState->awaiting_bowler_selection = false;
+    gameState->awaiting_batsman_selection = false;
+    gameState->gameplay_mode = GAMEPLAY_MODE_PLAYING;
+}
+
+static ScreenResult run_screen(const ScreenBudget *budget, int frames, GameState *gameState, GameSounds *sounds) {
+    ScreenResult result = { 0 };
+    GuiState guiState = { 0 };
+    guiState.currentScreen = budget->screen;
+    guiState.previousScreen = SCREEN_MAIN_MENU;
+    guiState.userType = USER_TYPE_ADMIN;
+    strcpy(guiState.userName, "bench");
+    strcpy(guiState.userEmail, "bench@example.com");
+    if (budget->screen == SCREEN_GAMEPLAY) reset_gameplay(gameState);
+
+    gfx_recorder_set_label(budget->name);
+    for (int f = 0; f < frames; f++) {
+        scripted_input(f, frames);
+        lod_update(1.0f / 60.0f);
+        figure_batch_set_detail(lod_settings()->figure_detail);
+
+        spectator_host_poll(spectatorHost);
+        UpdateDrawCurrentScreen(&guiState, gameState, sounds);
+        headless_end_frame();
+
+        GfxFrameStats stats = gfx_recorder_last_frame();
+        result.frames++;
+        result.total_draw_calls += stats.draw_calls;
+        if (stats.draw_calls > result.max_draw_calls) result.max_draw_calls = stats.draw_calls;
+        if (stats.vertices > result.max_vertices) result.max_vertices = stats.vertices;
+        if (stats.glyphs > result.max_glyphs) result.max_glyphs = stats.glyphs;
+
+        if (guiState.currentScreen != budget->screen) {
+            result.left_to = "another screen";
+            break;
+        }
+    }
+    return result;
+}
+
+int main(int argc, char **argv) {
+    int frames = 240;
+    FILE *trace = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace = fopen(argv[++i], "w");
+            if (!trace) {
+                fprintf(stderr, "Cannot open trace file %s\n", argv[i]);
+                return 2;
+            }
+        } else {
+            fprintf(stderr, "Usage: %s [--frames N] [--trace file]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (frames < 1) frames = 1;
+
+    headless_init();
+    gfx_set_backend(&gfx_recorder_backend);
+    gfx_recorder_start(trace);
+    lod_init(60);
+    field_coverage_init();
+    InitializeAudience();
+
+    GameState gameState = { 0 };
+    Team teamA, teamB;
+    initialize_dummy_teams(&teamA, &teamB);
+    gameState.batting_team = &teamA;
+    gameState.bowling_team = &teamB;
+    gameState.max_overs = 50;
+    gameState.fielding_setup = PP_AGGRESSIVE;
+    gameState.inning_num = 1;
+    GameSounds sounds = { 0 }; // Audio is stubbed out, the clips stay empty
+
+    // The gameplay run hosts and the spectate run watches it. If the port is taken the
+    // spectate screen is measured in its "Connecting" state instead.
+    spectatorHost = spectator_host_start(SPECTATOR_DEFAULT_PORT + 1);
+    spectatorViewer = spectator_viewer_create("127.0.0.1", SPECTATOR_DEFAULT_PORT + 1);
+
+    bool failed = false;
+    printf("%-14s %7s %9s %9s %9s %9s  %s\n", "screen", "frames", "avg_draws", "max_draws", "max_verts", "max_glyph", "result");
+    for (int i = 0; i < NUM_BUDGETS; i++) {
+        const ScreenBudget *budget = &budgets[i];
+        ScreenResult result = run_screen(budget, frames, &gameState, &sounds);
+
+        bool over = result.max_draw_calls > budget->max_draw_calls ||
+                    result.max_vertices > budget->max_vertices ||
+                    result.max_glyphs > budget->max_glyphs;
+        failed = failed || over;
+        printf("%-14s %7d %9.1f %9d %9d %9d  %s%s\n", budget->name, result.frames,
+               result.frames ? (double)result.total_draw_calls / result.frames : 0.0,
+               result.max_draw_calls, result.max_vertices, result.max_glyphs,
+               over ? "OVER BUDGET" : "ok",
+               result.left_to ? " (left screen early)" : "");
+    }
+
+    spectator_viewer_destroy(spectatorViewer);
+    spectator_host_stop(spectatorHost);
+    if (trace) fclose(trace);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,187 @@
+#include "headless_platform.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define RAYMATH_IMPLEMENTATION
+#include "raymath.h"
+
+// Synthetic default font: same glyph range and base size as raylib's, every glyph 5x10
+#define FONT_FIRST_CHAR 32
+#define FONT_GLYPH_COUNT 224
+#define FONT_BASE_SIZE 10
+#define FONT_GLYPH_WIDTH 5
+
+static double now = 0.0;
+static HeadlessInput input = { 0 };
+static Vector2 previous_mouse = { 0 };
+static int pending_char = 0;
+
+static GlyphInfo font_glyphs[FONT_GLYPH_COUNT];
+static Rectangle font_recs[FONT_GLYPH_COUNT];
+static Font font = { 0 };
+
+void headless_init(void) {
+    now = 0.0;
+    memset(&input, 0, sizeof(input));
+    previous_mouse = (Vector2){ 0 };
+
+    for (int i = 0; i < FONT_GLYPH_COUNT; i++) {
+        font_glyphs[i] = (GlyphInfo){ .value = FONT_FIRST_CHAR + i };
+        font_recs[i] = (Rectangle){ (float)((i % 32) * FONT_GLYPH_WIDTH), (float)((i / 32) * FONT_BASE_SIZE), FONT_GLYPH_WIDTH, FONT_BASE_SIZE };
+    }
+    font.baseSize = FONT_BASE_SIZE;
+    font.glyphCount = FONT_GLYPH_COUNT;
+    font.glyphPadding = 0;
+    font.texture = (Texture2D){ .id = 1, .width = 32 * FONT_GLYPH_WIDTH, .height = 7 * FONT_BASE_SIZE, .mipmaps = 1 };
+    font.recs = font_recs;
+    font.glyphs = font_glyphs;
+}
+
+void headless_set_input(const HeadlessInput *next) {
+    previous_mouse = input.mouse;
+    input = *next;
+    pending_char = 0;
+}
+
+void headless_end_frame(void) {
+    now += HEADLESS_FRAME_TIME;
+}
+
+// Window and timing
+
+void InitWindow(int width, int height, const char *title) { (void)width; (void)height; (void)title; }
+void CloseWindow(void) { }
+bool WindowShouldClose(void) { return true; }
+void SetConfigFlags(unsigned int flags) { (void)flags; }
+void SetTargetFPS(int fps) { (void)fps; }
+int GetScreenWidth(void) { return HEADLESS_SCREEN_WIDTH; }
+int GetScreenHeight(void) { return HEADLESS_SCREEN_HEIGHT; }
+float GetFrameTime(void) { return HEADLESS_FRAME_TIME; }
+double GetTime(void) { return now; }
+void InitAudioDevice(void) { }
+void CloseAudioDevice(void) { }
+
+// Input
+
+Vector2 GetMousePosition(void) { return input.mouse; }
+Vector2 GetMouseDelta(void) { return Vector2Subtract(input.mouse, previous_mouse); }
+float GetMouseWheelMove(void) { return input.wheel; }
+bool IsMouseButtonDown(int button) { return button == MOUSE_BUTTON_LEFT && input.mouse_down; }
+bool IsMouseButtonPressed(int button) { return button == MOUSE_BUTTON_LEFT && input.mouse_pressed; }
+bool IsMouseButtonReleased(int button) { (void)button; return false; }
+bool IsKeyDown(int key) { return key != 0 && key == input.key_pressed; }
+bool IsKeyPressed(int key) { return key != 0 && key == input.key_pressed; }
+int GetCharPressed(void) { return pending_char; } // The script never types
+
+// Shapes and colors
+
+bool CheckCollisionPointRec(Vector2 point, Rectangle rec) {
+    return point.x >= rec.x && point.x < rec.x + rec.width && point.y >= rec.y && point.y < rec.y + rec.height;
+}
+
+bool CheckCollisionPointCircle(Vector2 point, Vector2 center, float radius) {
+    return Vector2Distance(point, center) <= radius;
+}
+
+Color Fade(Color color, float alpha) {
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+    color.a = (unsigned char)(255.0f * alpha);
+    return color;
+}
+
+// Fixed seed so every run draws the same crowd flashes and toss
+int GetRandomValue(int min, int max) {
+    static unsigned int state = 0x2545F491u;
+    if (min > max) { int tmp = max; max = min; min = tmp; }
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return min + (int)(state % (unsigned int)(max - min + 1));
+}
+
+// Files
+
+bool FileExists(const char *fileName) {
+    struct stat info;
+    return stat(fileName, &info) == 0;
+}
+
+int GetFileLength(const char *fileName) {
+    struct stat info;
+    return (stat(fileName, &info) == 0) ? (int)info.st_size : 0;
+}
+
+// Text
+
+Font GetFontDefault(void) { return font; }
+
+int GetGlyphIndex(Font f, int codepoint) {
+    int index = codepoint - FONT_FIRST_CHAR;
+    return (index >= 0 && index < f.glyphCount) ? index : '?' - FONT_FIRST_CHAR;
+}
+
+// Decodes one UTF-8 codepoint, like raylib does
+int GetCodepointNext(const char *text, int *codepointSize) {
+    const unsigned char *p = (const unsigned char*)text;
+    *codepointSize = 1;
+    if (p[0] < 0x80) return p[0];
+    if ((p[0] & 0xE0) == 0xC0 && (p[1] & 0xC0) == 0x80) {
+        *codepointSize = 2;
+        return ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+    }
+    if ((p[0] & 0xF0) == 0xE0 && (p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80) {
+        *codepointSize = 3;
+        return ((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+    }
+    if ((p[0] & 0xF8) == 0xF0 && (p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80 && (p[3] & 0xC0) == 0x80) {
+        *codepointSize = 4;
+        return ((p[0] & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+    }
+    return '?';
+}
+
+// Same rule as raylib with the default font: glyph widths scaled to the size, spacing size/10, widest line wins
+int MeasureText(const char *text, int fontSize) {
+    if (text == NULL || text[0] == '\0') return 0;
+    if (fontSize < FONT_BASE_SIZE) fontSize = FONT_BASE_SIZE;
+    float scale = (float)fontSize / FONT_BASE_SIZE;
+    float spacing = (float)fontSize / FONT_BASE_SIZE;
+    float widest = 0.0f;
+    float width = 0.0f;
+    int line_glyphs = 0;
+    for (int i = 0; text[i] != '\0'; ) {
+        int size = 0;
+        int codepoint = GetCodepointNext(&text[i], &size);
+        i += size;
+        if (codepoint == '\n') {
+            if (line_glyphs > 0) width -= spacing;
+            if (width > widest) widest = width;
+            width = 0.0f;
+            line_glyphs = 0;
+            continue;
+        }
+        width += FONT_GLYPH_WIDTH * scale + spacing;
+        line_glyphs++;
+    }
+    if (line_glyphs > 0) width -= spacing;
+    if (width > widest) widest = width;
+    return (int)widest;
+}
+
+// Rotating static buffers, so a few results can be alive at once like in raylib
+const char *TextFormat(const char *text, ...) {
+    static char buffers[4][1024];
+    static int next = 0;
+    char *buffer = buffers[next];
+    next = (next + 1) % 4;
+
+    va_list args;
+    va_start(args, text);
+    vsnprintf(buffer, sizeof(buffers[0]), text, args);
+    va_end(args);
+    return buffer;
+}
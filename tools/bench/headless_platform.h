@@ -0,0 +1,27 @@
+#ifndef HEADLESS_PLATFORM_H
+#define HEADLESS_PLATFORM_H
+
+#include "raylib.h"
+
+// Stand-in for the raylib window, input and timing functions, so the GUI code runs without a
+// window. Nothing is drawn: drawing goes through the Gfx layer, which the bench points at the
+// recorder.
+
+#define HEADLESS_SCREEN_WIDTH 1280
+#define HEADLESS_SCREEN_HEIGHT 720
+#define HEADLESS_FRAME_TIME (1.0f/60.0f)
+
+// Input seen by the GUI during the next frame
+typedef struct {
+    Vector2 mouse;
+    float wheel;
+    int key_pressed;    // One key reported by IsKeyPressed/GetKeyPressed, 0 for none
+    bool mouse_down;    // Left button held
+    bool mouse_pressed; // Left button went down this frame
+} HeadlessInput;
+
+void headless_init(void);
+void headless_set_input(const HeadlessInput *input);
+void headless_end_frame(void); // Advances the clock by one frame
+
+#endif // HEADLESS_PLATFORM_H
@@ -0,0 +1,225 @@
+// Load test for match_scheduler: opens many interactive matches on a small worker pool, plays
+// every one of them to the end with a bot answering each question as it is asked, and reports
+// what the suspended matches cost and how long one resume takes.
+//
+//   sh tools/bench/build_scheduler_bench.sh
+//   ./scheduler_bench --matches 10000 --workers 4
+//
+// Three phases:
+//   open     every match is opened and left waiting for its toss call; time and resident memory
+//   play     the bot answers from the notify callback, so all matches are in flight at once
+//   resume   one match at a time, submit to the next suspension timed from the main thread
+//
+// Resident memory is read from /proc/self/statm and shown as "n/a" where there is none.
+// Run it from the repository root so Data/teams.dat is found.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "match_scheduler.h"
+#include "sim_engine.h"
+#include "field_coverage.h"
+#include "job_queue.h"
+#include "teams.h"
+
+#define DEFAULT_MATCHES 10000
+#define DEFAULT_WORKERS 4
+#define DEFAULT_OVERS 20
+#define RESUME_MATCHES 20               // Matches played one resume at a time for the latency phase
+
+typedef struct {
+    MatchScheduler *sched;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    bool serial;                        // Resume phase: the main thread answers, not the callback
+    int finished;
+    long resumes;
+    MatchView last;                     // Serial only: the view of the latest suspension
+    uint32_t last_version;
+} Bench;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long resident_kb(void) {
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f) return -1;
+    long size = 0, resident = 0;
+    int read = fscanf(f, "%ld %ld", &size, &resident);
+    fclose(f);
+    return read == 2 ? resident * (sysconf(_SC_PAGESIZE) / 1024) : -1;
+}
+
+static void choose_bowler(const SimMatch *match, void *user) {
+    *(int*)user = sim_choose_bowler(&match->state);
+}
+
+static void choose_batsman(const SimMatch *match, void *user) {
+    *(int*)user = sim_choose_batsman(&match->state);
+}
+
+// What the bot answers to whatever the match is waiting for; false once it is finished
+static bool answer(MatchScheduler *sched, int id, const MatchView *view) {
+    int value = 0;
+    switch (view->wait) {
+        case MATCH_WAIT_TOSS_CALL:
+        case MATCH_WAIT_TOSS_CHOICE:
+            value = 0; // Heads, then bat
+            break;
+        case MATCH_WAIT_BOWLER:
+            if (!match_scheduler_inspect(sched, id, choose_bowler, &value)) return false;
+            break;
+        case MATCH_WAIT_BATSMAN:
+            if (!match_scheduler_inspect(sched, id, choose_batsman, &value)) return false;
+            break;
+        case MATCH_WAIT_RUNS:
+            value = view->suggested_runs;
+            break;
+        default:
+            return false;
+    }
+    return match_scheduler_submit(sched, id, view->wait, value);
+}
+
+static void on_suspend(int id, const MatchView *view, void *user) {
+    Bench *bench = (Bench*)user;
+    pthread_mutex_lock(&bench->lock);
+    bench->resumes++;
+    bool serial = bench->serial;
+    if (serial) {
+        bench->last = *view;
+        bench->last_version++;
+    }
+    if (view->wait == MATCH_WAIT_FINISHED) bench->finished++;
+    pthread_cond_broadcast(&bench->changed);
+    pthread_mutex_unlock(&bench->lock);
+
+    if (!serial && view->wait != MATCH_WAIT_FINISHED) answer(bench->sched, id, view);
+}
+
+static void usage(FILE *f) {
+    fprintf(f, "Usage: scheduler_bench [--matches N] [--workers N] [--overs N]\n");
+}
+
+static const Team* find_squad(const Team *teams, int num_teams, const Team *other) {
+    for (int i = 0; i < num_teams; i++) {
+        if (&teams[i] != other && teams[i].num_players >= 11) return &teams[i];
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int matches = DEFAULT_MATCHES;
+    int workers = DEFAULT_WORKERS;
+    int overs = DEFAULT_OVERS;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) { usage(stdout); return 0; }
+        if (i + 1 >= argc) { usage(stderr); return 2; }
+        if (strcmp(argv[i], "--matches") == 0) matches = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--workers") == 0) workers = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--overs") == 0) overs = atoi(argv[++i]);
+        else { usage(stderr); return 2; }
+    }
+    if (matches < 1 || workers < 1 || overs < 1) { usage(stderr); return 2; }
+
+    int num_teams = 0;
+    Team *teams = load_teams(&num_teams);
+    const Team *team_a = teams ? find_squad(teams, num_teams, NULL) : NULL;
+    const Team *team_b = team_a ? find_squad(teams, num_teams, team_a) : NULL;
+    if (!team_b) {
+        fprintf(stderr, "Error: Data/teams.dat needs two squads of eleven, run from the repository root.\n");
+        free(teams);
+        return 1;
+    }
+    field_coverage_init();
+
+    Bench bench = { 0 };
+    pthread_mutex_init(&bench.lock, NULL);
+    pthread_cond_init(&bench.changed, NULL);
+    JobQueue *pool = job_queue_create(workers);
+    bench.sched = match_scheduler_create(pool, on_suspend, &bench);
+    int *ids = malloc(matches * sizeof(int));
+    if (!pool || !bench.sched || !ids) {
+        fprintf(stderr, "Error: out of memory\n");
+        return 1;
+    }
+    printf("%s v %s, %d overs, %d workers\n", team_a->name, team_b->name, overs, workers);
+
+    // Open: every match waits on its toss call, nothing runs
+    long rss_before = resident_kb();
+    double start = now_seconds();
+    for (int i = 0; i < matches; i++) {
+        ids[i] = match_scheduler_open(bench.sched, team_a, team_b, overs, 1u + (uint32_t)i, 0);
+        if (ids[i] < 0) {
+            fprintf(stderr, "Error: out of memory after %d matches\n", i);
+            return 1;
+        }
+    }
+    double open_seconds = now_seconds() - start;
+    long rss_after = resident_kb();
+    printf("open     %d matches in %.1f ms", matches, open_seconds * 1000);
+    if (rss_before >= 0 && rss_after >= 0) {
+        printf(", %.1f MB resident, %.1f KB per match\n", (rss_after - rss_before) / 1024.0, (double)(rss_after - rss_before) / matches);
+    } else {
+        printf(", resident memory n/a\n");
+    }
+
+    // Play: the callback answers every question, so the pool always has work queued
+    start = now_seconds();
+    for (int i = 0; i < matches; i++) match_scheduler_submit(bench.sched, ids[i], MATCH_WAIT_TOSS_CALL, 0);
+    pthread_mutex_lock(&bench.lock);
+    while (bench.finished < matches) pthread_cond_wait(&bench.changed, &bench.lock);
+    long resumes = bench.resumes;
+    pthread_mutex_unlock(&bench.lock);
+    double play_seconds = now_seconds() - start;
+    printf("play     %d matches finished, %ld resumes in %.2f s (%.0f resumes/s)\n",
+           matches, resumes, play_seconds, play_seconds > 0 ? resumes / play_seconds : 0.0);
+    for (int i = 0; i < matches; i++) match_scheduler_close(bench.sched, ids[i]);
+
+    // Resume: one question in flight, answered from here, timed from submit to the next suspension
+    pthread_mutex_lock(&bench.lock);
+    bench.serial = true;
+    pthread_mutex_unlock(&bench.lock);
+    double total = 0, worst = 0;
+    long timed = 0;
+    for (int m = 0; m < RESUME_MATCHES; m++) {
+        int id = match_scheduler_open(bench.sched, team_a, team_b, overs, 0x5EED0000u + (uint32_t)m, 0);
+        MatchView view;
+        match_scheduler_view(bench.sched, id, &view);
+        while (view.wait != MATCH_WAIT_FINISHED) {
+            pthread_mutex_lock(&bench.lock);
+            uint32_t version = bench.last_version;
+            pthread_mutex_unlock(&bench.lock);
+
+            double submitted = now_seconds();
+            if (!answer(bench.sched, id, &view)) break;
+            pthread_mutex_lock(&bench.lock);
+            while (bench.last_version == version) pthread_cond_wait(&bench.changed, &bench.lock);
+            view = bench.last;
+            pthread_mutex_unlock(&bench.lock);
+            double took = now_seconds() - submitted;
+
+            total += took;
+            if (took > worst) worst = took;
+            timed++;
+        }
+        match_scheduler_close(bench.sched, id);
+    }
+    printf("resume   %ld resumes over %d matches, mean %.1f us, worst %.1f us\n",
+           timed, RESUME_MATCHES, timed ? total / timed * 1e6 : 0.0, worst * 1e6);
+
+    match_scheduler_destroy(bench.sched);
+    job_queue_destroy(pool);
+    pthread_mutex_destroy(&bench.lock);
+    pthread_cond_destroy(&bench.changed);
+    free(ids);
+    free(teams);
+    return 0;
+}
@@ -0,0 +1,9 @@
+#!/bin/sh
+# Builds the live feed tail tool. Start it before or during a match in the game or the CLI:
+#
+#   sh tools/live_feed/build_live_tail.sh && ./live_tail
+
+set -e
+cd "$(dirname "$0")/../.."
+
+gcc tools/live_feed/live_tail.c src/live_feed.c -o live_tail -Isrc -std=gnu99 -O2 -Wall -Wextra
@@ -0,0 +1,80 @@
+// Follows the game's live feed like `tail -f`: one line per ball, with the score after it.
+//
+//   ./live_tail [-a]      -a starts with the oldest ball still in the feed instead of the next one
+//
+// A template for scoreboard and overlay tools: they only need live_feed.h and live_feed.c.
+
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#define sleep_ms(ms) Sleep(ms)
+#else
+#include <time.h>
+static void sleep_ms(int ms) {
+    struct timespec ts = { ms / 1000, (ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+#endif
+#include "live_feed.h"
+
+#define POLL_MS 20
+
+// Same order as BallOutcomeType in match.h
+static const char *outcome_names[] = { "dot", "runs", "WICKET", "wide", "no ball", "bye", "leg bye" };
+
+static void print_ball(const LiveBall *b) {
+    char what[96];
+    int outcome = (b->outcome >= 0 && b->outcome < 7) ? b->outcome : 0;
+    if (outcome == 2) {
+        snprintf(what, sizeof(what), "OUT %s%s%s", b->dismissal, b->fielder[0] ? " by " : "", b->fielder);
+    } else if (outcome == 1) {
+        snprintf(what, sizeof(what), "%d run%s%s", b->runs, b->runs == 1 ? "" : "s", (b->runs == 4 || b->runs == 6) ? "!" : "");
+    } else {
+        snprintf(what, sizeof(what), "%s", outcome_names[outcome]);
+    }
+
+    printf("%2d.%d  %-16s to %-16s %-28s %s %d/%d (%d.%d of %d)", b->over, b->ball, b->bowler, b->batsman, what,
+           b->batting_team, b->total_runs, b->wickets, b->balls_bowled / 6, b->balls_bowled % 6, b->max_overs);
+    if (b->target > 0) printf("  need %d", b->target - b->total_runs);
+    printf("\n");
+}
+
+int main(int argc, char **argv) {
+    bool from_start = (argc > 1 && strcmp(argv[1], "-a") == 0);
+    LiveFeedReader reader;
+
+    while (!live_feed_reader_open(&reader, from_start)) {
+        static bool said = false;
+        if (!said) fprintf(stderr, "Waiting for a match to start...\n");
+        said = true;
+        sleep_ms(500);
+    }
+
+    char innings[sizeof(((LiveBall*)0)->match_id) + 2 * LIVE_FEED_TEXT_LEN + 16] = "";
+    uint64_t dropped = 0;
+    for (;;) {
+        const LiveBall *b = live_feed_peek(&reader);
+        if (!b) {
+            fflush(stdout);
+            sleep_ms(POLL_MS);
+            continue;
+        }
+
+        // Read in place; only print once the slot is known to be intact
+        LiveBall ball = *b;
+        if (!live_feed_done(&reader)) continue;
+
+        if (reader.dropped != dropped) {
+            printf("... %llu balls missed\n", (unsigned long long)(reader.dropped - dropped));
+            dropped = reader.dropped;
+        }
+        char key[sizeof(innings)];
+        snprintf(key, sizeof(key), "%s|%s|%s|%d", ball.match_id, ball.batting_team, ball.bowling_team, (int)ball.inning_num);
+        if (strcmp(key, innings) != 0) {
+            printf("\n--- %s batting, %s bowling, innings %d ---\n", ball.batting_team, ball.bowling_team, (int)ball.inning_num);
+            strcpy(innings, key);
+        }
+        print_ball(&ball);
+    }
+}
@@ -0,0 +1,14 @@
+#!/bin/sh
+# Builds the local simulation server and its load generator. Linux only (epoll, eventfd),
+# no raylib needed. Run the server from the repository root so Data/teams.dat is found:
+#
+#   sh tools/sim_server/build_sim_server.sh && ./sim_server &
+#   ./sim_client -n 20000
+
+set -e
+cd "$(dirname "$0")/../.."
+
+gcc tools/sim_server/sim_server.c src/sim_engine.c src/match.c src/ratings.c src/teams.c src/ui.c src/field_setups.c \
+    src/field_coverage.c src/job_queue.c src/live_feed.c \
+    -o sim_server -I. -Isrc -Iinclude -Itools/sim_server -std=gnu99 -O2 -Wall -Wextra -lm -lpthread
+gcc tools/sim_server/sim_client.c -o sim_client -I. -Isrc -Iinclude -Itools/sim_server -std=gnu99 -O2 -Wall -Wextra
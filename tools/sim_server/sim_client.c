@@ -0,0 +1,154 @@
+// Load generator and probe for sim_server. Keeps a window of match requests in flight on one
+// connection, reports how many it got through per second, then asks the server for its stats.
+//
+//   ./sim_client [-s socket_path] [-n requests] [-w window] [-a team] [-b team] [-f T20|ODI|Test]
+//                [--rain] [--stream] [--json]
+//
+// --json sends newline-delimited JSON instead of binary frames and prints the replies.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "sim_protocol.h"
+#include "match.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool send_all(int fd, const void *data, size_t len) {
+    const uint8_t *p = data;
+    while (len > 0) {
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *socket_path = SIM_PROTOCOL_SOCKET;
+    const char *team_a = "India", *team_b = "Austraila", *format_name = "T20";
+    int requests = 10000, window = 256;
+    uint8_t flags = 0;
+    bool json = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) socket_path = argv[++i];
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) requests = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) window = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) team_a = argv[++i];
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) team_b = argv[++i];
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) format_name = argv[++i];
+        else if (strcmp(argv[i], "--rain") == 0) flags |= SIM_FLAG_RAIN;
+        else if (strcmp(argv[i], "--stream") == 0) flags |= SIM_FLAG_STREAM;
+        else if (strcmp(argv[i], "--json") == 0) json = true;
+        else { fprintf(stderr, "usage: see the top of sim_client.c\n"); return 2; }
+    }
+    if (window < 1) window = 1;
+    uint8_t format = strcasecmp(format_name, "ODI") == 0 ? FORMAT_ODI : strcasecmp(format_name, "Test") == 0 ? FORMAT_TEST : FORMAT_T20;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        fprintf(stderr, "Error: could not connect to %s, is sim_server running?\n", socket_path);
+        return 1;
+    }
+
+    size_t cap = 1 << 16, len = 0;
+    uint8_t *in = malloc(cap);
+    int sent = 0, results = 0, balls = 0, failed = 0;
+    double start = now_seconds();
+
+    while (results < requests) {
+        // Top the window up
+        uint8_t out[64 * 1024];
+        size_t out_len = 0;
+        while (sent < requests && sent - results < window && out_len + 256 < sizeof(out)) {
+            if (json) {
+                out_len += (size_t)snprintf((char*)out + out_len, sizeof(out) - out_len,
+                                            "{\"id\":%d,\"a\":\"%s\",\"b\":\"%s\",\"format\":%d,\"seed\":%d,\"rain\":%s,\"stream\":%s}\n",
+                                            sent, team_a, team_b, format, sent + 1, (flags & SIM_FLAG_RAIN) ? "true" : "false",
+                                            (flags & SIM_FLAG_STREAM) ? "true" : "false");
+            } else {
+                out_len += (size_t)sim_encode_match(out + out_len, (uint32_t)sent, team_a, team_b, format, flags, (uint32_t)sent + 1);
+            }
+            sent++;
+        }
+        if (out_len > 0 && !send_all(fd, out, out_len)) break;
+
+        if (len == cap) in = realloc(in, cap *= 2);
+        ssize_t n = recv(fd, in + len, cap - len, 0);
+        if (n <= 0) break;
+        len += (size_t)n;
+
+        size_t off = 0;
+        if (json) {
+            uint8_t *end;
+            while ((end = memchr(in + off, '\n', len - off)) != NULL) {
+                *end = '\0';
+                const char *line = (const char*)in + off;
+                if (strstr(line, "\"ball\"")) balls++;
+                else {
+                    results++;
+                    if (!strstr(line, "\"status\":\"ok\"")) failed++;
+                    if (requests <= 10) printf("%s\n", line);
+                }
+                off = (size_t)(end - in) + 1;
+            }
+        } else {
+            while (len - off >= 4 && len - off >= 4 + sim_get_u32(in + off)) {
+                const uint8_t *p = in + off + 4;
+                if (p[0] == SIM_MSG_BALL) balls++;
+                else if (p[0] == SIM_MSG_RESULT) {
+                    results++;
+                    if (p[5] != SIM_RESULT_OK) failed++;
+                    else if (requests <= 10) {
+                        printf("#%u: %d/%d (%d balls) v %d/%d (%d balls), winner %d\n", sim_get_u32(p + 1),
+                               sim_get_u16(p + 8), p[10], sim_get_u16(p + 11), sim_get_u16(p + 13), p[15], sim_get_u16(p + 16), (int8_t)p[7]);
+                    }
+                }
+                off += 4 + sim_get_u32(in + off);
+            }
+        }
+        memmove(in, in + off, len - off);
+        len -= off;
+    }
+
+    double elapsed = now_seconds() - start;
+    printf("%d results (%d refused or failed, %d balls streamed) in %.2f s: %.0f matches/s\n",
+           results, failed, balls, elapsed, results / (elapsed > 0 ? elapsed : 1));
+
+    // The server's own view, over a fresh binary connection so the reply is easy to find
+    close(fd);
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+        uint8_t frame[16], reply[4 + SIM_STATS_PAYLOAD_LEN];
+        size_t got = 0;
+        send_all(fd, frame, (size_t)sim_encode_stats(frame, 0));
+        while (got < sizeof(reply)) {
+            ssize_t n = recv(fd, reply + got, sizeof(reply) - got, 0);
+            if (n <= 0) break;
+            got += (size_t)n;
+        }
+        if (got == sizeof(reply) && reply[4] == SIM_MSG_STATS_REPLY) {
+            const uint8_t *p = reply + 9;
+            printf("server: queue depth %u, %u connections, %llu matches, latency p50 %u us, p90 %u us, p99 %u us, max %u us\n",
+                   sim_get_u32(p), sim_get_u32(p + 4), (unsigned long long)sim_get_u64(p + 8),
+                   sim_get_u32(p + 16), sim_get_u32(p + 20), sim_get_u32(p + 24), sim_get_u32(p + 28));
+        }
+    }
+    close(fd);
+    free(in);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#ifndef SIM_PROTOCOL_H
+#define SIM_PROTOCOL_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Wire format of the simulation server. Every message is a frame: a little-endian u32 payload
+// length, then the payload, which starts with a u8 message type and a u32 request id chosen by
+// the client and echoed in every reply. Integers are little-endian and unaligned.
+//
+// A connection whose first byte is '{' speaks newline-delimited JSON instead, one object per
+// line with the same fields, e.g.
+//   {"id":7,"a":"India","b":"Austraila","format":"T20","seed":42,"rain":false,"stream":false}
+//   {"id":8,"stats":true}
+
+#define SIM_PROTOCOL_SOCKET "/tmp/cricket_sim.sock"
+#define SIM_PROTOCOL_MAX_FRAME 4096     // Requests only; replies with a ball stream are longer
+#define SIM_PROTOCOL_TAG_LEN 16         // Team tag or name, NUL padded
+
+typedef enum {
+    // Client to server
+    SIM_MSG_MATCH = 0x01,       // tag_a[16] tag_b[16] u8 format u8 flags u32 seed
+    SIM_MSG_STATS = 0x02,       // nothing else
+
+    // Server to client
+    SIM_MSG_BALL = 0x81,        // u8 innings u8 over u8 ball u8 outcome u8 runs u16 total u8 wickets; only with SIM_FLAG_STREAM
+    SIM_MSG_RESULT = 0x82,      // u8 status u8 batting_first i8 winner, then per innings u16 runs u8 wickets u16 balls
+    SIM_MSG_STATS_REPLY = 0x83  // u32 queue_depth u32 connections u64 completed, then u32 p50 p90 p99 max latency in us
+} SimMessageType;
+
+#define SIM_FLAG_RAIN   0x01
+#define SIM_FLAG_STREAM 0x02    // Send every delivery before the result
+
+typedef enum {
+    SIM_RESULT_OK,
+    SIM_RESULT_UNKNOWN_TEAM,    // No team with that tag or name, or fewer than two players
+    SIM_RESULT_BAD_REQUEST,
+    SIM_RESULT_OVERLOADED       // Too many requests queued, try again later
+} SimResultStatus;
+
+#define SIM_MATCH_PAYLOAD_LEN (1 + 4 + 2 * SIM_PROTOCOL_TAG_LEN + 1 + 1 + 4)
+#define SIM_BALL_PAYLOAD_LEN (1 + 4 + 8)
+#define SIM_RESULT_PAYLOAD_LEN (1 + 4 + 3 + 2 * 5)
+#define SIM_STATS_PAYLOAD_LEN (1 + 4 + 16 + 16)
+
+static inline void sim_put_u16(uint8_t *p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static inline void sim_put_u32(uint8_t *p, uint32_t v) { sim_put_u16(p, (uint16_t)v); sim_put_u16(p + 2, (uint16_t)(v >> 16)); }
+static inline void sim_put_u64(uint8_t *p, uint64_t v) { sim_put_u32(p, (uint32_t)v); sim_put_u32(p + 4, (uint32_t)(v >> 32)); }
+static inline uint16_t sim_get_u16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static inline uint32_t sim_get_u32(const uint8_t *p) { return sim_get_u16(p) | ((uint32_t)sim_get_u16(p + 2) << 16); }
+static inline uint64_t sim_get_u64(const uint8_t *p) { return sim_get_u32(p) | ((uint64_t)sim_get_u32(p + 4) << 32); }
+
+// Writes a whole SIM_MSG_MATCH frame (length prefix included) and returns its size
+static inline int sim_encode_match(uint8_t *out, uint32_t request_id, const char *tag_a, const char *tag_b,
+                                   uint8_t format, uint8_t flags, uint32_t seed) {
+    uint8_t *p = out + 4;
+    sim_put_u32(out, SIM_MATCH_PAYLOAD_LEN);
+    p[0] = SIM_MSG_MATCH;
+    sim_put_u32(p + 1, request_id);
+    memset(p + 5, 0, 2 * SIM_PROTOCOL_TAG_LEN);
+    strncpy((char*)p + 5, tag_a, SIM_PROTOCOL_TAG_LEN - 1);
+    strncpy((char*)p + 5 + SIM_PROTOCOL_TAG_LEN, tag_b, SIM_PROTOCOL_TAG_LEN - 1);
+    p[5 + 2 * SIM_PROTOCOL_TAG_LEN] = format;
+    p[6 + 2 * SIM_PROTOCOL_TAG_LEN] = flags;
+    sim_put_u32(p + 7 + 2 * SIM_PROTOCOL_TAG_LEN, seed);
+    return 4 + SIM_MATCH_PAYLOAD_LEN;
+}
+
+static inline int sim_encode_stats(uint8_t *out, uint32_t request_id) {
+    sim_put_u32(out, 5);
+    out[4] = SIM_MSG_STATS;
+    sim_put_u32(out + 5, request_id);
+    return 9;
+}
+
+#endif // SIM_PROTOCOL_H
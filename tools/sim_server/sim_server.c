@@ -0,0 +1,633 @@
+// Local simulation daemon: plays matches for other processes on the machine over a Unix
+// socket, without the GUI. One thread runs a non-blocking epoll loop that owns every socket;
+// the matches are played on the job_queue pool and handed back to the loop through an eventfd.
+// Linux only. See sim_protocol.h for the wire format.
+//
+//   sh tools/sim_server/build_sim_server.sh
+//   ./sim_server [-s socket_path] [-j workers]
+//
+// Run it from the repository root so Data/teams.dat is found.
+
+#define _GNU_SOURCE // accept4
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "sim_protocol.h"
+#include "sim_engine.h"
+#include "field_coverage.h"
+#include "job_queue.h"
+#include "teams.h"
+
+#define MAX_EVENTS 256
+#define MAX_QUEUED 65536                // Matches waiting for a worker before new requests are refused
+#define OUTPUT_HIGH_WATER (4u << 20)    // Stop reading from a client that does not read its replies
+#define LATENCY_SAMPLES 8192            // The percentiles cover this many of the latest matches
+#define RAIN_CHANCE_PER_OVER 0.1f       // Same as simulate_match
+
+typedef struct {
+    uint8_t *data;
+    size_t len;
+    size_t cap;
+    size_t off;                         // Bytes already consumed (input) or sent (output)
+} Buffer;
+
+typedef enum {
+    MODE_UNKNOWN,                       // Nothing received yet
+    MODE_BINARY,
+    MODE_JSON
+} ConnMode;
+
+typedef struct {
+    int fd;
+    uint32_t generation;                // Tells replies meant for an earlier connection on the same fd apart
+    ConnMode mode;
+    Buffer in;
+    Buffer out;
+    uint32_t events;                    // Currently registered with epoll
+} Connection;
+
+typedef struct Job {
+    // Filled in by the event loop
+    int fd;
+    uint32_t generation;
+    ConnMode mode;
+    uint32_t request_id;
+    const Team *team_a;
+    const Team *team_b;
+    int overs;
+    uint8_t flags;
+    uint32_t seed;
+    uint64_t queued_ns;
+
+    // Filled in by the worker
+    Buffer reply;
+    struct Job *next;
+} Job;
+
+static volatile sig_atomic_t stop_requested = 0;
+static int epoll_fd = -1;
+static int wake_fd = -1;                // eventfd written by workers when a job completes
+
+static Team *teams = NULL;
+static int num_teams = 0;
+
+static Connection **conns = NULL;       // Indexed by fd
+static int conns_cap = 0;
+static int num_conns = 0;
+static uint32_t next_generation = 1;
+
+static pthread_mutex_t done_lock = PTHREAD_MUTEX_INITIALIZER;
+static Job *done_head = NULL, *done_tail = NULL;
+
+static JobQueue *pool = NULL;
+static int in_flight = 0;               // Pushed to the pool and not yet delivered
+static uint64_t completed = 0;
+static uint32_t latency_us[LATENCY_SAMPLES];
+static int latency_count = 0;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void on_signal(int sig) {
+    (void)sig;
+    stop_requested = 1;
+}
+
+// --- Buffers ---
+
+static bool buffer_reserve(Buffer *b, size_t extra) {
+    if (b->len + extra <= b->cap) return true;
+    size_t cap = b->cap ? b->cap : 256;
+    while (cap < b->len + extra) cap *= 2;
+    uint8_t *grown = realloc(b->data, cap);
+    if (!grown) return false;
+    b->data = grown;
+    b->cap = cap;
+    return true;
+}
+
+static void buffer_append(Buffer *b, const void *data, size_t n) {
+    if (!buffer_reserve(b, n)) return;
+    memcpy(b->data + b->len, data, n);
+    b->len += n;
+}
+
+static void buffer_printf(Buffer *b, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+static void buffer_printf(Buffer *b, const char *fmt, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if (n > 0) buffer_append(b, line, (size_t)(n < (int)sizeof(line) ? n : (int)sizeof(line) - 1));
+}
+
+// Drops the consumed bytes so the buffer does not grow without end
+static void buffer_compact(Buffer *b) {
+    if (b->off == 0) return;
+    memmove(b->data, b->data + b->off, b->len - b->off);
+    b->len -= b->off;
+    b->off = 0;
+}
+
+static void buffer_free(Buffer *b) {
+    free(b->data);
+    *b = (Buffer){ 0 };
+}
+
+// --- Replies, written by workers and by the loop ---
+
+static uint8_t* begin_frame(Buffer *b, uint8_t type, uint32_t request_id, uint32_t payload_len) {
+    if (!buffer_reserve(b, 4 + payload_len)) return NULL;
+    uint8_t *p = b->data + b->len;
+    sim_put_u32(p, payload_len);
+    p[4] = type;
+    sim_put_u32(p + 5, request_id);
+    b->len += 4 + payload_len;
+    return p + 9; // Message-specific fields
+}
+
+static const char* outcome_name(BallOutcomeType type) {
+    switch (type) {
+        case OUTCOME_DOT: return "dot";
+        case OUTCOME_RUNS: return "runs";
+        case OUTCOME_WICKET: return "wicket";
+        default: return "extra";
+    }
+}
+
+static const char* status_name(SimResultStatus status) {
+    switch (status) {
+        case SIM_RESULT_OK: return "ok";
+        case SIM_RESULT_UNKNOWN_TEAM: return "unknown_team";
+        case SIM_RESULT_OVERLOADED: return "overloaded";
+        default: return "bad_request";
+    }
+}
+
+static void write_ball(Buffer *b, ConnMode mode, uint32_t request_id, int innings, const GameState *state, const BallOutcome *ball) {
+    bool over_done = (state->balls_bowled_in_over == 0);
+    int over = over_done ? state->overs_completed - 1 : state->overs_completed;
+    int in_over = over_done ? 6 : state->balls_bowled_in_over;
+
+    if (mode == MODE_JSON) {
+        buffer_printf(b, "{\"id\":%u,\"ball\":{\"innings\":%d,\"over\":%d,\"ball\":%d,\"outcome\":\"%s\",\"runs\":%d,\"total\":%d,\"wickets\":%d}}\n",
+                      request_id, innings, over, in_over, outcome_name(ball->type), ball->runs, state->total_runs, state->wickets);
+        return;
+    }
+    uint8_t *p = begin_frame(b, SIM_MSG_BALL, request_id, SIM_BALL_PAYLOAD_LEN);
+    if (!p) return;
+    p[0] = (uint8_t)innings;
+    p[1] = (uint8_t)over;
+    p[2] = (uint8_t)in_over;
+    p[3] = (uint8_t)ball->type;
+    p[4] = (uint8_t)ball->runs;
+    sim_put_u16(p + 5, (uint16_t)state->total_runs);
+    p[7] = (uint8_t)state->wickets;
+}
+
+static void write_result(Buffer *b, ConnMode mode, uint32_t request_id, SimResultStatus status,
+                         int batting_first, int winner, const int runs[2], const int wickets[2], const int balls[2]) {
+    if (mode == MODE_JSON) {
+        if (status != SIM_RESULT_OK) {
+            buffer_printf(b, "{\"id\":%u,\"status\":\"%s\"}\n", request_id, status_name(status));
+        } else {
+            buffer_printf(b, "{\"id\":%u,\"status\":\"ok\",\"batting_first\":%d,\"winner\":%d,\"runs\":[%d,%d],\"wickets\":[%d,%d],\"balls\":[%d,%d]}\n",
+                          request_id, batting_first, winner, runs[0], runs[1], wickets[0], wickets[1], balls[0], balls[1]);
+        }
+        return;
+    }
+    uint8_t *p = begin_frame(b, SIM_MSG_RESULT, request_id, SIM_RESULT_PAYLOAD_LEN);
+    if (!p) return;
+    memset(p, 0, SIM_RESULT_PAYLOAD_LEN - 5);
+    p[0] = (uint8_t)status;
+    p[1] = (uint8_t)batting_first;
+    p[2] = (uint8_t)(int8_t)winner;
+    for (int i = 0; i < 2 && status == SIM_RESULT_OK; i++) {
+        sim_put_u16(p + 3 + i * 5, (uint16_t)runs[i]);
+        p[5 + i * 5] = (uint8_t)wickets[i];
+        sim_put_u16(p + 6 + i * 5, (uint16_t)balls[i]);
+    }
+}
+
+static void write_error(Buffer *b, ConnMode mode, uint32_t request_id, SimResultStatus status) {
+    static const int zero[2] = { 0, 0 };
+    write_result(b, mode, request_id, status, 0, -1, zero, zero, zero);
+}
+
+// --- Workers ---
+
+static void play_job(void *arg) {
+    Job *job = (Job*)arg;
+    SimMatch *match = malloc(sizeof(SimMatch));
+
+    if (!match) {
+        write_error(&job->reply, job->mode, job->request_id, SIM_RESULT_OVERLOADED);
+    } else {
+        SimRng toss;
+        sim_rng_seed(&toss, job->seed);
+        int batting_first = sim_rng_range(&toss, 0, 1);
+        const Team *first = batting_first ? job->team_b : job->team_a;
+        const Team *second = batting_first ? job->team_a : job->team_b;
+        sim_match_init(match, first, second, job->overs, sim_rng_next(&toss));
+        if (job->flags & SIM_FLAG_RAIN) match->state.rain_percentage = RAIN_CHANCE_PER_OVER;
+
+        for (;;) {
+            int innings = match->innings;
+            SimStatus status = sim_match_step(match);
+            if (status == SIM_STATUS_BALL_DONE) {
+                if (job->flags & SIM_FLAG_STREAM) write_ball(&job->reply, job->mode, job->request_id, innings + 1, &match->state, &match->engine.last);
+            } else if (status != SIM_STATUS_INNINGS_OVER) {
+                break;
+            }
+        }
+        // Map the engine's "side batting first" back to team A/team B
+        int winner = (match->winner < 0) ? -1 : (match->winner == 0 ? batting_first : 1 - batting_first);
+        write_result(&job->reply, job->mode, job->request_id, SIM_RESULT_OK, batting_first, winner, match->runs, match->wickets, match->balls);
+        free(match);
+    }
+
+    pthread_mutex_lock(&done_lock);
+    job->next = NULL;
+    if (done_tail) done_tail->next = job;
+    else done_head = job;
+    done_tail = job;
+    pthread_mutex_unlock(&done_lock);
+
+    uint64_t one = 1;
+    if (write(wake_fd, &one, sizeof(one)) < 0) { } // Already signalled if the counter is full
+}
+
+// --- Connections ---
+
+static void update_events(Connection *conn) {
+    uint32_t events = 0;
+    if (conn->out.len - conn->out.off < OUTPUT_HIGH_WATER) events |= EPOLLIN;
+    if (conn->out.off < conn->out.len) events |= EPOLLOUT;
+    if (events == conn->events) return;
+    struct epoll_event ev = { .events = events, .data.fd = conn->fd };
+    epoll_ctl(epoll_fd, EPOLL_CTL_MOD, conn->fd, &ev);
+    conn->events = events;
+}
+
+static void close_connection(Connection *conn) {
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+    close(conn->fd);
+    conns[conn->fd] = NULL;
+    num_conns--;
+    buffer_free(&conn->in);
+    buffer_free(&conn->out);
+    free(conn);
+}
+
+static void open_connection(int fd) {
+    if (fd >= conns_cap) {
+        int cap = conns_cap ? conns_cap : 64;
+        while (cap <= fd) cap *= 2;
+        Connection **grown = realloc(conns, cap * sizeof(Connection*));
+        if (!grown) { close(fd); return; }
+        memset(grown + conns_cap, 0, (cap - conns_cap) * sizeof(Connection*));
+        conns = grown;
+        conns_cap = cap;
+    }
+    Connection *conn = calloc(1, sizeof(Connection));
+    if (!conn) { close(fd); return; }
+    conn->fd = fd;
+    conn->generation = next_generation++;
+    conn->events = EPOLLIN;
+    struct epoll_event ev = { .events = EPOLLIN, .data.fd = fd };
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) { close(fd); free(conn); return; }
+    conns[fd] = conn;
+    num_conns++;
+}
+
+// Sends what the socket takes; false if the connection was closed
+static bool flush_connection(Connection *conn) {
+    while (conn->out.off < conn->out.len) {
+        ssize_t n = send(conn->fd, conn->out.data + conn->out.off, conn->out.len - conn->out.off, MSG_NOSIGNAL);
+        if (n > 0) { conn->out.off += (size_t)n; continue; }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        close_connection(conn);
+        return false;
+    }
+    if (conn->out.off == conn->out.len) conn->out.off = conn->out.len = 0;
+    update_events(conn);
+    return true;
+}
+
+// --- Requests ---
+
+static const Team* find_team(const char *key) {
+    for (int i = 0; i < num_teams; i++) {
+        const Team *t = &teams[i];
+        if (t->is_deleted || t->num_players < 2) continue;
+        if ((t->tag[0] && strcasecmp(t->tag, key) == 0) || strcasecmp(t->name, key) == 0) return t;
+    }
+    return NULL;
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void write_stats(Connection *conn, uint32_t request_id) {
+    static uint32_t sorted[LATENCY_SAMPLES];
+    int n = latency_count < LATENCY_SAMPLES ? latency_count : LATENCY_SAMPLES;
+    memcpy(sorted, latency_us, n * sizeof(uint32_t));
+    qsort(sorted, n, sizeof(uint32_t), compare_u32);
+    uint32_t p50 = n ? sorted[(n - 1) * 50 / 100] : 0;
+    uint32_t p90 = n ? sorted[(n - 1) * 90 / 100] : 0;
+    uint32_t p99 = n ? sorted[(n - 1) * 99 / 100] : 0;
+    uint32_t max = n ? sorted[n - 1] : 0;
+    int queue_depth = job_queue_pending(pool);
+
+    if (conn->mode == MODE_JSON) {
+        buffer_printf(&conn->out, "{\"id\":%u,\"queue_depth\":%d,\"connections\":%d,\"completed\":%llu,\"p50_us\":%u,\"p90_us\":%u,\"p99_us\":%u,\"max_us\":%u}\n",
+                      request_id, queue_depth, num_conns, (unsigned long long)completed, p50, p90, p99, max);
+        return;
+    }
+    uint8_t *p = begin_frame(&conn->out, SIM_MSG_STATS_REPLY, request_id, SIM_STATS_PAYLOAD_LEN);
+    if (!p) return;
+    sim_put_u32(p, (uint32_t)queue_depth);
+    sim_put_u32(p + 4, (uint32_t)num_conns);
+    sim_put_u64(p + 8, completed);
+    sim_put_u32(p + 16, p50);
+    sim_put_u32(p + 20, p90);
+    sim_put_u32(p + 24, p99);
+    sim_put_u32(p + 28, max);
+}
+
+static void request_match(Connection *conn, uint32_t request_id, const char *tag_a, const char *tag_b,
+                          int format, uint8_t flags, uint32_t seed) {
+    const Team *a = find_team(tag_a);
+    const Team *b = find_team(tag_b);
+    if (!a || !b) { write_error(&conn->out, conn->mode, request_id, SIM_RESULT_UNKNOWN_TEAM); return; }
+    if (format < FORMAT_T20 || format > FORMAT_TEST) { write_error(&conn->out, conn->mode, request_id, SIM_RESULT_BAD_REQUEST); return; }
+    if (in_flight >= MAX_QUEUED) { write_error(&conn->out, conn->mode, request_id, SIM_RESULT_OVERLOADED); return; }
+
+    Job *job = calloc(1, sizeof(Job));
+    if (!job) { write_error(&conn->out, conn->mode, request_id, SIM_RESULT_OVERLOADED); return; }
+    job->fd = conn->fd;
+    job->generation = conn->generation;
+    job->mode = conn->mode;
+    job->request_id = request_id;
+    job->team_a = a;
+    job->team_b = b;
+    job->overs = (format == FORMAT_T20) ? 20 : SIM_MAX_OVERS; // The engine plays limited-overs innings only
+    job->flags = flags;
+    job->seed = seed;
+    job->queued_ns = now_ns();
+    in_flight++;
+    job_queue_push(pool, play_job, job);
+}
+
+static void handle_frame(Connection *conn, const uint8_t *p, uint32_t len) {
+    uint32_t request_id = sim_get_u32(p + 1);
+    switch (p[0]) {
+        case SIM_MSG_MATCH: {
+            if (len < SIM_MATCH_PAYLOAD_LEN) { write_error(&conn->out, conn->mode, request_id, SIM_RESULT_BAD_REQUEST); return; }
+            char tag_a[SIM_PROTOCOL_TAG_LEN], tag_b[SIM_PROTOCOL_TAG_LEN];
+            memcpy(tag_a, p + 5, SIM_PROTOCOL_TAG_LEN);
+            memcpy(tag_b, p + 5 + SIM_PROTOCOL_TAG_LEN, SIM_PROTOCOL_TAG_LEN);
+            tag_a[SIM_PROTOCOL_TAG_LEN - 1] = tag_b[SIM_PROTOCOL_TAG_LEN - 1] = '\0';
+            const uint8_t *rest = p + 5 + 2 * SIM_PROTOCOL_TAG_LEN;
+            request_match(conn, request_id, tag_a, tag_b, rest[0], rest[1], sim_get_u32(rest + 2));
+            break;
+        }
+        case SIM_MSG_STATS:
+            write_stats(conn, request_id);
+            break;
+        default:
+            write_error(&conn->out, conn->mode, request_id, SIM_RESULT_BAD_REQUEST);
+            break;
+    }
+}
+
+// Value of "key" in a flat one-line JSON object, or NULL; all the protocol's requests are that simple
+static const char* json_value(const char *line, const char *key) {
+    char pattern[40];
+    snprintf(pattern, sizeof(pattern), "\"%s\"", key);
+    const char *p = strstr(line, pattern);
+    if (!p) return NULL;
+    p += strlen(pattern);
+    while (*p == ' ' || *p == '\t') p++;
+    if (*p++ != ':') return NULL;
+    while (*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+static bool json_string(const char *line, const char *key, char *out, size_t size) {
+    const char *v = json_value(line, key);
+    if (!v || *v != '"') return false;
+    size_t n = 0;
+    for (v++; *v && *v != '"' && n + 1 < size; v++) out[n++] = *v;
+    out[n] = '\0';
+    return true;
+}
+
+static long json_number(const char *line, const char *key, long fallback) {
+    const char *v = json_value(line, key);
+    return (v && (*v == '-' || (*v >= '0' && *v <= '9'))) ? strtol(v, NULL, 10) : fallback;
+}
+
+static bool json_bool(const char *line, const char *key) {
+    const char *v = json_value(line, key);
+    return v && strncmp(v, "true", 4) == 0;
+}
+
+static void handle_json_line(Connection *conn, char *line) {
+    uint32_t request_id = (uint32_t)json_number(line, "id", 0);
+    if (json_bool(line, "stats")) {
+        write_stats(conn, request_id);
+        return;
+    }
+
+    char tag_a[SIM_PROTOCOL_TAG_LEN], tag_b[SIM_PROTOCOL_TAG_LEN], format_name[8] = "ODI";
+    if (!json_string(line, "a", tag_a, sizeof(tag_a)) || !json_string(line, "b", tag_b, sizeof(tag_b))) {
+        write_error(&conn->out, conn->mode, request_id, SIM_RESULT_BAD_REQUEST);
+        return;
+    }
+    int format = (int)json_number(line, "format", -1);
+    if (format < 0) {
+        json_string(line, "format", format_name, sizeof(format_name));
+        format = strcasecmp(format_name, "T20") == 0 ? FORMAT_T20 : strcasecmp(format_name, "ODI") == 0 ? FORMAT_ODI :
+                 strcasecmp(format_name, "Test") == 0 ? FORMAT_TEST : -1;
+    }
+    uint8_t flags = (json_bool(line, "rain") ? SIM_FLAG_RAIN : 0) | (json_bool(line, "stream") ? SIM_FLAG_STREAM : 0);
+    request_match(conn, request_id, tag_a, tag_b, format, flags, (uint32_t)json_number(line, "seed", 1));
+}
+
+// Handles every complete request in the input buffer; false if the connection was closed
+static bool handle_input(Connection *conn) {
+    Buffer *in = &conn->in;
+    if (conn->mode == MODE_UNKNOWN && in->len > 0) conn->mode = (in->data[0] == '{') ? MODE_JSON : MODE_BINARY;
+
+    if (conn->mode == MODE_BINARY) {
+        while (in->len - in->off >= 4) {
+            uint32_t len = sim_get_u32(in->data + in->off);
+            if (len < 5 || len > SIM_PROTOCOL_MAX_FRAME) { close_connection(conn); return false; } // Not our protocol
+            if (in->len - in->off < 4 + len) break;
+            handle_frame(conn, in->data + in->off + 4, len);
+            in->off += 4 + len;
+        }
+    } else if (conn->mode == MODE_JSON) {
+        for (;;) {
+            uint8_t *start = in->data + in->off;
+            uint8_t *end = memchr(start, '\n', in->len - in->off);
+            if (!end) {
+                if (in->len - in->off > SIM_PROTOCOL_MAX_FRAME) { close_connection(conn); return false; }
+                break;
+            }
+            *end = '\0';
+            handle_json_line(conn, (char*)start);
+            in->off = (size_t)(end - in->data) + 1;
+        }
+    }
+    buffer_compact(in);
+    return flush_connection(conn);
+}
+
+static void read_connection(Connection *conn) {
+    for (;;) {
+        if (!buffer_reserve(&conn->in, 4096)) { close_connection(conn); return; }
+        ssize_t n = recv(conn->fd, conn->in.data + conn->in.len, conn->in.cap - conn->in.len, 0);
+        if (n > 0) {
+            conn->in.len += (size_t)n;
+            if (!handle_input(conn)) return;
+            if (!(conn->events & EPOLLIN)) return; // Replies are piling up, read the rest once they drain
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        close_connection(conn); // Closed by the client, or an error
+        return;
+    }
+}
+
+// Moves finished matches to their connections
+static void deliver_completed(void) {
+    uint64_t count;
+    if (read(wake_fd, &count, sizeof(count)) < 0) { } // Nothing pending is fine
+
+    pthread_mutex_lock(&done_lock);
+    Job *job = done_head;
+    done_head = done_tail = NULL;
+    pthread_mutex_unlock(&done_lock);
+
+    uint64_t now = now_ns();
+    while (job) {
+        Job *next = job->next;
+        in_flight--;
+        completed++;
+        latency_us[latency_count++ % LATENCY_SAMPLES] = (uint32_t)((now - job->queued_ns) / 1000);
+        if (latency_count >= 2 * LATENCY_SAMPLES) latency_count -= LATENCY_SAMPLES; // Keeps the index from overflowing
+
+        Connection *conn = (job->fd < conns_cap) ? conns[job->fd] : NULL;
+        if (conn && conn->generation == job->generation) {
+            buffer_append(&conn->out, job->reply.data, job->reply.len);
+            flush_connection(conn);
+        }
+        buffer_free(&job->reply);
+        free(job);
+        job = next;
+    }
+}
+
+static int open_listener(const char *path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    unlink(path); // A stale socket from an earlier run
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int main(int argc, char **argv) {
+    const char *socket_path = SIM_PROTOCOL_SOCKET;
+    int workers = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) socket_path = argv[++i];
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) workers = atoi(argv[++i]);
+        else { fprintf(stderr, "usage: %s [-s socket_path] [-j workers]\n", argv[0]); return 2; }
+    }
+
+    teams = load_teams(&num_teams);
+    if (!teams) {
+        fprintf(stderr, "Error: could not load Data/teams.dat, run from the repository root.\n");
+        return 1;
+    }
+    field_coverage_init();
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    signal(SIGPIPE, SIG_IGN);
+
+    int listen_fd = open_listener(socket_path);
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (listen_fd < 0 || epoll_fd < 0 || wake_fd < 0) {
+        fprintf(stderr, "Error: could not listen on %s: %s\n", socket_path, strerror(errno));
+        return 1;
+    }
+    struct epoll_event ev = { .events = EPOLLIN, .data.fd = listen_fd };
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &ev);
+    ev = (struct epoll_event){ .events = EPOLLIN, .data.fd = wake_fd };
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &ev);
+
+    pool = job_queue_create(workers);
+    printf("Simulating on %s with %d teams loaded\n", socket_path, num_teams);
+    fflush(stdout);
+
+    struct epoll_event events[MAX_EVENTS];
+    while (!stop_requested) {
+        int n = epoll_wait(epoll_fd, events, MAX_EVENTS, 1000);
+        if (n < 0 && errno != EINTR) break;
+        for (int i = 0; i < n; i++) {
+            int fd = events[i].data.fd;
+            if (fd == listen_fd) {
+                int client;
+                while ((client = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) open_connection(client);
+            } else if (fd == wake_fd) {
+                deliver_completed();
+            } else if (fd < conns_cap && conns[fd]) {
+                Connection *conn = conns[fd];
+                if (events[i].events & (EPOLLERR | EPOLLHUP) && !(events[i].events & EPOLLIN)) { close_connection(conn); continue; }
+                if ((events[i].events & EPOLLOUT) && !flush_connection(conn)) continue;
+                if (events[i].events & EPOLLIN) read_connection(conn);
+            }
+        }
+    }
+
+    printf("Shutting down after %llu matches\n", (unsigned long long)completed);
+    close(listen_fd);
+    unlink(socket_path);
+    job_queue_destroy(pool); // Lets the queued matches finish
+    deliver_completed();
+    for (int fd = 0; fd < conns_cap; fd++) if (conns[fd]) close_connection(conns[fd]);
+    free(conns);
+    free(teams);
+    close(wake_fd);
+    close(epoll_fd);
+    return 0;
+}